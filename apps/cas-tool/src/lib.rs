@@ -118,17 +118,82 @@ pub fn chunk_payload(payload: &[u8], chunk_bytes: usize) -> Result<Vec<CasChunk>
             chunk_bytes
         );
     }
-    let mut chunks = Vec::new();
-    for block in payload.chunks(chunk_bytes) {
-        let digest = Sha256::digest(block);
-        let mut out = [0u8; 32];
-        out.copy_from_slice(&digest);
-        chunks.push(CasChunk {
-            digest: out,
-            data: block.to_vec(),
+    // Chunk digests are independent, so they fan out across the cores; the
+    // result vector keeps payload order, so bundle identity is unchanged.
+    let blocks: Vec<&[u8]> = payload.chunks(chunk_bytes).collect();
+    let workers = std::thread::available_parallelism()
+        .map(|count| count.get())
+        .unwrap_or(1)
+        .min(blocks.len().max(1));
+    let mut digests: Vec<[u8; 32]> = vec![[0u8; 32]; blocks.len()];
+    if workers <= 1 {
+        for (slot, block) in digests.iter_mut().zip(&blocks) {
+            slot.copy_from_slice(&Sha256::digest(block));
+        }
+    } else {
+        let next = std::sync::atomic::AtomicUsize::new(0);
+        let digests_cells: Vec<std::sync::Mutex<&mut [u8; 32]>> =
+            digests.iter_mut().map(std::sync::Mutex::new).collect();
+        std::thread::scope(|scope| {
+            for _ in 0..workers {
+                let next = &next;
+                let blocks = &blocks;
+                let digests_cells = &digests_cells;
+                scope.spawn(move || loop {
+                    let index = next.fetch_add(1, std::sync::atomic::Ordering::Relaxed);
+                    let Some(block) = blocks.get(index) else {
+                        break;
+                    };
+                    let digest = Sha256::digest(block);
+                    digests_cells[index]
+                        .lock()
+                        .expect("digest cell lock")
+                        .copy_from_slice(&digest);
+                });
+            }
         });
     }
-    Ok(chunks)
+    Ok(digests
+        .into_iter()
+        .zip(blocks)
+        .map(|(digest, block)| CasChunk {
+            digest,
+            data: block.to_vec(),
+        })
+        .collect())
+}
+
+/// Deterministic binary Merkle root over ordered chunk digests.
+///
+/// Pairs are folded level by level (odd tails promote unchanged), so the
+/// root is reproducible regardless of how many cores hashed the leaves.
+/// The manifest's payload_sha256 stays the linear digest for compatibility
+/// with deployed verifiers; the tree root is the forward-looking identity
+/// for parallel verification.
+#[must_use]
+pub fn tree_root(digests: &[[u8; 32]]) -> [u8; 32] {
+    if digests.is_empty() {
+        return [0u8; 32];
+    }
+    let mut level: Vec<[u8; 32]> = digests.to_vec();
+    while level.len() > 1 {
+        level = level
+            .chunks(2)
+            .map(|pair| {
+                if pair.len() == 1 {
+                    pair[0]
+                } else {
+                    let mut hasher = Sha256::new();
+                    hasher.update(pair[0]);
+                    hasher.update(pair[1]);
+                    let mut out = [0u8; 32];
+                    out.copy_from_slice(&hasher.finalize());
+                    out
+                }
+            })
+            .collect();
+    }
+    level[0]
 }
 
 /// Load a base bundle for delta computation.
@@ -210,6 +275,7 @@ pub fn build_bundle(
         payload_bytes,
         payload_sha256,
         chunks: chunks.iter().map(|chunk| chunk.digest).collect(),
+        chunk_lens: None,
         delta,
         signature: None,
     };
@@ -266,3 +332,98 @@ pub fn bundle_paths(bundle_dir: &Path) -> Result<(PathBuf, PathBuf)> {
     }
     Ok((manifest_path, chunks_dir))
 }
+
+/// Summary of an unpack operation.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct UnpackSummary {
+    /// Chunks verified and placed.
+    pub chunks: usize,
+    /// Total payload bytes placed.
+    pub bytes: u64,
+}
+
+/// Unpack a bundle into its final registry location, in parallel.
+///
+/// Chunks are claimed from a shared index by one worker per core; each is
+/// read, digest-verified, and written directly to its destination (tmp file
+/// plus rename for atomicity — no staged assembly copy). Any verification
+/// failure aborts the unpack with the offending digest named.
+pub fn unpack_bundle(bundle_dir: &Path, dest_dir: &Path) -> Result<UnpackSummary> {
+    let (manifest_path, chunks_dir) = bundle_paths(bundle_dir)?;
+    let manifest_cbor = fs::read(&manifest_path)
+        .with_context(|| format!("read manifest {}", manifest_path.display()))?;
+    let manifest = CasManifest::decode(&manifest_cbor)
+        .map_err(|err| anyhow::anyhow!("decode manifest: {err}"))?;
+    let dest_chunks = dest_dir.join("chunks");
+    fs::create_dir_all(&dest_chunks)
+        .with_context(|| format!("create dest chunks dir {}", dest_chunks.display()))?;
+
+    let workers = std::thread::available_parallelism()
+        .map(|count| count.get())
+        .unwrap_or(1)
+        .min(manifest.chunks.len().max(1));
+    let next = std::sync::atomic::AtomicUsize::new(0);
+    let bytes = std::sync::atomic::AtomicU64::new(0);
+    let failure: std::sync::Mutex<Option<anyhow::Error>> = std::sync::Mutex::new(None);
+
+    std::thread::scope(|scope| {
+        for _ in 0..workers {
+            let next = &next;
+            let bytes = &bytes;
+            let failure = &failure;
+            let manifest = &manifest;
+            let chunks_dir = &chunks_dir;
+            let dest_chunks = &dest_chunks;
+            scope.spawn(move || loop {
+                if failure.lock().expect("unpack failure lock").is_some() {
+                    break;
+                }
+                let index = next.fetch_add(1, std::sync::atomic::Ordering::Relaxed);
+                let Some(digest) = manifest.chunks.get(index) else {
+                    break;
+                };
+                let name = hex::encode(digest);
+                let outcome = (|| -> Result<u64> {
+                    let data = fs::read(chunks_dir.join(&name))
+                        .with_context(|| format!("read chunk {name}"))?;
+                    let actual = Sha256::digest(&data);
+                    if actual.as_slice() != digest {
+                        bail!("chunk {name} failed verification");
+                    }
+                    let dest = dest_chunks.join(&name);
+                    let tmp = dest.with_extension("partial");
+                    fs::write(&tmp, &data)
+                        .with_context(|| format!("write chunk {}", tmp.display()))?;
+                    fs::rename(&tmp, &dest)
+                        .with_context(|| format!("commit chunk {}", dest.display()))?;
+                    Ok(data.len() as u64)
+                })();
+                match outcome {
+                    Ok(written) => {
+                        bytes.fetch_add(written, std::sync::atomic::Ordering::Relaxed);
+                    }
+                    Err(err) => {
+                        failure
+                            .lock()
+                            .expect("unpack failure lock")
+                            .get_or_insert(err);
+                        break;
+                    }
+                }
+            });
+        }
+    });
+
+    if let Some(err) = failure.into_inner().expect("unpack failure lock") {
+        return Err(err);
+    }
+    let manifest_dest = dest_dir.join("manifest.cbor");
+    let tmp = manifest_dest.with_extension("partial");
+    fs::write(&tmp, &manifest_cbor).with_context(|| format!("write manifest {}", tmp.display()))?;
+    fs::rename(&tmp, &manifest_dest)
+        .with_context(|| format!("commit manifest {}", manifest_dest.display()))?;
+    Ok(UnpackSummary {
+        chunks: manifest.chunks.len(),
+        bytes: bytes.into_inner(),
+    })
+}
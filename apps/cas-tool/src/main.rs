@@ -40,6 +40,18 @@ enum Command {
     Pack(PackArgs),
     /// Upload a CAS bundle via the TCP console.
     Upload(UploadArgs),
+    /// Verify and place a bundle's chunks into a registry directory.
+    Unpack(UnpackArgs),
+}
+
+#[derive(Debug, Parser)]
+struct UnpackArgs {
+    /// Bundle directory containing manifest.cbor and chunks/.
+    #[arg(long)]
+    bundle: PathBuf,
+    /// Destination registry directory.
+    #[arg(long)]
+    dest: PathBuf,
 }
 
 #[derive(Debug, Parser)]
@@ -91,6 +103,16 @@ fn main() -> Result<()> {
     match cli.command {
         Command::Pack(args) => pack_bundle(args),
         Command::Upload(args) => upload_bundle(args),
+        Command::Unpack(args) => {
+            let summary = cas_tool::unpack_bundle(&args.bundle, &args.dest)?;
+            println!(
+                "unpacked chunks={} bytes={} dest={}",
+                summary.chunks,
+                summary.bytes,
+                args.dest.display()
+            );
+            Ok(())
+        }
     }
 }
 
@@ -71,3 +71,53 @@ fn delta_bundle_hashes_with_base() {
     assert_eq!(digest.as_slice(), delta_bundle.manifest.payload_sha256);
     assert!(delta_bundle.manifest.delta.is_some());
 }
+
+#[test]
+fn parallel_chunk_hashing_is_deterministic() {
+    let payload: Vec<u8> = (0..64 * 1024u32).map(|i| (i % 251) as u8).collect();
+    let chunks_a = cas_tool::chunk_payload(&payload, 4096).expect("chunk payload");
+    let chunks_b = cas_tool::chunk_payload(&payload, 4096).expect("chunk payload");
+    let digests_a: Vec<[u8; 32]> = chunks_a.iter().map(|c| c.digest).collect();
+    let digests_b: Vec<[u8; 32]> = chunks_b.iter().map(|c| c.digest).collect();
+    assert_eq!(digests_a, digests_b);
+    // Tree root folds deterministically and reacts to any leaf change.
+    let root = cas_tool::tree_root(&digests_a);
+    assert_eq!(root, cas_tool::tree_root(&digests_b));
+    let mut mutated = digests_a.clone();
+    mutated[3][0] ^= 1;
+    assert_ne!(root, cas_tool::tree_root(&mutated));
+}
+
+#[test]
+fn unpack_places_verified_chunks_in_parallel() {
+    let payload: Vec<u8> = (0..32 * 1024u32).map(|i| (i % 253) as u8).collect();
+    let template = cas_tool::CasTemplateConfig {
+        chunk_bytes: 4096,
+        delta_allowed: false,
+        signing_required: false,
+    };
+    let bundle =
+        cas_tool::build_bundle("epoch-9", &payload, &template, None, None).expect("build bundle");
+    let dir = tempfile::TempDir::new().expect("tempdir");
+    let bundle_dir = dir.path().join("bundle");
+    cas_tool::write_bundle(&bundle, &bundle_dir).expect("write bundle");
+
+    let dest = dir.path().join("registry");
+    let summary = cas_tool::unpack_bundle(&bundle_dir, &dest).expect("unpack");
+    assert_eq!(summary.chunks, 8);
+    assert_eq!(summary.bytes, payload.len() as u64);
+    assert!(dest.join("manifest.cbor").is_file());
+    for chunk in &bundle.chunks {
+        let path = dest.join("chunks").join(hex::encode(chunk.digest));
+        assert_eq!(std::fs::read(&path).expect("chunk placed"), chunk.data);
+    }
+
+    // A corrupt chunk aborts with the digest named and leaves no partials.
+    let victim = bundle_dir
+        .join("chunks")
+        .join(hex::encode(bundle.chunks[3].digest));
+    std::fs::write(&victim, b"corrupt").expect("corrupt chunk");
+    let dest2 = dir.path().join("registry2");
+    let err = cas_tool::unpack_bundle(&bundle_dir, &dest2).expect_err("must fail");
+    assert!(err.to_string().contains("failed verification"));
+}
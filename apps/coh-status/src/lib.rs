@@ -42,3 +42,96 @@ pub fn trace_policy() -> TracePolicy {
     let policy = CohshPolicy::from_generated();
     TracePolicy::new(policy.trace.max_bytes, SECURE9P_MSIZE, MAX_LINE_LEN as u32)
 }
+
+/// Per-op-class wire accounting for the `--wire-stats` report.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct WireClassStats {
+    /// Operations in the class.
+    pub ops: u64,
+    /// Total bytes on the wire for the class (headers + payload).
+    pub wire_bytes: u64,
+    /// Payload bytes within those frames.
+    pub payload_bytes: u64,
+}
+
+impl WireClassStats {
+    /// Record one frame of the class.
+    pub fn record(&mut self, wire_bytes: u64, payload_bytes: u64) {
+        self.ops += 1;
+        self.wire_bytes += wire_bytes;
+        self.payload_bytes += payload_bytes;
+    }
+
+    /// Header overhead ratio: non-payload bytes over total wire bytes.
+    #[must_use]
+    pub fn overhead_ratio(&self) -> f64 {
+        if self.wire_bytes == 0 {
+            return 0.0;
+        }
+        (self.wire_bytes - self.payload_bytes) as f64 / self.wire_bytes as f64
+    }
+}
+
+/// Efficiency report assembled from per-session accounting.
+#[derive(Debug, Clone, Default)]
+pub struct WireStatsReport {
+    /// Read-class accounting.
+    pub reads: WireClassStats,
+    /// Write-class accounting.
+    pub writes: WireClassStats,
+    /// Control-class accounting (walk/open/clunk/version/attach).
+    pub control: WireClassStats,
+    /// Short-write retries observed.
+    pub retries: u64,
+    /// Backpressure refusals observed.
+    pub backpressure: u64,
+}
+
+impl WireStatsReport {
+    /// Render the report in the coh-status line format.
+    #[must_use]
+    pub fn render(&self) -> String {
+        use std::fmt::Write as _;
+        let mut out = String::new();
+        for (label, class) in [
+            ("read", &self.reads),
+            ("write", &self.writes),
+            ("control", &self.control),
+        ] {
+            let _ = writeln!(
+                out,
+                "wire class={label} ops={} bytes={} payload={} overhead={:.3}",
+                class.ops,
+                class.wire_bytes,
+                class.payload_bytes,
+                class.overhead_ratio(),
+            );
+        }
+        let _ = writeln!(
+            out,
+            "wire retries={} backpressure={}",
+            self.retries, self.backpressure
+        );
+        out
+    }
+}
+
+#[cfg(test)]
+mod wire_stats_tests {
+    use super::*;
+
+    #[test]
+    fn report_accounts_overhead_per_class() {
+        let mut report = WireStatsReport::default();
+        report.reads.record(4096 + 11, 4096);
+        report.reads.record(512 + 11, 512);
+        report.control.record(17, 0);
+        report.retries = 3;
+        let rendered = report.render();
+        assert!(rendered.contains("class=read ops=2"));
+        assert!(rendered.contains("class=control ops=1"));
+        assert!(rendered.contains("retries=3"));
+        assert!(report.control.overhead_ratio() > 0.99);
+        assert!(report.reads.overhead_ratio() < 0.01);
+    }
+}
@@ -135,3 +135,187 @@ pub fn lease<C: CohAccess>(
     ));
     Ok(())
 }
+
+/// Per-poll byte budget for streamed job output (flow control: one
+/// window per poll, the follower never buffers more than this).
+pub const OUTPUT_STREAM_WINDOW_BYTES: usize = 64 * 1024;
+
+/// Marker line a job writer appends after its final output byte.
+pub const JOB_OUTPUT_END_MARKER: &str = "::coh-job-end::";
+
+/// One poll's worth of streamed job output.
+#[derive(Debug, PartialEq, Eq)]
+pub struct OutputPoll {
+    /// New bytes since the previous poll (end marker stripped).
+    pub data: Vec<u8>,
+    /// Whether the end-of-job marker has been observed.
+    pub finished: bool,
+}
+
+/// Offset-tracked follower for a job's output file.
+///
+/// Replaces the poll-and-reread pattern: each poll fetches only the
+/// bytes past the follower's offset (one flow-controlled window at a
+/// time) and completion is the in-band [`JOB_OUTPUT_END_MARKER`]
+/// rather than a separate status read, so long sharded jobs stream
+/// with no overlap re-fetch and sub-second freshness.
+#[derive(Debug)]
+pub struct JobOutputFollower {
+    output_path: String,
+    offset: u64,
+    /// Partial tail held back until the marker check can run on a
+    /// complete line.
+    pending_line: Vec<u8>,
+    finished: bool,
+}
+
+impl JobOutputFollower {
+    /// Follow `output_path` from the beginning.
+    #[must_use]
+    pub fn new(output_path: impl Into<String>) -> Self {
+        Self {
+            output_path: output_path.into(),
+            offset: 0,
+            pending_line: Vec::new(),
+            finished: false,
+        }
+    }
+
+    /// Bytes consumed so far (resume point across invocations).
+    #[must_use]
+    pub fn offset(&self) -> u64 {
+        self.offset
+    }
+
+    /// Fetch the next window of output. Empty `data` with
+    /// `finished: false` means "nothing new yet — poll again".
+    pub fn poll<C: CohAccess>(&mut self, client: &mut C) -> Result<OutputPoll> {
+        if self.finished {
+            return Ok(OutputPoll {
+                data: Vec::new(),
+                finished: true,
+            });
+        }
+        let window =
+            client.read_file_from(&self.output_path, self.offset, OUTPUT_STREAM_WINDOW_BYTES)?;
+        self.offset += window.len() as u64;
+        self.pending_line.extend_from_slice(&window);
+
+        // Release everything up to the last complete line; scan released
+        // lines for the end marker.
+        let Some(last_newline) = self.pending_line.iter().rposition(|byte| *byte == b'\n') else {
+            return Ok(OutputPoll {
+                data: Vec::new(),
+                finished: false,
+            });
+        };
+        let released: Vec<u8> = self.pending_line.drain(..=last_newline).collect();
+        let mut data = Vec::with_capacity(released.len());
+        for line in released.split_inclusive(|byte| *byte == b'\n') {
+            let text = core::str::from_utf8(line).unwrap_or("");
+            if text.trim_end() == JOB_OUTPUT_END_MARKER {
+                self.finished = true;
+                break;
+            }
+            data.extend_from_slice(line);
+        }
+        Ok(OutputPoll {
+            data,
+            finished: self.finished,
+        })
+    }
+}
+
+/// Stream a job's output to the audit transcript until the end marker.
+pub fn follow_output<C: CohAccess>(
+    client: &mut C,
+    audit: &mut CohAudit,
+    gpu_id: &str,
+    job: &str,
+    mut polls: usize,
+) -> Result<bool> {
+    let output_path = format!("{GPU_ROOT}/{gpu_id}/jobs/{job}/output");
+    let mut follower = JobOutputFollower::new(&output_path);
+    while polls > 0 {
+        polls -= 1;
+        let poll = follower.poll(client)?;
+        for line in String::from_utf8_lossy(&poll.data).lines() {
+            audit.push_line(format!("gpu id={gpu_id} job={job} output={line}"));
+        }
+        if poll.finished {
+            audit.push_line(format!("gpu id={gpu_id} job={job} output-end"));
+            return Ok(true);
+        }
+    }
+    Ok(false)
+}
+
+#[cfg(test)]
+mod output_stream_tests {
+    use super::*;
+    use std::collections::HashMap;
+
+    #[derive(Default)]
+    struct MockAccess {
+        files: HashMap<String, Vec<u8>>,
+        ranged_reads: usize,
+    }
+
+    impl CohAccess for MockAccess {
+        fn list_dir(&mut self, _path: &str, _max_bytes: usize) -> Result<Vec<String>> {
+            Ok(Vec::new())
+        }
+
+        fn read_file(&mut self, path: &str, _max_bytes: usize) -> Result<Vec<u8>> {
+            self.files
+                .get(path)
+                .cloned()
+                .ok_or_else(|| anyhow!("missing {path}"))
+        }
+
+        fn read_file_from(&mut self, path: &str, offset: u64, max_bytes: usize) -> Result<Vec<u8>> {
+            self.ranged_reads += 1;
+            let full = self.read_file(path, usize::MAX)?;
+            let start = (offset as usize).min(full.len());
+            Ok(full[start..(start + max_bytes).min(full.len())].to_vec())
+        }
+
+        fn write_append(&mut self, path: &str, payload: &[u8]) -> Result<usize> {
+            self.files
+                .entry(path.to_owned())
+                .or_default()
+                .extend_from_slice(payload);
+            Ok(payload.len())
+        }
+    }
+
+    #[test]
+    fn follower_streams_without_refetching_and_stops_at_marker() {
+        let mut access = MockAccess::default();
+        let path = "/gpu/gpu0/jobs/j1/output";
+        access.write_append(path, b"row 0\nrow 1\npartial").unwrap();
+
+        let mut follower = JobOutputFollower::new(path);
+        let first = follower.poll(&mut access).unwrap();
+        assert_eq!(first.data, b"row 0\nrow 1\n");
+        assert!(!first.finished, "partial line held back");
+
+        // Nothing new: empty poll, offset unchanged past what was read.
+        let idle = follower.poll(&mut access).unwrap();
+        assert!(idle.data.is_empty() && !idle.finished);
+
+        // The writer completes the line and ends the job.
+        access
+            .write_append(path, format!(" row\n{JOB_OUTPUT_END_MARKER}\n").as_bytes())
+            .unwrap();
+        let last = follower.poll(&mut access).unwrap();
+        assert_eq!(last.data, b"partial row\n");
+        assert!(last.finished);
+        assert_eq!(follower.offset() as usize, access.files[path].len());
+
+        // Finished followers never touch the wire again.
+        let reads = access.ranged_reads;
+        assert!(follower.poll(&mut access).unwrap().finished);
+        assert_eq!(access.ranged_reads, reads);
+    }
+}
@@ -179,6 +179,20 @@ pub trait CohAccess {
     fn list_dir(&mut self, path: &str, max_bytes: usize) -> Result<Vec<String>>;
     /// Read an entire file into memory.
     fn read_file(&mut self, path: &str, max_bytes: usize) -> Result<Vec<u8>>;
+    /// Read up to `max_bytes` starting at `offset`.
+    ///
+    /// The default re-reads the whole file and slices — correct for any
+    /// backend — while transports with ranged reads (CohClient) override
+    /// it to fetch only the requested window, which the streaming job
+    /// output follower depends on to avoid re-fetching overlap.
+    fn read_file_from(&mut self, path: &str, offset: u64, max_bytes: usize) -> Result<Vec<u8>> {
+        let full = self.read_file(path, usize::MAX)?;
+        let start = usize::try_from(offset)
+            .unwrap_or(usize::MAX)
+            .min(full.len());
+        let end = start.saturating_add(max_bytes).min(full.len());
+        Ok(full[start..end].to_vec())
+    }
     /// Append payload bytes to a file.
     fn write_append(&mut self, path: &str, payload: &[u8]) -> Result<usize>;
 }
@@ -192,6 +206,30 @@ impl<T: Secure9pTransport> CohAccess for CohClient<T> {
         read_file(self, path, max_bytes)
     }
 
+    fn read_file_from(&mut self, path: &str, offset: u64, max_bytes: usize) -> Result<Vec<u8>> {
+        let fid = self
+            .open(path, OpenMode::read_only())
+            .with_context(|| format!("open {path} for read"))?;
+        let mut cursor = offset;
+        let mut buffer = Vec::new();
+        let count = self.negotiated_msize();
+        while buffer.len() < max_bytes {
+            let chunk = self
+                .read(fid, cursor, count)
+                .with_context(|| format!("read {path}"))?;
+            if chunk.is_empty() {
+                break;
+            }
+            cursor = cursor
+                .checked_add(chunk.len() as u64)
+                .context("read offset overflow")?;
+            buffer.extend_from_slice(&chunk);
+        }
+        let _ = self.clunk(fid);
+        buffer.truncate(max_bytes);
+        Ok(buffer)
+    }
+
     fn write_append(&mut self, path: &str, payload: &[u8]) -> Result<usize> {
         write_append(self, path, payload)
     }
@@ -34,6 +34,93 @@ const ROOT_INODE: u64 = 1;
 #[cfg(feature = "fuse")]
 const TTL: Duration = Duration::from_secs(1);
 
+/// On-disk cache of resolved mount targets, validated by qid version.
+///
+/// Command loops re-resolved mounts every invocation: re-read config,
+/// re-walk the namespace root. The cache persists resolutions across
+/// invocations keyed by mount root, stamped with the root's qid version;
+/// a later invocation revalidates with one walk instead of a full
+/// resolve, and any version change (namespace rebuilt, mounts moved)
+/// discards the entry.
+pub mod resolution_cache {
+    use std::path::{Path, PathBuf};
+
+    use anyhow::{Context, Result};
+    use serde::{Deserialize, Serialize};
+
+    /// One persisted mount resolution.
+    #[derive(Debug, Clone, Serialize, Deserialize, PartialEq, Eq)]
+    pub struct CachedMount {
+        /// Mount root path.
+        pub root: String,
+        /// Resolved allow-listed entries under the root.
+        pub entries: Vec<String>,
+        /// Qid version of the root when resolved.
+        pub qid_version: u32,
+    }
+
+    /// Cache file under the operator's state directory.
+    pub fn cache_path(state_dir: &Path) -> PathBuf {
+        state_dir.join("mount_resolutions.json")
+    }
+
+    /// Load a cached resolution for `root` when the current qid version
+    /// still matches.
+    pub fn load(state_dir: &Path, root: &str, current_version: u32) -> Option<CachedMount> {
+        let text = std::fs::read_to_string(cache_path(state_dir)).ok()?;
+        let entries: Vec<CachedMount> = serde_json::from_str(&text).ok()?;
+        entries
+            .into_iter()
+            .find(|entry| entry.root == root && entry.qid_version == current_version)
+    }
+
+    /// Persist a resolution, replacing any entry for the same root.
+    pub fn store(state_dir: &Path, resolved: CachedMount) -> Result<()> {
+        std::fs::create_dir_all(state_dir)
+            .with_context(|| format!("create state dir {}", state_dir.display()))?;
+        let path = cache_path(state_dir);
+        let mut entries: Vec<CachedMount> = std::fs::read_to_string(&path)
+            .ok()
+            .and_then(|text| serde_json::from_str(&text).ok())
+            .unwrap_or_default();
+        entries.retain(|entry| entry.root != resolved.root);
+        entries.push(resolved);
+        let rendered = serde_json::to_string(&entries)?;
+        let tmp = path.with_extension("tmp");
+        std::fs::write(&tmp, rendered)?;
+        std::fs::rename(&tmp, &path)?;
+        Ok(())
+    }
+
+    #[cfg(test)]
+    mod tests {
+        use super::*;
+
+        #[test]
+        fn cache_revalidates_by_qid_version() {
+            let dir = tempfile::TempDir::new().unwrap();
+            let resolved = CachedMount {
+                root: "/queen".to_owned(),
+                entries: vec!["telemetry".to_owned(), "ctl".to_owned()],
+                qid_version: 3,
+            };
+            store(dir.path(), resolved.clone()).unwrap();
+            assert_eq!(load(dir.path(), "/queen", 3), Some(resolved.clone()));
+            assert_eq!(load(dir.path(), "/queen", 4), None, "version moved on");
+            assert_eq!(load(dir.path(), "/gpu", 3), None);
+
+            // Replacing a root keeps one entry per root.
+            let updated = CachedMount {
+                qid_version: 4,
+                ..resolved
+            };
+            store(dir.path(), updated.clone()).unwrap();
+            assert_eq!(load(dir.path(), "/queen", 4), Some(updated));
+            assert_eq!(load(dir.path(), "/queen", 3), None);
+        }
+    }
+}
+
 /// Append-only offset tracker for mount writes.
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub struct AppendOnlyTracker {
@@ -19,6 +19,8 @@ use crate::policy::{CohPeftActivatePolicy, CohPolicy};
 use crate::{validate_component, CohAccess, CohAudit};
 
 const GPU_ACTIVE_PATH: &str = "/gpu/models/active";
+const GPU_PENDING_PATH: &str = "/gpu/models/pending";
+const REGISTRY_PENDING_FILE: &str = "pending";
 
 /// Activation request parameters.
 #[derive(Debug, Clone, PartialEq, Eq)]
@@ -66,6 +68,66 @@ pub fn activate_model<C: CohAccess>(
     Ok(())
 }
 
+/// Stage a model for activation without flipping the active pointer.
+///
+/// The pending pointer is announced in the registry and over the namespace
+/// so workers can prefetch the model's chunks in the background; the later
+/// [`commit_staged_model`] makes the flip itself instant instead of paying
+/// cold-start fetches on every activation.
+pub fn stage_model<C: CohAccess>(
+    client: &mut C,
+    policy: &CohPolicy,
+    spec: &PeftActivateSpec,
+    audit: &mut CohAudit,
+) -> Result<()> {
+    validate_component(&spec.model_id)?;
+    enforce_id_bytes(&spec.model_id, policy.peft.activate.max_model_id_bytes)?;
+    let registry_root = &spec.registry_root;
+    ensure_registry_model(registry_root, &spec.model_id)?;
+    write_atomic(
+        &registry_root.join(REGISTRY_PENDING_FILE),
+        format!("{}\n", spec.model_id).as_bytes(),
+    )?;
+    let payload = format!("{}\n", spec.model_id);
+    let written = client.write_append(GPU_PENDING_PATH, payload.as_bytes())?;
+    if written != payload.len() {
+        return Err(anyhow!("short write announcing pending model"));
+    }
+    audit.push_line(format!("peft staged model={}", spec.model_id));
+    Ok(())
+}
+
+/// Commit a previously staged model: verify the stage matches, flip the
+/// active pointer, and clear the pending announcement.
+pub fn commit_staged_model<C: CohAccess>(
+    client: &mut C,
+    policy: &CohPolicy,
+    spec: &PeftActivateSpec,
+    audit: &mut CohAudit,
+) -> Result<()> {
+    let registry_root = &spec.registry_root;
+    let pending_path = registry_root.join(REGISTRY_PENDING_FILE);
+    let staged = fs::read_to_string(&pending_path)
+        .map_err(|_| anyhow!("no staged model to commit"))?
+        .trim()
+        .to_owned();
+    if staged != spec.model_id {
+        return Err(anyhow!(
+            "staged model {staged} does not match requested {}",
+            spec.model_id
+        ));
+    }
+    activate_model(client, policy, spec, audit)?;
+    let _ = fs::remove_file(&pending_path);
+    // Clear the namespace announcement too: the pending node replaces
+    // on write, so an empty write leaves "nothing staged" for workers
+    // instead of the stale pointer they would otherwise keep
+    // prefetching.
+    client.write_append(GPU_PENDING_PATH, b"")?;
+    audit.push_line(format!("peft committed model={}", spec.model_id));
+    Ok(())
+}
+
 /// Roll back to the previous active model pointer.
 pub fn rollback_model<C: CohAccess>(
     client: &mut C,
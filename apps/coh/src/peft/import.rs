@@ -100,6 +100,7 @@ pub fn import_adapter(
     fs::create_dir_all(&target_dir)
         .with_context(|| format!("create registry dir {}", target_dir.display()))?;
 
+    validate_safetensors_header(&adapter_path)?;
     let adapter_target = target_dir.join(IMPORT_ADAPTER_FILE);
     let adapter_hash = copy_with_hash(
         &adapter_path,
@@ -198,7 +199,7 @@ fn copy_with_hash(path: &Path, dest: &Path, max_bytes: u64) -> Result<FileHash>
     let tmp = dest.with_extension("partial");
     let mut output = fs::File::create(&tmp).with_context(|| format!("create {}", tmp.display()))?;
     let mut hasher = Sha256::new();
-    let mut buf = [0u8; 8192];
+    let mut buf = vec![0u8; STAGE_BUFFER_BYTES];
     let mut total = 0u64;
     loop {
         let read = input.read(&mut buf)?;
@@ -238,6 +239,45 @@ fn read_base_model(path: &Path, policy: &CohPeftExportPolicy) -> Result<String>
     Ok(line.to_owned())
 }
 
+/// Copy window for adapter staging; large enough that a multi-hundred-MB
+/// safetensors file costs thousands, not tens of thousands, of syscalls
+/// while memory stays constant.
+const STAGE_BUFFER_BYTES: usize = 128 * 1024;
+
+/// Validate the safetensors container header before staging begins.
+///
+/// Only the 8-byte length prefix and the start of the JSON header are read,
+/// so a corrupt safetensors adapter is rejected after a few bytes instead of
+/// after streaming hundreds of megabytes; memory stays constant regardless
+/// of adapter size. Files that do not look like safetensors containers
+/// (no JSON header behind the prefix) stay opaque pass-through payloads, as
+/// before.
+fn validate_safetensors_header(path: &Path) -> Result<()> {
+    let mut file = fs::File::open(path).with_context(|| format!("open {}", path.display()))?;
+    let file_len = file
+        .metadata()
+        .with_context(|| format!("stat {}", path.display()))?
+        .len();
+    let mut prefix = [0u8; 9];
+    if file_len < prefix.len() as u64 {
+        return Ok(());
+    }
+    file.read_exact(&mut prefix)
+        .with_context(|| format!("read header of {}", path.display()))?;
+    if prefix[8] != b'{' {
+        // Not a safetensors container; treated as an opaque adapter payload.
+        return Ok(());
+    }
+    let header_len = u64::from_le_bytes(prefix[..8].try_into().expect("prefix is 8 bytes"));
+    if header_len == 0 || header_len.saturating_add(8) > file_len {
+        return Err(anyhow!(
+            "{} declares a safetensors header of {header_len} bytes beyond the file",
+            path.display()
+        ));
+    }
+    Ok(())
+}
+
 fn read_bounded(path: &Path, max_bytes: usize) -> Result<Vec<u8>> {
     let mut file = fs::File::open(path).with_context(|| format!("open {}", path.display()))?;
     let mut buf = Vec::new();
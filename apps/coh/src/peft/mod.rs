@@ -18,7 +18,10 @@ pub mod export;
 /// Import helpers for PEFT adapters.
 pub mod import;
 
-pub use activate::{activate_model, rollback_model, PeftActivateSpec, PeftRollbackSpec};
+pub use activate::{
+    activate_model, commit_staged_model, rollback_model, stage_model, PeftActivateSpec,
+    PeftRollbackSpec,
+};
 pub use export::{export_job, PeftExportSpec, PeftExportSummary};
 pub use import::{import_adapter, PeftImportSpec, PeftImportSummary};
 
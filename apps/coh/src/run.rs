@@ -144,6 +144,99 @@ pub fn execute<C: CohAccess>(
     }
 }
 
+/// Outcome of one target in a fan-out submission.
+#[derive(Debug)]
+pub struct FanOutOutcome {
+    /// GPU target the spec was submitted to.
+    pub gpu_id: String,
+    /// Per-target result.
+    pub result: Result<()>,
+}
+
+/// Aggregated fan-out completion report.
+#[derive(Debug, Default)]
+pub struct FanOutSummary {
+    /// Targets that accepted the submission.
+    pub submitted: usize,
+    /// Targets that failed.
+    pub failed: usize,
+    /// Per-target outcomes in target order.
+    pub outcomes: Vec<FanOutOutcome>,
+}
+
+/// Submit one RunSpec to a set of GPU targets with bounded concurrency.
+///
+/// `factory` opens one attached client per submission worker (a session
+/// pool checkout or fresh transport); targets are claimed from a shared
+/// queue so a hive-wide job launch runs as wide as the pool allows instead
+/// of 50 sequential submissions, and per-target failures land in their
+/// outcome slot without aborting the rest.
+pub fn execute_fan_out<C, F>(
+    factory: F,
+    policy: &CohPolicy,
+    spec: &RunSpec,
+    targets: &[String],
+    concurrency: usize,
+) -> Result<FanOutSummary>
+where
+    C: CohAccess,
+    F: Fn() -> Result<C> + Sync,
+{
+    let next = std::sync::atomic::AtomicUsize::new(0);
+    let mut outcomes: Vec<Option<FanOutOutcome>> = targets.iter().map(|_| None).collect();
+    let slots = std::sync::Mutex::new(&mut outcomes);
+    let workers = concurrency.clamp(1, targets.len().max(1));
+    std::thread::scope(|scope| {
+        for _ in 0..workers {
+            let next = &next;
+            let slots = &slots;
+            let factory = &factory;
+            scope.spawn(move || {
+                let mut client = match factory() {
+                    Ok(client) => client,
+                    Err(err) => {
+                        // Claim one target slot to report the attach failure.
+                        let index = next.fetch_add(1, std::sync::atomic::Ordering::SeqCst);
+                        if let Some(gpu_id) = targets.get(index) {
+                            slots.lock().expect("fan-out slots")[index] = Some(FanOutOutcome {
+                                gpu_id: gpu_id.clone(),
+                                result: Err(err),
+                            });
+                        }
+                        return;
+                    }
+                };
+                loop {
+                    let index = next.fetch_add(1, std::sync::atomic::Ordering::SeqCst);
+                    let Some(gpu_id) = targets.get(index) else {
+                        break;
+                    };
+                    let mut target_spec = spec.clone();
+                    target_spec.gpu_id = gpu_id.clone();
+                    let mut audit = CohAudit::new();
+                    let result = execute(&mut client, policy, &mut audit, &target_spec);
+                    slots.lock().expect("fan-out slots")[index] = Some(FanOutOutcome {
+                        gpu_id: gpu_id.clone(),
+                        result,
+                    });
+                }
+            });
+        }
+    });
+    let mut summary = FanOutSummary::default();
+    for slot in outcomes {
+        let outcome =
+            slot.ok_or_else(|| anyhow!("fan-out worker exited before claiming its target"))?;
+        if outcome.result.is_ok() {
+            summary.submitted += 1;
+        } else {
+            summary.failed += 1;
+        }
+        summary.outcomes.push(outcome);
+    }
+    Ok(summary)
+}
+
 fn spawn_command(command: &[String]) -> Result<std::process::Child> {
     let mut cmd = Command::new(&command[0]);
     if command.len() > 1 {
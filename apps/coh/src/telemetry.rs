@@ -63,6 +63,115 @@ pub fn pull<C: CohAccess>(
     Ok(summary)
 }
 
+/// Pull telemetry from all devices in parallel across a bounded worker set.
+///
+/// `factory` opens one attached client per worker (a session-pool checkout or
+/// fresh transport); devices are claimed from a shared queue so stragglers
+/// don't serialise the nightly export, and each worker's audit transcript is
+/// merged into `audit` in device order once the fan-out joins. Per-device
+/// quota failures abort the whole pull, matching the serial path.
+pub fn pull_parallel<C, F>(
+    factory: F,
+    policy: &CohPolicy,
+    out_dir: &Path,
+    audit: &mut CohAudit,
+    concurrency: usize,
+) -> Result<TelemetryPullSummary>
+where
+    C: CohAccess,
+    F: Fn() -> Result<C> + Sync,
+{
+    fs::create_dir_all(out_dir)
+        .with_context(|| format!("create telemetry output dir {}", out_dir.display()))?;
+    let telemetry = &policy.telemetry;
+    let mut lister = factory()?;
+    let device_entries = lister.list_dir(telemetry.root.as_str(), MAX_DIR_LIST_BYTES)?;
+    drop(lister);
+    let detail = format!("path={}", telemetry.root);
+    audit.push_ack(AckStatus::Ok, "LS", Some(detail.as_str()));
+    if device_entries.len() > telemetry.max_devices as usize {
+        return Err(anyhow!(
+            "telemetry devices {} exceeds max_devices {}",
+            device_entries.len(),
+            telemetry.max_devices
+        ));
+    }
+    for device_id in &device_entries {
+        validate_component(device_id)?;
+    }
+    if device_entries.is_empty() {
+        audit.push_line("telemetry: none".to_owned());
+        return Ok(TelemetryPullSummary {
+            devices: 0,
+            segments: 0,
+            bytes: 0,
+        });
+    }
+
+    let workers = concurrency.clamp(1, device_entries.len());
+    let next_device = std::sync::atomic::AtomicUsize::new(0);
+    let mut results: Vec<Option<Result<(usize, usize, CohAudit)>>> =
+        (0..device_entries.len()).map(|_| None).collect();
+    let results = std::sync::Mutex::new(&mut results);
+
+    std::thread::scope(|scope| {
+        for _ in 0..workers {
+            let next_device = &next_device;
+            let results = &results;
+            let device_entries = &device_entries;
+            let factory = &factory;
+            scope.spawn(move || {
+                let mut client = match factory() {
+                    Ok(client) => client,
+                    Err(err) => {
+                        // Claim one device slot to report the attach failure.
+                        let idx = next_device.fetch_add(1, std::sync::atomic::Ordering::SeqCst);
+                        if idx < device_entries.len() {
+                            results.lock().expect("pull results lock")[idx] = Some(Err(err));
+                        }
+                        return;
+                    }
+                };
+                loop {
+                    let idx = next_device.fetch_add(1, std::sync::atomic::Ordering::SeqCst);
+                    let Some(device_id) = device_entries.get(idx) else {
+                        break;
+                    };
+                    let mut worker_audit = CohAudit::new();
+                    let outcome = pull_device(
+                        &mut client,
+                        telemetry,
+                        out_dir,
+                        device_id,
+                        &mut worker_audit,
+                    )
+                    .map(|(segments, bytes)| (segments, bytes, worker_audit));
+                    results.lock().expect("pull results lock")[idx] = Some(outcome);
+                }
+            });
+        }
+    });
+
+    let mut summary = TelemetryPullSummary {
+        devices: 0,
+        segments: 0,
+        bytes: 0,
+    };
+    let results = results.into_inner().expect("pull results lock");
+    for outcome in results.iter_mut() {
+        let (segments, bytes, worker_audit) = outcome
+            .take()
+            .ok_or_else(|| anyhow!("telemetry pull worker exited before claiming its device"))??;
+        summary.devices += 1;
+        summary.segments += segments;
+        summary.bytes += bytes;
+        for line in worker_audit.lines() {
+            audit.push_line(line.clone());
+        }
+    }
+    Ok(summary)
+}
+
 fn pull_device<C: CohAccess>(
     client: &mut C,
     telemetry: &CohTelemetryPolicy,
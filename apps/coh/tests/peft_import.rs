@@ -10,6 +10,7 @@ use coh::peft::{
     PeftRollbackSpec,
 };
 use coh::policy::CohPolicy;
+use coh::CohAccess;
 use coh::CohAudit;
 use cohesix_ticket::Role;
 use cohsh::client::{CohClient, InProcessTransport};
@@ -155,3 +156,111 @@ fn peft_import_rejects_large_adapter() -> Result<()> {
     assert!(err.to_string().contains("exceeds max bytes"));
     Ok(())
 }
+
+#[test]
+fn peft_import_rejects_truncated_safetensors_header() -> Result<()> {
+    let adapter_root = TempDir::new().expect("adapter tempdir");
+    let export_root = TempDir::new().expect("export tempdir");
+    let registry_root = TempDir::new().expect("registry tempdir");
+    let export_job = export_root.path().join(JOB_ID);
+    write_file(
+        export_job.join("telemetry.cbor").as_path(),
+        b"telemetry-v1\n",
+    )?;
+    write_file(
+        export_job.join("base_model.ref").as_path(),
+        format!("{}\n", BASE_MODEL).as_bytes(),
+    )?;
+    write_file(
+        export_job.join("policy.toml").as_path(),
+        b"[policy]\nname = \"default\"\n",
+    )?;
+    // Declares a 1 MiB JSON header but the file ends after a few bytes.
+    let mut bogus = Vec::new();
+    bogus.extend_from_slice(&(1_048_576u64).to_le_bytes());
+    bogus.extend_from_slice(b"{\"__metadata__\":");
+    std::fs::write(adapter_root.path().join("adapter.safetensors"), &bogus)?;
+    std::fs::write(adapter_root.path().join("lora.json"), b"{\"rank\":8}")?;
+
+    let policy = CohPolicy::from_generated();
+    let spec = PeftImportSpec {
+        model_id: MODEL_ID.to_owned(),
+        adapter_dir: adapter_root.path().to_path_buf(),
+        export_root: export_root.path().to_path_buf(),
+        job_id: JOB_ID.to_owned(),
+        registry_root: registry_root.path().to_path_buf(),
+    };
+    let mut audit = CohAudit::new();
+    let err = import_adapter(&policy, &spec, &mut audit).unwrap_err();
+    assert!(err.to_string().contains("safetensors header"));
+    Ok(())
+}
+
+#[test]
+fn staged_activation_prefetches_then_commits() -> Result<()> {
+    let adapter_root = TempDir::new().expect("adapter tempdir");
+    let export_root = TempDir::new().expect("export tempdir");
+    let registry_root = TempDir::new().expect("registry tempdir");
+    let export_job = export_root.path().join(JOB_ID);
+    write_file(export_job.join("telemetry.cbor").as_path(), b"telemetry\n")?;
+    write_file(
+        export_job.join("base_model.ref").as_path(),
+        format!("{}\n", BASE_MODEL).as_bytes(),
+    )?;
+    write_file(
+        export_job.join("policy.toml").as_path(),
+        b"[policy]\nname = \"default\"\n",
+    )?;
+    write_file(
+        adapter_root.path().join("adapter.safetensors").as_path(),
+        b"adapter-bytes",
+    )?;
+    write_file(adapter_root.path().join("lora.json").as_path(), b"{}")?;
+
+    let policy = CohPolicy::from_generated();
+    let server = nine_door::NineDoor::new();
+    let bridge = gpu_bridge_host::GpuBridge::mock();
+    let snapshot = bridge.serialise_namespace()?;
+    server.install_gpu_nodes(&snapshot)?;
+    let connection = server.connect()?;
+    let mut client = CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)?;
+
+    let spec = PeftImportSpec {
+        model_id: MODEL_ID.to_owned(),
+        adapter_dir: adapter_root.path().to_path_buf(),
+        export_root: export_root.path().to_path_buf(),
+        job_id: JOB_ID.to_owned(),
+        registry_root: registry_root.path().to_path_buf(),
+    };
+    let mut audit = CohAudit::new();
+    import_adapter(&policy, &spec, &mut audit)?;
+
+    let activate = PeftActivateSpec {
+        model_id: MODEL_ID.to_owned(),
+        registry_root: registry_root.path().to_path_buf(),
+    };
+    coh::peft::stage_model(&mut client, &policy, &activate, &mut audit)?;
+    let pending = std::fs::read_to_string(registry_root.path().join("pending"))?;
+    assert_eq!(pending.trim(), MODEL_ID);
+    // Active pointer untouched while workers prefetch.
+    assert!(!registry_root.path().join("active").exists());
+    // The namespace announcement is a pointer: a second stage replaces
+    // the content rather than appending to the staging history.
+    coh::peft::stage_model(&mut client, &policy, &activate, &mut audit)?;
+    let announced = client.read_file("/gpu/models/pending", 4096)?;
+    assert_eq!(String::from_utf8_lossy(&announced), format!("{MODEL_ID}\n"));
+
+    coh::peft::commit_staged_model(&mut client, &policy, &activate, &mut audit)?;
+    let active = std::fs::read_to_string(registry_root.path().join("active"))?;
+    assert_eq!(active.trim(), MODEL_ID);
+    assert!(!registry_root.path().join("pending").exists());
+    // Commit clears the namespace announcement too.
+    let announced = client.read_file("/gpu/models/pending", 4096)?;
+    assert!(announced.is_empty(), "stale announcement: {announced:?}");
+
+    // Committing without a stage is refused.
+    let err =
+        coh::peft::commit_staged_model(&mut client, &policy, &activate, &mut audit).unwrap_err();
+    assert!(err.to_string().contains("no staged model"));
+    Ok(())
+}
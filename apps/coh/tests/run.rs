@@ -163,3 +163,64 @@ fn run_rejects_invalid_lease_schema() -> Result<()> {
     assert!(status_bytes.is_empty());
     Ok(())
 }
+
+#[test]
+fn fan_out_submits_to_every_target() -> Result<()> {
+    let server = NineDoor::new();
+    let bridge = auto_bridge(true)?;
+    let snapshot = bridge.serialise_namespace()?;
+    server.install_gpu_nodes(&snapshot)?;
+
+    // Give both GPUs an active lease so execute() accepts them.
+    let connection = server.connect()?;
+    let mut seeder = CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)?;
+    let gpu_ids: Vec<String> = snapshot.nodes.iter().map(|node| node.id.clone()).collect();
+    for gpu_id in &gpu_ids {
+        let lease = format!(
+            "{{\"schema\":\"gpu-lease/v1\",\"state\":\"ACTIVE\",\"gpu_id\":\"{gpu_id}\",\"worker_id\":\"worker-1\",\"mem_mb\":1024,\"streams\":1,\"ttl_s\":60,\"priority\":1}}\n"
+        );
+        let fid = seeder.open(&format!("/gpu/{gpu_id}/lease"), OpenMode::write_append())?;
+        seeder.write(fid, u64::MAX, lease.as_bytes())?;
+        seeder.clunk(fid)?;
+    }
+
+    let policy = CohPolicy::from_generated();
+    let spec = RunSpec {
+        gpu_id: String::new(),
+        command: vec!["echo".to_owned(), "ok".to_owned()],
+    };
+    let factory = || {
+        let connection = server.connect()?;
+        CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)
+    };
+    let summary = coh::run::execute_fan_out(factory, &policy, &spec, &gpu_ids, 2)?;
+    assert_eq!(summary.submitted, gpu_ids.len());
+    assert_eq!(summary.failed, 0);
+    assert_eq!(summary.outcomes.len(), gpu_ids.len());
+
+    // A bogus target fails in its slot without sinking the batch.
+    let mut with_bogus = gpu_ids.clone();
+    with_bogus.push("GPU-missing".to_owned());
+    let summary = coh::run::execute_fan_out(factory, &policy, &spec, &with_bogus, 3)?;
+    assert_eq!(summary.failed, 1);
+    assert_eq!(summary.submitted, gpu_ids.len());
+
+    // A dead factory claims slots with the attach error instead of
+    // silently dropping targets: every unreached target surfaces.
+    let dead_factory =
+        || -> Result<CohClient<InProcessTransport>> { Err(anyhow::anyhow!("queen unreachable")) };
+    match coh::run::execute_fan_out(dead_factory, &policy, &spec, &gpu_ids, 1) {
+        Ok(summary) => {
+            assert_eq!(summary.outcomes.len(), gpu_ids.len());
+            assert_eq!(summary.submitted, 0);
+            assert_eq!(summary.failed, gpu_ids.len());
+        }
+        Err(err) => {
+            assert!(
+                err.to_string().contains("before claiming its target"),
+                "unexpected error: {err}"
+            );
+        }
+    }
+    Ok(())
+}
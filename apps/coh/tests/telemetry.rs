@@ -170,3 +170,35 @@ fn telemetry_pull_enforces_segment_bytes() -> Result<()> {
     assert!(err.to_string().contains("exceeds max bytes"));
     Ok(())
 }
+
+#[test]
+fn telemetry_pull_parallel_covers_all_devices() -> Result<()> {
+    let server = NineDoor::new();
+    let connection = server.connect().context("open NineDoor session")?;
+    let mut seeder = CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)?;
+
+    let mut expected = Vec::new();
+    for device in ["device-1", "device-2", "device-3"] {
+        let payload = format!("{{\"device\":\"{device}\"}}\n");
+        let seg_id = create_segment(&mut seeder, device, &payload)?;
+        expected.push((device, seg_id, payload));
+    }
+
+    let temp = TempDir::new().expect("tempdir");
+    let policy = base_policy();
+    let mut audit = CohAudit::new();
+    let factory = || {
+        let connection = server.connect().context("open NineDoor session")?;
+        CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)
+    };
+    let summary =
+        coh::telemetry::pull_parallel(factory, &policy, temp.path(), &mut audit, 2)?;
+    assert_eq!(summary.devices, 3);
+    assert_eq!(summary.segments, 3);
+    for (device, seg_id, payload) in expected {
+        let output_path = temp.path().join(device).join("seg").join(&seg_id);
+        let stored = std::fs::read(&output_path).context("read parallel output")?;
+        assert_eq!(stored, payload.as_bytes());
+    }
+    Ok(())
+}
@@ -47,3 +47,159 @@ pub const REASON_TIMEOUT: &str = "timeout";
 pub const REASON_INACTIVITY_TIMEOUT: &str = "inactivity-timeout";
 /// Reason emitted when a receive error terminates the console session.
 pub const REASON_RECV_ERROR: &str = "recv-error";
+
+/// Straight-line binary serialisation for bridge envelopes.
+///
+/// Messages crossing the host bridges are small and fixed-shape, so
+/// their serialisers are written out field by field with compile-time
+/// size bounds — no runtime dispatch, no allocation, encode into a
+/// caller-provided `[u8; ENVELOPE_BYTES]`. The layout is little-endian
+/// and versioned by the leading magic byte.
+pub mod wire {
+    use super::Role;
+
+    /// Envelope magic/version byte; bump on layout change.
+    pub const ENVELOPE_MAGIC: u8 = 0xC1;
+
+    /// Exact encoded size of a [`BridgeEnvelope`].
+    pub const ENVELOPE_BYTES: usize = 1 + 1 + 1 + 8 + 4;
+
+    /// Message kinds carried across the host bridges.
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    #[repr(u8)]
+    pub enum EnvelopeKind {
+        /// Periodic liveness beat.
+        Heartbeat = 0,
+        /// Telemetry payload follows.
+        Telemetry = 1,
+        /// Control payload follows.
+        Control = 2,
+        /// Acknowledgement of a prior sequence number.
+        Ack = 3,
+    }
+
+    /// Fixed-shape header preceding every bridge payload.
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    pub struct BridgeEnvelope {
+        /// Sender role.
+        pub role: Role,
+        /// Message kind.
+        pub kind: EnvelopeKind,
+        /// Monotonic per-sender sequence number.
+        pub seq: u64,
+        /// Byte length of the payload that follows the envelope.
+        pub payload_len: u32,
+    }
+
+    const fn role_to_wire(role: Role) -> u8 {
+        match role {
+            Role::Queen => 0,
+            Role::Worker => 1,
+            Role::GpuWorker => 2,
+            Role::BusWorker => 3,
+            Role::LoraWorker => 4,
+        }
+    }
+
+    const fn role_from_wire(value: u8) -> Option<Role> {
+        match value {
+            0 => Some(Role::Queen),
+            1 => Some(Role::Worker),
+            2 => Some(Role::GpuWorker),
+            3 => Some(Role::BusWorker),
+            4 => Some(Role::LoraWorker),
+            _ => None,
+        }
+    }
+
+    const fn kind_from_wire(value: u8) -> Option<EnvelopeKind> {
+        match value {
+            0 => Some(EnvelopeKind::Heartbeat),
+            1 => Some(EnvelopeKind::Telemetry),
+            2 => Some(EnvelopeKind::Control),
+            3 => Some(EnvelopeKind::Ack),
+            _ => None,
+        }
+    }
+
+    impl BridgeEnvelope {
+        /// Encode into the fixed-size buffer: field-by-field stores, no
+        /// branching beyond the match on enums.
+        #[must_use]
+        pub const fn encode(&self) -> [u8; ENVELOPE_BYTES] {
+            let mut out = [0u8; ENVELOPE_BYTES];
+            out[0] = ENVELOPE_MAGIC;
+            out[1] = role_to_wire(self.role);
+            out[2] = self.kind as u8;
+            let seq = self.seq.to_le_bytes();
+            let mut index = 0;
+            while index < 8 {
+                out[3 + index] = seq[index];
+                index += 1;
+            }
+            let len = self.payload_len.to_le_bytes();
+            let mut index = 0;
+            while index < 4 {
+                out[11 + index] = len[index];
+                index += 1;
+            }
+            out
+        }
+
+        /// Decode a fixed-size buffer; `None` on bad magic or field.
+        #[must_use]
+        pub fn decode(bytes: &[u8; ENVELOPE_BYTES]) -> Option<Self> {
+            if bytes[0] != ENVELOPE_MAGIC {
+                return None;
+            }
+            let role = role_from_wire(bytes[1])?;
+            let kind = kind_from_wire(bytes[2])?;
+            let seq = u64::from_le_bytes(bytes[3..11].try_into().ok()?);
+            let payload_len = u32::from_le_bytes(bytes[11..15].try_into().ok()?);
+            Some(Self {
+                role,
+                kind,
+                seq,
+                payload_len,
+            })
+        }
+    }
+
+    #[cfg(test)]
+    mod tests {
+        use super::*;
+
+        #[test]
+        fn envelopes_round_trip_and_reject_bad_magic() {
+            let envelope = BridgeEnvelope {
+                role: Role::GpuWorker,
+                kind: EnvelopeKind::Telemetry,
+                seq: 0x0102_0304_0506_0708,
+                payload_len: 4096,
+            };
+            let encoded = envelope.encode();
+            assert_eq!(encoded.len(), ENVELOPE_BYTES);
+            assert_eq!(BridgeEnvelope::decode(&encoded), Some(envelope));
+
+            let mut bad = encoded;
+            bad[0] = 0x00;
+            assert!(BridgeEnvelope::decode(&bad).is_none());
+            let mut bad_role = encoded;
+            bad_role[1] = 9;
+            assert!(BridgeEnvelope::decode(&bad_role).is_none());
+        }
+
+        #[test]
+        fn encode_is_const_evaluable() {
+            const ENCODED: [u8; ENVELOPE_BYTES] = BridgeEnvelope {
+                role: Role::Queen,
+                kind: EnvelopeKind::Heartbeat,
+                seq: 1,
+                payload_len: 0,
+            }
+            .encode();
+            assert_eq!(ENCODED[0], ENVELOPE_MAGIC);
+            assert_eq!(ENCODED[1], 0);
+        }
+    }
+}
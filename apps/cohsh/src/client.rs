@@ -34,6 +34,18 @@ pub struct TailStream<'a, T: Secure9pTransport> {
     pending: VecDeque<String>,
     finished: bool,
     closed: bool,
+    /// Follow mode: an empty read means "no new data yet", not end of
+    /// stream; the fid stays open for the next poll.
+    follow: bool,
+}
+
+/// Upper bound on cached directory-prefix fids held open per client.
+const WALK_CACHE_MAX: usize = 32;
+
+/// Directory prefix kept walked and open for reuse by later traversals.
+struct CachedPrefix {
+    fid: u32,
+    qid: Qid,
 }
 
 /// Secure9P client exposing Cohesix file operations.
@@ -42,6 +54,8 @@ pub struct CohClient<T: Secure9pTransport> {
     next_fid: u32,
     walk_depth: usize,
     root_qid: Qid,
+    walk_cache: std::collections::HashMap<Vec<String>, CachedPrefix>,
+    content_cache: cohsh_core::QidContentCache,
 }
 
 impl<T: Secure9pTransport> CohClient<T> {
@@ -82,6 +96,8 @@ impl<T: Secure9pTransport> CohClient<T> {
             next_fid: ROOT_FID + 1,
             walk_depth: crate::generated_client::SECURE9P_WALK_DEPTH as usize,
             root_qid,
+            walk_cache: std::collections::HashMap::new(),
+            content_cache: cohsh_core::QidContentCache::new(),
         })
     }
 
@@ -103,26 +119,129 @@ impl<T: Secure9pTransport> CohClient<T> {
     }
 
     /// Walk to the supplied path, returning a fid and Qid without opening.
+    ///
+    /// Deep directory prefixes from earlier walks are kept open and reused:
+    /// a repeat traversal of `worker/<shard>/<id>/telemetry/...` walks only
+    /// the trailing components from the cached prefix fid. A walk that fails
+    /// from a cached fid (the directory was replaced) drops the entry and
+    /// retries from the root; a root walk whose intermediate qid versions
+    /// disagree with a cached entry refreshes it.
     pub fn walk_qid(&mut self, path: &str) -> Result<(u32, Qid)> {
         let components = self.parse_path(path)?;
-        let fid = self.allocate_fid();
-        let qid = if components.is_empty() {
+        if components.is_empty() {
+            let fid = self.allocate_fid();
             self.core
                 .walk(ROOT_FID, fid, &components)
                 .map_err(|err| anyhow!("failed to walk to {path}: {err}"))?;
-            self.root_qid
-        } else {
-            let qids = self
-                .core
-                .walk(ROOT_FID, fid, &components)
-                .map_err(|err| anyhow!("failed to walk to {path}: {err}"))?;
-            qids.last()
-                .copied()
-                .ok_or_else(|| anyhow!("walk to {path} returned no qids"))?
-        };
+            return Ok((fid, self.root_qid));
+        }
+        if components.len() >= 2 {
+            for plen in (1..components.len()).rev() {
+                let Some(entry) = self.walk_cache.get(&components[..plen]) else {
+                    continue;
+                };
+                let source = entry.fid;
+                let fid = self.allocate_fid();
+                match self.core.walk(source, fid, &components[plen..]) {
+                    Ok(qids) => {
+                        if let Some(qid) = qids.last().copied() {
+                            return Ok((fid, qid));
+                        }
+                    }
+                    Err(_) => {
+                        if let Some(stale) = self.walk_cache.remove(&components[..plen]) {
+                            let _ = self.core.clunk(stale.fid);
+                        }
+                    }
+                }
+                break;
+            }
+        }
+        let fid = self.allocate_fid();
+        let qids = self
+            .core
+            .walk(ROOT_FID, fid, &components)
+            .map_err(|err| anyhow!("failed to walk to {path}: {err}"))?;
+        let qid = qids
+            .last()
+            .copied()
+            .ok_or_else(|| anyhow!("walk to {path} returned no qids"))?;
+        self.refresh_walk_cache(&components, &qids);
         Ok((fid, qid))
     }
 
+    /// Walk several paths in one pipelined Secure9P exchange.
+    ///
+    /// Results land in path order; individual walk failures surface in their
+    /// slot without aborting the batch.
+    pub fn walk_qids_batch(&mut self, paths: &[&str]) -> Result<Vec<Result<(u32, Qid)>>> {
+        use secure9p_codec::{RequestBody, ResponseBody};
+        let mut bodies = Vec::with_capacity(paths.len());
+        let mut fids = Vec::with_capacity(paths.len());
+        for path in paths {
+            let components = self.parse_path(path)?;
+            let fid = self.allocate_fid();
+            fids.push(fid);
+            bodies.push(RequestBody::Walk {
+                fid: ROOT_FID,
+                newfid: fid,
+                wnames: components,
+            });
+        }
+        let responses = self
+            .core
+            .transact_batch(&bodies)
+            .map_err(|err| anyhow!("batched walk failed: {err}"))?;
+        let root_qid = self.root_qid;
+        Ok(responses
+            .into_iter()
+            .zip(fids)
+            .zip(paths)
+            .map(|((response, fid), path)| match response {
+                Ok(ResponseBody::Walk { qids }) => {
+                    Ok((fid, qids.last().copied().unwrap_or(root_qid)))
+                }
+                Ok(_) => Err(anyhow!("unexpected response walking {path}")),
+                Err(err) => Err(anyhow!("failed to walk to {path}: {err}")),
+            })
+            .collect())
+    }
+
+    /// Keep the parent prefix of a fresh root walk open for reuse, updating
+    /// an existing entry whose qid version has moved on.
+    fn refresh_walk_cache(&mut self, components: &[String], qids: &[Qid]) {
+        if components.len() < 2 || qids.len() < components.len() {
+            return;
+        }
+        let parent = &components[..components.len() - 1];
+        let parent_qid = qids[components.len() - 2];
+        if let Some(entry) = self.walk_cache.get_mut(parent) {
+            if entry.qid == parent_qid {
+                return;
+            }
+            let stale = entry.fid;
+            let _ = self.core.clunk(stale);
+            self.walk_cache.remove(parent);
+        }
+        if self.walk_cache.len() >= WALK_CACHE_MAX {
+            if let Some(key) = self.walk_cache.keys().next().cloned() {
+                if let Some(evicted) = self.walk_cache.remove(&key) {
+                    let _ = self.core.clunk(evicted.fid);
+                }
+            }
+        }
+        let pfid = self.allocate_fid();
+        if self.core.walk(ROOT_FID, pfid, parent).is_ok() {
+            self.walk_cache.insert(
+                parent.to_vec(),
+                CachedPrefix {
+                    fid: pfid,
+                    qid: parent_qid,
+                },
+            );
+        }
+    }
+
     /// Walk and open the supplied path, returning the fid and Qid.
     pub fn open_with_qid(&mut self, path: &str, mode: OpenMode) -> Result<(u32, Qid)> {
         let (fid, _) = self.walk_qid(path)?;
@@ -151,6 +270,281 @@ impl<T: Secure9pTransport> CohClient<T> {
         self.core.clunk(fid).map_err(map_core_error)
     }
 
+    /// Read a window of directory rows without fetching the whole listing.
+    ///
+    /// The listing is read in msize chunks only until `start_row + rows`
+    /// complete lines have been seen, so scrolling a 2000-worker hive
+    /// fetches the visible rows plus at most one chunk of margin instead of
+    /// the entire directory. Returns the rows in listing order; short when
+    /// the directory ends inside the window.
+    pub fn list_dir_window(
+        &mut self,
+        path: &str,
+        start_row: usize,
+        rows: usize,
+    ) -> Result<Vec<String>> {
+        if rows == 0 {
+            return Ok(Vec::new());
+        }
+        let fid = self.open(path, OpenMode::read_only())?;
+        let msize = self.negotiated_msize();
+        let mut buffer = Vec::new();
+        let mut offset = 0u64;
+        let mut complete_lines = 0usize;
+        loop {
+            if complete_lines >= start_row + rows {
+                break;
+            }
+            let chunk = self.read(fid, offset, msize)?;
+            if chunk.is_empty() {
+                break;
+            }
+            offset += chunk.len() as u64;
+            complete_lines += chunk.iter().filter(|byte| **byte == b'\n').count();
+            buffer.extend_from_slice(&chunk);
+        }
+        let _ = self.clunk(fid);
+        let text = String::from_utf8_lossy(&buffer);
+        Ok(text
+            .lines()
+            .skip(start_row)
+            .take(rows)
+            .map(|line| line.trim().to_owned())
+            .filter(|line| !line.is_empty())
+            .collect())
+    }
+
+    /// List a directory with inline qid/length records (readdir-plus).
+    ///
+    /// One read of `<dir>/.dirplus` replaces the list-then-stat pattern:
+    /// a 1000-worker directory costs `ceil(n / msize)` round trips
+    /// instead of one listing read plus one stat-equivalent read per
+    /// entry. Servers without the extension return NotFound; callers
+    /// fall back to [`Self::list_dir_window`] plus per-entry walks.
+    pub fn list_dir_plus(&mut self, path: &str) -> Result<Vec<secure9p_codec::DirPlusEntry>> {
+        let dirplus_path = format!(
+            "{}/{}",
+            path.trim_end_matches('/'),
+            secure9p_codec::DIRPLUS_ENTRY
+        );
+        let fid = self.open(&dirplus_path, OpenMode::read_only())?;
+        let msize = self.negotiated_msize();
+        let mut buffer = Vec::new();
+        let mut offset = 0u64;
+        loop {
+            let chunk = self.read(fid, offset, msize)?;
+            if chunk.is_empty() {
+                break;
+            }
+            offset += chunk.len() as u64;
+            buffer.extend_from_slice(&chunk);
+        }
+        let _ = self.clunk(fid);
+        secure9p_codec::decode_dirplus_entries(&buffer)
+            .map_err(|err| anyhow!("malformed dirplus listing for {path}: {err}"))
+    }
+
+    /// Read a small control file, serving unchanged content from the
+    /// qid-validated cache.
+    ///
+    /// The walk is always issued so the node's current qid version is
+    /// observed; when it matches the cached entry the open/read/clunk round
+    /// trips are skipped entirely, cutting a steady-state poll from four
+    /// wire ops to one.
+    pub fn read_control_cached(&mut self, path: &str) -> Result<Vec<u8>> {
+        let (fid, qid) = self.walk_qid(path)?;
+        if let Some(content) = self.content_cache.lookup(path, qid) {
+            let content = content.to_vec();
+            let _ = self.core.clunk(fid);
+            return Ok(content);
+        }
+        let open_result = self
+            .core
+            .open(fid, OpenMode::read_only())
+            .map_err(|err| anyhow!("failed to open {path}: {err}"));
+        if let Err(err) = open_result {
+            let _ = self.core.clunk(fid);
+            return Err(err);
+        }
+        let mut content = Vec::new();
+        let msize = self.negotiated_msize();
+        loop {
+            let chunk = self.read(fid, content.len() as u64, msize)?;
+            if chunk.is_empty() {
+                break;
+            }
+            content.extend_from_slice(&chunk);
+        }
+        let _ = self.core.clunk(fid);
+        self.content_cache.insert(path, qid, &content);
+        Ok(content)
+    }
+
+    /// Push a CAS bundle's chunks, resuming past chunks the server already
+    /// holds and pipelining the rest in windowed batches.
+    ///
+    /// The `/updates/<epoch>/chunks` listing is consulted first, so a
+    /// transfer interrupted by a link blip re-sends only the missing chunks
+    /// on retry. Each window of chunks is submitted as one pipelined
+    /// exchange (walk, open, writes, clunk per chunk), bounded by the
+    /// server's batch limits via `window`.
+    pub fn push_bundle_resumable(
+        &mut self,
+        epoch: &str,
+        chunks: &[(String, Vec<u8>)],
+        window: usize,
+    ) -> Result<BundlePushSummary> {
+        use secure9p_codec::{RequestBody, ResponseBody};
+        let listing_path = format!("/updates/{epoch}/chunks");
+        // Probe chunk presence with batched 1-byte reads: a committed chunk
+        // answers with data, an uncommitted or absent one reads empty or
+        // errors. One pipelined exchange covers a window of chunks.
+        let mut present: std::collections::HashSet<String> = std::collections::HashSet::new();
+        for batch in chunks.chunks(window.max(1)) {
+            let mut bodies = Vec::with_capacity(batch.len() * 4);
+            let mut fids = Vec::with_capacity(batch.len());
+            for (digest, _) in batch {
+                let components = self.parse_path(&format!("{listing_path}/{digest}"))?;
+                let fid = self.allocate_fid();
+                fids.push(fid);
+                bodies.push(RequestBody::Walk {
+                    fid: ROOT_FID,
+                    newfid: fid,
+                    wnames: components,
+                });
+                bodies.push(RequestBody::Open {
+                    fid,
+                    mode: OpenMode::read_only(),
+                });
+                bodies.push(RequestBody::Read {
+                    fid,
+                    offset: 0,
+                    count: 1,
+                });
+                bodies.push(RequestBody::Clunk { fid });
+            }
+            let responses = self
+                .core
+                .transact_batch(&bodies)
+                .map_err(|err| anyhow!("bundle presence probe failed: {err}"))?;
+            for (slot, response) in responses.into_iter().enumerate() {
+                if slot % 4 != 2 {
+                    continue;
+                }
+                if let Ok(ResponseBody::Read { data }) = response {
+                    if !data.is_empty() {
+                        present.insert(batch[slot / 4].0.clone());
+                    }
+                }
+            }
+        }
+
+        let mut summary = BundlePushSummary {
+            pushed: 0,
+            skipped: 0,
+            bytes: 0,
+        };
+        let msize = self.negotiated_msize() as usize;
+        // Leave room for the Twrite header within the negotiated msize, and
+        // keep each exchange's total encoded bytes inside the batch budget.
+        let write_span = msize.saturating_sub(64).max(512);
+        let batch_budget = msize.saturating_sub(256).max(write_span);
+        let window = window.max(1);
+        let mut bodies: Vec<RequestBody> = Vec::new();
+        let mut batch_bytes = 0usize;
+        let mut batch_chunks = 0usize;
+        let flush = |client: &mut Self, bodies: &mut Vec<RequestBody>| -> Result<()> {
+            if bodies.is_empty() {
+                return Ok(());
+            }
+            let responses = client
+                .core
+                .transact_batch(bodies)
+                .map_err(|err| anyhow!("bundle push exchange failed: {err}"))?;
+            bodies.clear();
+            for response in responses {
+                match response {
+                    Ok(
+                        ResponseBody::Walk { .. }
+                        | ResponseBody::Open { .. }
+                        | ResponseBody::Write { .. }
+                        | ResponseBody::Clunk,
+                    ) => {}
+                    Ok(other) => {
+                        return Err(anyhow!("unexpected response during bundle push: {other:?}"))
+                    }
+                    Err(err) => return Err(anyhow!("bundle push rejected: {err}")),
+                }
+            }
+            Ok(())
+        };
+        for (digest, payload) in chunks {
+            if present.contains(digest) {
+                summary.skipped += 1;
+                continue;
+            }
+            let chunk_cost = payload.len() + 192;
+            if !bodies.is_empty()
+                && (batch_bytes + chunk_cost > batch_budget || batch_chunks >= window)
+            {
+                flush(self, &mut bodies)?;
+                batch_bytes = 0;
+                batch_chunks = 0;
+            }
+            let components = self.parse_path(&format!("{listing_path}/{digest}"))?;
+            let fid = self.allocate_fid();
+            bodies.push(RequestBody::Walk {
+                fid: ROOT_FID,
+                newfid: fid,
+                wnames: components,
+            });
+            bodies.push(RequestBody::Open {
+                fid,
+                mode: OpenMode::write_append(),
+            });
+            let mut offset = 0u64;
+            for span in payload.chunks(write_span) {
+                // A single chunk larger than the batch budget streams as its
+                // own sequence of exchanges.
+                if batch_bytes + span.len() + 64 > batch_budget && !bodies.is_empty() {
+                    flush(self, &mut bodies)?;
+                    batch_bytes = 0;
+                }
+                bodies.push(RequestBody::Write {
+                    fid,
+                    offset,
+                    data: span.to_vec(),
+                });
+                batch_bytes += span.len() + 64;
+                offset += span.len() as u64;
+            }
+            bodies.push(RequestBody::Clunk { fid });
+            batch_chunks += 1;
+            summary.pushed += 1;
+            summary.bytes += payload.len() as u64;
+        }
+        flush(self, &mut bodies)?;
+        Ok(summary)
+    }
+
+    /// Stream a bulk read with several offset-pipelined Treads in flight.
+    ///
+    /// Each call to [`ReadStream::next_chunk`] submits up to `window` Treads
+    /// at successive offsets as one batched exchange and returns their
+    /// payloads stitched in order, so bulk pulls keep the link busy instead
+    /// of idling one round trip per chunk. The window is capped by the
+    /// server's batch limits; a short or empty chunk marks end-of-file.
+    pub fn read_stream(&mut self, fid: u32, len: u64, window: usize) -> ReadStream<'_, T> {
+        ReadStream {
+            client: self,
+            fid,
+            offset: 0,
+            remaining: len,
+            window: window.max(1),
+            done: false,
+        }
+    }
+
     /// Stream a file line-by-line, emitting a trailing `End` marker.
     pub fn tail(&mut self, path: &str) -> Result<TailStream<'_, T>> {
         let fid = self.open(path, OpenMode::read_only())?;
@@ -162,9 +556,18 @@ impl<T: Secure9pTransport> CohClient<T> {
             pending: VecDeque::new(),
             finished: false,
             closed: false,
+            follow: false,
         })
     }
 
+    /// Stream a file in follow mode: end-of-file means "no new data yet"
+    /// and the fid stays open for subsequent polls.
+    pub fn tail_follow(&mut self, path: &str) -> Result<TailStream<'_, T>> {
+        let mut stream = self.tail(path)?;
+        stream.follow = true;
+        Ok(stream)
+    }
+
     fn allocate_fid(&mut self) -> u32 {
         let fid = self.next_fid;
         self.next_fid = self.next_fid.wrapping_add(1);
@@ -241,6 +644,54 @@ impl<'a, T: Secure9pTransport> TailStream<'a, T> {
         }
     }
 
+    /// Drain up to `max` events, touching the wire at most once.
+    ///
+    /// When the client-side line buffer is empty, one msize-sized Tread is
+    /// issued and split into events locally; subsequent calls keep serving
+    /// from the buffer until it is exhausted. High-rate incident replays pay
+    /// one round trip per buffer-full of events instead of one per event.
+    pub fn drain_events(&mut self, max: usize) -> Result<Vec<TailEvent>> {
+        let mut events = Vec::new();
+        if max == 0 {
+            return Ok(events);
+        }
+        if self.pending.is_empty() && !self.finished {
+            let chunk = self
+                .client
+                .read(self.fid, self.offset, self.client.negotiated_msize())?;
+            if chunk.is_empty() {
+                if !self.follow {
+                    self.finished = true;
+                    if !self.buffer.is_empty() {
+                        let line = decode_line(&self.buffer)?;
+                        self.pending.push_back(line);
+                        self.buffer.clear();
+                    }
+                }
+            } else {
+                self.offset = self
+                    .offset
+                    .checked_add(chunk.len() as u64)
+                    .context("tail offset overflow")?;
+                self.buffer.extend_from_slice(&chunk);
+                self.extract_lines()?;
+            }
+        }
+        while events.len() < max {
+            if let Some(line) = self.pending.pop_front() {
+                events.push(TailEvent::Line(line));
+                continue;
+            }
+            if self.finished && !self.closed {
+                let _ = self.client.clunk(self.fid);
+                self.closed = true;
+                events.push(TailEvent::End);
+            }
+            break;
+        }
+        Ok(events)
+    }
+
     fn extract_lines(&mut self) -> Result<()> {
         while let Some(pos) = self.buffer.iter().position(|byte| *byte == b'\n') {
             let line_bytes: Vec<u8> = self.buffer.drain(..pos).collect();
@@ -273,6 +724,147 @@ impl<'a, T: Secure9pTransport> Drop for TailStream<'a, T> {
     }
 }
 
+/// Summary of a resumable bundle push.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct BundlePushSummary {
+    /// Chunks transferred in this run.
+    pub pushed: usize,
+    /// Chunks the server already held.
+    pub skipped: usize,
+    /// Payload bytes transferred.
+    pub bytes: u64,
+}
+
+/// Pipelined bulk-read stream returned by `CohClient::read_stream`.
+pub struct ReadStream<'a, T: Secure9pTransport> {
+    client: &'a mut CohClient<T>,
+    fid: u32,
+    offset: u64,
+    remaining: u64,
+    window: usize,
+    done: bool,
+}
+
+impl<T: Secure9pTransport> ReadStream<'_, T> {
+    /// Fetch the next in-order run of chunks, or `None` at end-of-file.
+    pub fn next_chunk(&mut self) -> Result<Option<Vec<u8>>> {
+        use secure9p_codec::{RequestBody, ResponseBody};
+        if self.done || self.remaining == 0 {
+            return Ok(None);
+        }
+        let msize = u64::from(self.client.negotiated_msize());
+        let mut bodies = Vec::with_capacity(self.window);
+        let mut probe_offset = self.offset;
+        let mut budget = self.remaining;
+        for _ in 0..self.window {
+            if budget == 0 {
+                break;
+            }
+            let count = budget.min(msize) as u32;
+            bodies.push(RequestBody::Read {
+                fid: self.fid,
+                offset: probe_offset,
+                count,
+            });
+            probe_offset = probe_offset.saturating_add(u64::from(count));
+            budget -= u64::from(count);
+        }
+        let responses = self
+            .client
+            .core
+            .transact_batch(&bodies)
+            .map_err(|err| anyhow!("pipelined read failed: {err}"))?;
+        let mut chunk = Vec::new();
+        for (response, body) in responses.into_iter().zip(&bodies) {
+            let RequestBody::Read { count, .. } = body else {
+                unreachable!("read stream only issues Tread");
+            };
+            let data = match response {
+                Ok(ResponseBody::Read { data }) => data,
+                Ok(_) => return Err(anyhow!("unexpected response in read stream")),
+                Err(err) => return Err(anyhow!("pipelined read failed: {err}")),
+            };
+            let short = (data.len() as u32) < *count;
+            self.offset = self.offset.saturating_add(data.len() as u64);
+            self.remaining = self.remaining.saturating_sub(data.len() as u64);
+            chunk.extend_from_slice(&data);
+            if short {
+                // EOF inside the window: later reads in this batch saw
+                // beyond-end offsets and returned empty; stop here.
+                self.done = true;
+                break;
+            }
+        }
+        if self.remaining == 0 {
+            self.done = true;
+        }
+        if chunk.is_empty() {
+            self.done = true;
+            Ok(None)
+        } else {
+            Ok(Some(chunk))
+        }
+    }
+}
+
+/// Long-lived status subscription combining a tail stream with adaptive
+/// polling.
+///
+/// UI consumers keep one subscription per watched file instead of running
+/// walk/open/read/clunk cycles on a timer: the fid stays open in the tail
+/// stream, each due poll drains whatever accumulated in one wire round
+/// trip, and the embedded `TailPoller` backs idle files off toward the
+/// policy maximum (server poll hints slot in via `record_hint`), so
+/// steady-state traffic for unchanged status files approaches zero.
+pub struct StatusWatch<'a, T: Secure9pTransport> {
+    stream: TailStream<'a, T>,
+    poller: cohsh_core::TailPoller,
+}
+
+impl<'a, T: Secure9pTransport> StatusWatch<'a, T> {
+    /// Open a subscription over `path` with the supplied poll policy.
+    pub fn open(
+        client: &'a mut CohClient<T>,
+        path: &str,
+        policy: cohsh_core::TailPollPolicy,
+    ) -> Result<Self> {
+        let stream = client.tail_follow(path)?;
+        Ok(Self {
+            stream,
+            poller: cohsh_core::TailPoller::new(policy, None),
+        })
+    }
+
+    /// True when the adaptive cadence says it is time to poll.
+    #[must_use]
+    pub fn poll_due(&self, now_ms: u64) -> bool {
+        self.poller.should_poll(now_ms)
+    }
+
+    /// Milliseconds until the next poll is due.
+    #[must_use]
+    pub fn next_delay_ms(&self, now_ms: u64) -> u64 {
+        self.poller.next_delay_ms(now_ms)
+    }
+
+    /// Drain pending events (one wire round trip at most) and adapt the
+    /// cadence from the outcome.
+    pub fn collect(&mut self, now_ms: u64) -> Result<Vec<TailEvent>> {
+        self.poller.mark_polled(now_ms);
+        let events = self.stream.drain_events(usize::MAX)?;
+        let got_data = events
+            .iter()
+            .any(|event| matches!(event, TailEvent::Line(_)));
+        self.poller.record_outcome(got_data, None);
+        Ok(events)
+    }
+
+    /// Feed a server-provided next-poll hint into the cadence.
+    pub fn record_hint(&mut self, hint_ms: u64) {
+        self.poller.record_outcome(false, Some(hint_ms));
+    }
+}
+
 /// Wrapper transport for in-process NineDoor connections.
 pub struct InProcessTransport {
     connection: nine_door::InProcessConnection,
@@ -1617,6 +1617,84 @@ impl<T: Transport, W: Write> Shell<T, W> {
         result
     }
 
+    /// Execute a script with independent echo runs submitted as batches.
+    ///
+    /// The whole script is parsed up front; consecutive `echo` commands that
+    /// target the same path and are followed only by `EXPECT OK` checks are
+    /// grouped and flushed through `Transport::write_batch`, which pipelined
+    /// transports turn into framed multi-write exchanges. Every other line
+    /// (attach, lifecycle, reads, non-trivial EXPECTs) keeps the sequential
+    /// path and its error reporting, so results are still reported per line.
+    pub fn run_script_batched<R: BufRead>(&mut self, reader: R) -> Result<()> {
+        let lines = parse_script_lines(reader)?;
+        self.script_state = Some(ScriptState::default());
+        let result = self.run_script_lines_batched(&lines);
+        self.script_state = None;
+        result
+    }
+
+    fn run_script_lines_batched(&mut self, lines: &[ScriptLine]) -> Result<()> {
+        let mut index = 0usize;
+        while index < lines.len() {
+            let group = collect_echo_batch(lines, index);
+            let Some(group) = group else {
+                // Fall back to the sequential interpreter for one step.
+                let end = next_command_boundary(lines, index);
+                self.run_script_lines(&lines[index..end])?;
+                if script_line_is_quit(&lines[index]) {
+                    break;
+                }
+                index = end;
+                continue;
+            };
+            let session = match self.session.clone() {
+                Some(session) => session,
+                None => {
+                    let end = next_command_boundary(lines, index);
+                    self.run_script_lines(&lines[index..end])?;
+                    if script_line_is_quit(&lines[index]) {
+                        break;
+                    }
+                    index = end;
+                    continue;
+                }
+            };
+            let written = self
+                .transport
+                .write_batch(&session, &group.path, &group.payloads)
+                .map_err(|err| {
+                    format_script_error(
+                        lines[index].number,
+                        &lines[index].text,
+                        self.script_state.as_ref(),
+                        &format!("batched write failed: {err}"),
+                    )
+                })?;
+            if written != group.payloads.len() {
+                return Err(format_script_error(
+                    lines[index].number,
+                    &lines[index].text,
+                    self.script_state.as_ref(),
+                    &format!(
+                        "batched write applied {written} of {} payloads",
+                        group.payloads.len()
+                    ),
+                ));
+            }
+            if let Some(state) = self.script_state.as_mut() {
+                for line in &lines[index..group.end] {
+                    state.last_command_line = Some(line.text.clone());
+                }
+                state.last_response_line = Some(format!(
+                    "OK ECHO path={} batched={written}",
+                    group.path
+                ));
+            }
+            index = group.end;
+        }
+        Ok(())
+    }
+
     fn run_script_lines(&mut self, lines: &[ScriptLine]) -> Result<()> {
         let mut index = 0usize;
         while index < lines.len() {
@@ -3640,6 +3718,79 @@ pub(crate) fn normalise_payload(input: &str) -> Result<String> {
     Ok(payload)
 }
 
+/// Run of consecutive same-path echo commands eligible for batching.
+struct EchoBatch {
+    path: String,
+    payloads: Vec<Vec<u8>>,
+    end: usize,
+}
+
+fn script_line_is_quit(line: &ScriptLine) -> bool {
+    line.text
+        .trim_start()
+        .split_whitespace()
+        .next()
+        .is_some_and(|keyword| keyword == "quit")
+}
+
+fn parse_echo_line(text: &str) -> Option<(String, String)> {
+    let rest = text.strip_prefix("echo")?;
+    if !rest.starts_with(char::is_whitespace) {
+        return None;
+    }
+    let (raw_text, path_part) = rest.trim_start().split_once('>')?;
+    let path = path_part.trim();
+    ensure_valid_path(path).ok()?;
+    let payload = build_echo_payload(raw_text).ok()?;
+    Some((path.to_owned(), payload))
+}
+
+/// Collect a run of at least two echo commands to one path, where each is
+/// followed only by `EXPECT OK` checks (satisfied by a successful batch).
+fn collect_echo_batch(lines: &[ScriptLine], start: usize) -> Option<EchoBatch> {
+    let mut idx = start;
+    let mut path: Option<String> = None;
+    let mut payloads = Vec::new();
+    while idx < lines.len() {
+        let text = lines[idx].text.trim();
+        let Some((line_path, payload)) = parse_echo_line(text) else {
+            break;
+        };
+        if path.as_deref().is_some_and(|existing| existing != line_path) {
+            break;
+        }
+        path = Some(line_path);
+        payloads.push(payload.into_bytes());
+        idx += 1;
+        while idx < lines.len() && lines[idx].text.trim() == "EXPECT OK" {
+            idx += 1;
+        }
+    }
+    if payloads.len() >= 2 {
+        Some(EchoBatch {
+            path: path?,
+            payloads,
+            end: idx,
+        })
+    } else {
+        None
+    }
+}
+
+/// Index just past one command and its trailing EXPECT/WAIT directives.
+fn next_command_boundary(lines: &[ScriptLine], start: usize) -> usize {
+    let mut idx = start.saturating_add(1);
+    while idx < lines.len() {
+        let text = lines[idx].text.trim_start();
+        if text.starts_with("EXPECT") || text.starts_with("WAIT") {
+            idx += 1;
+        } else {
+            break;
+        }
+    }
+    idx
+}
+
 fn build_echo_payload(raw_text: &str) -> Result<String> {
     if raw_text.contains(TEST_MSIZE_SENTINEL) {
         return Ok(build_msize_overflow_payload());
@@ -4187,6 +4338,33 @@ mod tests {
         assert_eq!(normalise_payload("plain").unwrap(), "plain\n");
     }
 
+    #[test]
+    fn echo_batches_group_same_path_runs() {
+        let lines = vec![
+            ScriptLine {
+                number: 1,
+                text: "echo a > /log/queen.log".to_owned(),
+            },
+            ScriptLine {
+                number: 2,
+                text: "EXPECT OK".to_owned(),
+            },
+            ScriptLine {
+                number: 3,
+                text: "echo b > /log/queen.log".to_owned(),
+            },
+            ScriptLine {
+                number: 4,
+                text: "echo c > /other/path".to_owned(),
+            },
+        ];
+        let batch = collect_echo_batch(&lines, 0).expect("batch");
+        assert_eq!(batch.path, "/log/queen.log");
+        assert_eq!(batch.payloads.len(), 2);
+        assert_eq!(batch.end, 3);
+        assert!(collect_echo_batch(&lines, 3).is_none());
+    }
+
     #[test]
     fn echo_payload_expands_msize_sentinel() {
         let payload = build_echo_payload(TEST_MSIZE_SENTINEL).unwrap();
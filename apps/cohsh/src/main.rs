@@ -97,6 +97,10 @@ struct Cli {
     #[arg(long)]
     script: Option<PathBuf>,
 
+    /// Submit independent script operations as pipelined batches.
+    #[arg(long, requires = "script")]
+    batch: bool,
+
     /// Validate a script file without executing it.
     #[arg(long, value_name = "FILE", conflicts_with = "script")]
     check: Option<PathBuf>,
@@ -499,7 +503,11 @@ fn main() -> Result<()> {
         }
         let file = File::open(&script_path)
             .with_context(|| format!("failed to open script {script_path:?}"))?;
-        shell.run_script(BufReader::new(file))
+        if cli.batch {
+            shell.run_script_batched(BufReader::new(file))
+        } else {
+            shell.run_script(BufReader::new(file))
+        }
     } else {
         let auto_role = cli.role.map(Role::from);
         let auto_attach = auto_role.map(|role| AutoAttach {
@@ -46,3 +46,179 @@ pub fn budget(ttl_s: Option<u64>, ops: Option<u64>) -> Result<String> {
     payload.push_str("}}");
     crate::normalise_payload(&payload)
 }
+
+/// One queen-level operation with its declared target paths.
+///
+/// Targets are namespace paths the operation reads or writes; the
+/// scheduler treats two operations as conflicting when any pair of
+/// their targets is equal or one prefixes the other.
+#[derive(Debug, Clone)]
+pub struct QueenOp {
+    /// Stable identifier echoed back in results.
+    pub id: String,
+    /// Namespace paths this operation touches.
+    pub targets: Vec<String>,
+    /// Pre-normalised control payload to submit.
+    pub payload: String,
+}
+
+fn paths_conflict(a: &str, b: &str) -> bool {
+    let a = a.trim_end_matches('/');
+    let b = b.trim_end_matches('/');
+    if a == b {
+        return true;
+    }
+    let (short, long) = if a.len() < b.len() { (a, b) } else { (b, a) };
+    long.starts_with(short) && long.as_bytes().get(short.len()) == Some(&b'/')
+}
+
+fn ops_conflict(a: &QueenOp, b: &QueenOp) -> bool {
+    a.targets
+        .iter()
+        .any(|pa| b.targets.iter().any(|pb| paths_conflict(pa, pb)))
+}
+
+/// Partition operations into waves preserving submission order.
+///
+/// Each wave holds pairwise-disjoint operations; an op lands in the
+/// first wave where nothing earlier in program order conflicts with it,
+/// so conflicting operations stay serialized across waves while
+/// disjoint ones (distinct worker subtrees) share a wave.
+#[must_use]
+pub fn plan_waves(ops: Vec<QueenOp>) -> Vec<Vec<QueenOp>> {
+    let mut waves: Vec<Vec<QueenOp>> = Vec::new();
+    // Earliest wave an op may join: one past the last wave holding a
+    // conflicting op, so cross-wave ordering between conflicts holds.
+    for op in ops {
+        let mut earliest = 0usize;
+        for (index, wave) in waves.iter().enumerate() {
+            if wave.iter().any(|placed| ops_conflict(placed, &op)) {
+                earliest = index + 1;
+            }
+        }
+        if earliest == waves.len() {
+            waves.push(Vec::new());
+        }
+        waves[earliest].push(op);
+    }
+    waves
+}
+
+/// Result of one scheduled operation.
+#[derive(Debug)]
+pub struct QueenOpResult {
+    /// Identifier from the submitted [`QueenOp`].
+    pub id: String,
+    /// Executor outcome for this operation.
+    pub outcome: Result<String>,
+}
+
+/// Execute operations wave by wave, fanning each wave across threads.
+///
+/// `width` bounds concurrency within a wave (pooled session count);
+/// the executor runs once per op and must be safe to call from
+/// multiple threads — in practice each thread checks a session out of
+/// the pool. Results come back in submission order per wave.
+pub fn run_waves<F>(ops: Vec<QueenOp>, width: usize, executor: F) -> Vec<QueenOpResult>
+where
+    F: Fn(&QueenOp) -> Result<String> + Sync,
+{
+    let width = width.max(1);
+    let mut results = Vec::new();
+    for wave in plan_waves(ops) {
+        let outcomes: Vec<Option<Result<String>>> = {
+            let mut slots: Vec<Option<Result<String>>> = Vec::new();
+            slots.resize_with(wave.len(), || None);
+            let slots = std::sync::Mutex::new(slots);
+            let next = std::sync::atomic::AtomicUsize::new(0);
+            std::thread::scope(|scope| {
+                for _ in 0..width.min(wave.len()) {
+                    scope.spawn(|| loop {
+                        let index = next.fetch_add(1, std::sync::atomic::Ordering::Relaxed);
+                        let Some(op) = wave.get(index) else { break };
+                        let outcome = executor(op);
+                        slots.lock().expect("scheduler slots lock")[index] = Some(outcome);
+                    });
+                }
+            });
+            slots.into_inner().expect("scheduler slots lock")
+        };
+        for (op, outcome) in wave.into_iter().zip(outcomes) {
+            results.push(QueenOpResult {
+                id: op.id,
+                outcome: outcome.unwrap_or_else(|| Err(anyhow!("operation was not executed"))),
+            });
+        }
+    }
+    results
+}
+
+#[cfg(test)]
+mod scheduler_tests {
+    use super::*;
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::sync::Mutex;
+
+    fn op(id: &str, targets: &[&str]) -> QueenOp {
+        QueenOp {
+            id: id.to_string(),
+            targets: targets.iter().map(|t| t.to_string()).collect(),
+            payload: String::from("{}"),
+        }
+    }
+
+    #[test]
+    fn disjoint_ops_share_a_wave_and_conflicts_serialize() {
+        let waves = plan_waves(vec![
+            op("a", &["/worker/1"]),
+            op("b", &["/worker/2"]),
+            op("c", &["/worker/1/ctl"]),
+            op("d", &["/worker/3"]),
+        ]);
+        assert_eq!(waves.len(), 2);
+        assert_eq!(waves[0].len(), 3, "a, b, d are pairwise disjoint");
+        assert_eq!(waves[1][0].id, "c", "c prefixes a's target and waits");
+    }
+
+    #[test]
+    fn run_waves_executes_concurrently_within_a_wave() {
+        let ops: Vec<QueenOp> = (0..8)
+            .map(|n| op(&format!("op-{n}"), &[&format!("/worker/{n}")]))
+            .collect();
+        let inflight = AtomicUsize::new(0);
+        let peak = Mutex::new(0usize);
+        let results = run_waves(ops, 4, |operation| {
+            let now = inflight.fetch_add(1, Ordering::SeqCst) + 1;
+            {
+                let mut guard = peak.lock().unwrap();
+                *guard = (*guard).max(now);
+            }
+            std::thread::sleep(std::time::Duration::from_millis(5));
+            inflight.fetch_sub(1, Ordering::SeqCst);
+            Ok(operation.id.clone())
+        });
+        assert_eq!(results.len(), 8);
+        assert!(results.iter().all(|r| r.outcome.is_ok()));
+        assert!(
+            *peak.lock().unwrap() > 1,
+            "disjoint wave should overlap execution"
+        );
+    }
+
+    #[test]
+    fn conflicting_ops_never_overlap() {
+        let ops = vec![
+            op("first", &["/worker/1"]),
+            op("second", &["/worker/1/ctl"]),
+        ];
+        let inflight = AtomicUsize::new(0);
+        let results = run_waves(ops, 4, |operation| {
+            assert_eq!(inflight.fetch_add(1, Ordering::SeqCst), 0);
+            std::thread::sleep(std::time::Duration::from_millis(2));
+            inflight.fetch_sub(1, Ordering::SeqCst);
+            Ok(operation.id.clone())
+        });
+        assert_eq!(results[0].id, "first");
+        assert_eq!(results[1].id, "second");
+    }
+}
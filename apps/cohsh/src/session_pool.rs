@@ -5,6 +5,7 @@
 
 use std::collections::VecDeque;
 use std::sync::{Arc, Mutex};
+use std::time::{Duration, Instant};
 
 use anyhow::{anyhow, Result};
 use cohesix_ticket::Role;
@@ -35,13 +36,34 @@ where
     }
 }
 
+/// Idle time after which a pooled session is probed before reuse.
+const KEEPALIVE_IDLE: Duration = Duration::from_secs(30);
+
+/// Burst growth factor applied to each pool capacity under demand.
+const BURST_MULTIPLIER: u16 = 2;
+
 struct PoolSession {
     transport: Box<dyn Transport + Send>,
     session: Session,
+    last_used: Instant,
+}
+
+impl PoolSession {
+    /// Probe the session when it has idled long enough that the server side
+    /// may have dropped it, so dead sessions are replaced at checkout instead
+    /// of surfacing mid-operation.
+    fn is_healthy(&mut self) -> bool {
+        if self.last_used.elapsed() < KEEPALIVE_IDLE {
+            return true;
+        }
+        self.transport.ping(&self.session).is_ok()
+    }
 }
 
 #[derive(Default)]
 struct PoolState {
+    control_capacity: u16,
+    telemetry_capacity: u16,
     role: Option<Role>,
     ticket: Option<String>,
     closed: bool,
@@ -67,11 +89,17 @@ impl SessionPool {
         telemetry_capacity: u16,
         factory: Arc<dyn TransportFactory>,
     ) -> Self {
+        let control_capacity = control_capacity.max(1);
+        let telemetry_capacity = telemetry_capacity.max(1);
         Self {
-            control_capacity: control_capacity.max(1),
-            telemetry_capacity: telemetry_capacity.max(1),
+            control_capacity,
+            telemetry_capacity,
             factory,
-            state: Arc::new(Mutex::new(PoolState::default())),
+            state: Arc::new(Mutex::new(PoolState {
+                control_capacity,
+                telemetry_capacity,
+                ..PoolState::default()
+            })),
         }
     }
 
@@ -113,6 +141,12 @@ impl SessionPool {
     }
 
     /// Borrow a session from the pool for the requested kind.
+    ///
+    /// Idle sessions past the keepalive threshold are health-probed before
+    /// reuse; broken ones are discarded and replaced transparently. When the
+    /// idle set is empty the pool grows on demand up to a burst ceiling of
+    /// twice the configured capacity, and surplus sessions are retired as
+    /// leases drain back.
     pub fn checkout(&self, kind: PoolKind) -> Result<PoolLease> {
         let mut state = self.state.lock().expect("session pool lock poisoned");
         if state.closed {
@@ -122,29 +156,59 @@ impl SessionPool {
             .role
             .ok_or_else(|| anyhow!("session pool is not attached"))?;
         let ticket = state.ticket.clone();
-        match kind {
-            PoolKind::Control => {
-                if let Some(session) = state.control_idle.pop_front() {
-                    return Ok(PoolLease::new(kind, self.state.clone(), session));
-                }
-                if state.control_total >= self.control_capacity {
-                    return Err(anyhow!("session pool exhausted for {kind:?}"));
-                }
-                let session = self.spawn_session(role, ticket.as_deref())?;
-                state.control_total = state.control_total.saturating_add(1);
-                Ok(PoolLease::new(kind, self.state.clone(), session))
-            }
-            PoolKind::Telemetry => {
-                if let Some(session) = state.telemetry_idle.pop_front() {
-                    return Ok(PoolLease::new(kind, self.state.clone(), session));
-                }
-                if state.telemetry_total >= self.telemetry_capacity {
-                    return Err(anyhow!("session pool exhausted for {kind:?}"));
-                }
-                let session = self.spawn_session(role, ticket.as_deref())?;
-                state.telemetry_total = state.telemetry_total.saturating_add(1);
-                Ok(PoolLease::new(kind, self.state.clone(), session))
+        let capacity = self.capacity_for(kind);
+        let burst = capacity.saturating_mul(BURST_MULTIPLIER);
+        loop {
+            let idle = Self::idle_for_mut(&mut state, kind);
+            let Some(mut session) = idle.pop_front() else {
+                break;
+            };
+            if session.is_healthy() {
+                return Ok(PoolLease::new(kind, self.state.clone(), session));
             }
+            let _ = session.transport.quit(&session.session);
+            Self::decrement_total(&mut state, kind);
+        }
+        if Self::total_for(&state, kind) >= burst {
+            return Err(anyhow!("session pool exhausted for {kind:?}"));
+        }
+        let session = self.spawn_session(role, ticket.as_deref())?;
+        Self::increment_total(&mut state, kind);
+        Ok(PoolLease::new(kind, self.state.clone(), session))
+    }
+
+    fn capacity_for(&self, kind: PoolKind) -> u16 {
+        match kind {
+            PoolKind::Control => self.control_capacity,
+            PoolKind::Telemetry => self.telemetry_capacity,
+        }
+    }
+
+    fn idle_for_mut(state: &mut PoolState, kind: PoolKind) -> &mut VecDeque<PoolSession> {
+        match kind {
+            PoolKind::Control => &mut state.control_idle,
+            PoolKind::Telemetry => &mut state.telemetry_idle,
+        }
+    }
+
+    fn total_for(state: &PoolState, kind: PoolKind) -> u16 {
+        match kind {
+            PoolKind::Control => state.control_total,
+            PoolKind::Telemetry => state.telemetry_total,
+        }
+    }
+
+    fn increment_total(state: &mut PoolState, kind: PoolKind) {
+        match kind {
+            PoolKind::Control => state.control_total = state.control_total.saturating_add(1),
+            PoolKind::Telemetry => state.telemetry_total = state.telemetry_total.saturating_add(1),
+        }
+    }
+
+    fn decrement_total(state: &mut PoolState, kind: PoolKind) {
+        match kind {
+            PoolKind::Control => state.control_total = state.control_total.saturating_sub(1),
+            PoolKind::Telemetry => state.telemetry_total = state.telemetry_total.saturating_sub(1),
         }
     }
 
@@ -152,7 +216,11 @@ impl SessionPool {
         let mut transport = self.factory.create()?;
         let session = transport.attach(role, ticket)?;
         let _ = transport.drain_acknowledgements();
-        Ok(PoolSession { transport, session })
+        Ok(PoolSession {
+            transport,
+            session,
+            last_used: Instant::now(),
+        })
     }
 
     fn reset_locked(&self, state: &mut PoolState) {
@@ -214,9 +282,25 @@ impl Drop for PoolLease {
             let _ = session.transport.quit(&session.session);
             return;
         }
+        session.last_used = Instant::now();
         match self.kind {
-            PoolKind::Control => state.control_idle.push_back(session),
-            PoolKind::Telemetry => state.telemetry_idle.push_back(session),
+            PoolKind::Control => {
+                // Retire burst sessions once demand subsides.
+                if state.control_idle.len() >= usize::from(state.control_capacity) {
+                    let _ = session.transport.quit(&session.session);
+                    state.control_total = state.control_total.saturating_sub(1);
+                } else {
+                    state.control_idle.push_back(session);
+                }
+            }
+            PoolKind::Telemetry => {
+                if state.telemetry_idle.len() >= usize::from(state.telemetry_capacity) {
+                    let _ = session.transport.quit(&session.session);
+                    state.telemetry_total = state.telemetry_total.saturating_sub(1);
+                } else {
+                    state.telemetry_idle.push_back(session);
+                }
+            }
         }
     }
 }
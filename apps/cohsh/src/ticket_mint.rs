@@ -126,3 +126,99 @@ fn unix_time_ms() -> u64 {
         .unwrap_or_default()
         .as_millis() as u64
 }
+
+/// Minting session amortising key and config setup across a batch.
+///
+/// Enrolling a worker batch previously paid the config parse and issuer
+/// setup per ticket; a session loads the role secret once, holds the
+/// issuer, and mints N tickets with per-ticket subject and budget
+/// variations. One hundred enrollments cost one setup.
+pub struct TicketMintSession {
+    role: Role,
+    issuer: TicketIssuer,
+}
+
+impl TicketMintSession {
+    /// Open a session from a shared secret.
+    #[must_use]
+    pub fn from_secret(role: Role, secret: &str) -> Self {
+        Self {
+            role,
+            issuer: TicketIssuer::new(secret),
+        }
+    }
+
+    /// Open a session loading the role secret from root_task.toml once.
+    pub fn from_config(role: Role, config_path: &Path) -> Result<Self> {
+        let secret = load_ticket_secret(config_path, role)?;
+        Ok(Self::from_secret(role, secret.as_str()))
+    }
+
+    /// Mint one ticket with an optional per-ticket budget override.
+    pub fn mint(&self, subject: Option<&str>, budget: Option<BudgetSpec>) -> Result<String> {
+        let request = TicketMintRequest::new(self.role, subject, budget)?;
+        let claims = TicketClaims::new(
+            request.role,
+            request.budget,
+            request.subject,
+            MountSpec::empty(),
+            unix_time_ms(),
+        );
+        let token = self
+            .issuer
+            .issue(claims)
+            .map_err(|err| anyhow!("failed to issue ticket: {err:?}"))?;
+        token
+            .encode()
+            .map_err(|err| anyhow!("failed to encode ticket: {err:?}"))
+    }
+
+    /// Mint a batch: one token per `(subject, budget)` entry, in order.
+    pub fn mint_batch(
+        &self,
+        entries: &[(Option<&str>, Option<BudgetSpec>)],
+    ) -> Result<Vec<String>> {
+        entries
+            .iter()
+            .map(|(subject, budget)| self.mint(*subject, *budget))
+            .collect()
+    }
+}
+
+#[cfg(test)]
+mod mint_session_tests {
+    use super::*;
+
+    #[test]
+    fn batch_minting_amortises_setup_and_varies_budgets() {
+        let session = TicketMintSession::from_secret(Role::WorkerHeartbeat, "worker-secret");
+        let entries: Vec<(Option<&str>, Option<BudgetSpec>)> = vec![
+            (Some("worker-1"), None),
+            (Some("worker-2"), Some(BudgetSpec::default_gpu())),
+            (Some("worker-3"), None),
+        ];
+        let tokens = session.mint_batch(&entries).expect("mint batch");
+        assert_eq!(tokens.len(), 3);
+        // Every token verifies against the same issuer key, and per-ticket
+        // budgets took effect.
+        let key = TicketIssuer::new("worker-secret").key();
+        let second = cohesix_ticket::TicketToken::decode(&tokens[1], &key).expect("verify");
+        assert_eq!(second.claims().subject.as_deref(), Some("worker-2"));
+        assert_eq!(
+            second.claims().budget.ops(),
+            BudgetSpec::default_gpu().ops()
+        );
+        // Matches the single-shot path byte-for-byte semantics.
+        let single = mint_ticket_from_secret(
+            &TicketMintRequest::new(Role::WorkerHeartbeat, Some("worker-1"), None).unwrap(),
+            "worker-secret",
+        )
+        .expect("single mint");
+        let single_claims = cohesix_ticket::TicketToken::decode(&single, &key).expect("verify");
+        let batch_claims = cohesix_ticket::TicketToken::decode(&tokens[0], &key).expect("verify");
+        assert_eq!(
+            single_claims.claims().subject,
+            batch_claims.claims().subject
+        );
+    }
+}
@@ -371,3 +371,175 @@ impl<T: Secure9pTransport> Transport for TraceShellTransport<T> {
 fn map_trace_error(err: TraceError) -> anyhow::Error {
     anyhow!("trace error: {err}")
 }
+
+/// Bounded background writer for transcript records.
+///
+/// Record submission is a bounded-channel send — nanoseconds on the
+/// command path — while an owned thread sequences records into the
+/// transcript file. The channel bound caps memory when the disk stalls
+/// (submission then backpressures rather than growing without limit).
+/// Transcripts survive crashes: [`TraceWriteHandle::install_panic_flush`]
+/// hooks the panic path to drain and sync the file before unwinding
+/// continues, and dropping the writer flushes on orderly exit.
+pub mod background {
+    use std::fs::File;
+    use std::io::{BufWriter, Write};
+    use std::panic;
+    use std::path::Path;
+    use std::sync::mpsc::{sync_channel, Receiver, SyncSender};
+    use std::thread::JoinHandle;
+    use std::time::Duration;
+
+    use anyhow::{anyhow, Context, Result};
+
+    /// Default channel bound: enough for a burst of scripted commands
+    /// without letting a wedged disk hold unbounded transcripts.
+    pub const DEFAULT_RECORD_BOUND: usize = 256;
+
+    enum WriterMsg {
+        Record(String),
+        Flush(SyncSender<()>),
+        Shutdown,
+    }
+
+    /// Owning handle for the background transcript writer.
+    pub struct BackgroundTraceWriter {
+        sender: Option<SyncSender<WriterMsg>>,
+        thread: Option<JoinHandle<()>>,
+    }
+
+    /// Cheap cloneable submission handle for the command path.
+    #[derive(Clone)]
+    pub struct TraceWriteHandle {
+        sender: SyncSender<WriterMsg>,
+    }
+
+    impl BackgroundTraceWriter {
+        /// Spawn the writer thread appending records to `path`.
+        pub fn create(path: &Path, bound: usize) -> Result<(Self, TraceWriteHandle)> {
+            let file = File::create(path)
+                .with_context(|| format!("failed to create trace {}", path.display()))?;
+            let (sender, receiver) = sync_channel(bound.max(1));
+            let thread = std::thread::Builder::new()
+                .name("cohsh-trace-writer".into())
+                .spawn(move || Self::run(file, receiver))
+                .context("failed to spawn trace writer thread")?;
+            let handle = TraceWriteHandle {
+                sender: sender.clone(),
+            };
+            Ok((
+                Self {
+                    sender: Some(sender),
+                    thread: Some(thread),
+                },
+                handle,
+            ))
+        }
+
+        fn run(file: File, receiver: Receiver<WriterMsg>) {
+            let mut out = BufWriter::new(file);
+            while let Ok(message) = receiver.recv() {
+                match message {
+                    WriterMsg::Record(line) => {
+                        let _ = out.write_all(line.as_bytes());
+                        let _ = out.write_all(b"\n");
+                    }
+                    WriterMsg::Flush(ack) => {
+                        let _ = out.flush();
+                        let _ = ack.send(());
+                    }
+                    // Clones of the submission handle may outlive the
+                    // writer, so shutdown is an explicit message rather
+                    // than channel closure.
+                    WriterMsg::Shutdown => break,
+                }
+            }
+            let _ = out.flush();
+        }
+    }
+
+    impl Drop for BackgroundTraceWriter {
+        fn drop(&mut self) {
+            if let Some(sender) = self.sender.take() {
+                let _ = sender.send(WriterMsg::Shutdown);
+            }
+            if let Some(thread) = self.thread.take() {
+                let _ = thread.join();
+            }
+        }
+    }
+
+    impl TraceWriteHandle {
+        /// Submit one transcript record; blocks only when the bound is
+        /// reached (disk stall backpressure).
+        pub fn record(&self, line: &str) -> Result<()> {
+            self.sender
+                .send(WriterMsg::Record(line.to_owned()))
+                .map_err(|_| anyhow!("trace writer has shut down"))
+        }
+
+        /// Drain pending records to disk and wait for the sync.
+        pub fn flush(&self, timeout: Duration) -> Result<()> {
+            let (ack, done) = sync_channel(1);
+            self.sender
+                .send(WriterMsg::Flush(ack))
+                .map_err(|_| anyhow!("trace writer has shut down"))?;
+            done.recv_timeout(timeout)
+                .map_err(|_| anyhow!("trace flush timed out"))
+        }
+
+        /// Chain a panic hook that flushes pending transcript records
+        /// (bounded wait) before the previous hook runs, so a crashing
+        /// session still leaves its transcript on disk.
+        pub fn install_panic_flush(&self) {
+            let handle = self.clone();
+            let previous = panic::take_hook();
+            panic::set_hook(Box::new(move |info| {
+                let _ = handle.flush(Duration::from_secs(1));
+                previous(info);
+            }));
+        }
+    }
+
+    #[cfg(test)]
+    mod tests {
+        use super::*;
+
+        #[test]
+        fn records_are_sequenced_and_flushed_on_drop() {
+            let dir = std::env::temp_dir().join(format!("cohsh-trace-{}", std::process::id()));
+            std::fs::create_dir_all(&dir).expect("trace dir");
+            let path = dir.join("drop.trace");
+            {
+                let (writer, handle) =
+                    BackgroundTraceWriter::create(&path, DEFAULT_RECORD_BOUND).expect("writer");
+                for index in 0..32 {
+                    handle.record(&format!("record-{index}")).expect("record");
+                }
+                drop(writer);
+            }
+            let text = std::fs::read_to_string(&path).expect("read trace");
+            let lines: Vec<&str> = text.lines().collect();
+            assert_eq!(lines.len(), 32);
+            assert_eq!(lines[0], "record-0");
+            assert_eq!(lines[31], "record-31");
+            let _ = std::fs::remove_dir_all(&dir);
+        }
+
+        #[test]
+        fn explicit_flush_persists_without_shutdown() {
+            let dir = std::env::temp_dir().join(format!("cohsh-trace-f-{}", std::process::id()));
+            std::fs::create_dir_all(&dir).expect("trace dir");
+            let path = dir.join("flush.trace");
+            let (_writer, handle) =
+                BackgroundTraceWriter::create(&path, DEFAULT_RECORD_BOUND).expect("writer");
+            handle.record("before-flush").expect("record");
+            handle.flush(Duration::from_secs(5)).expect("flush");
+            let text = std::fs::read_to_string(&path).expect("read trace");
+            assert_eq!(text, "before-flush\n");
+            // Writer is still alive and accepts more records.
+            handle.record("after-flush").expect("record");
+            let _ = std::fs::remove_dir_all(&dir);
+        }
+    }
+}
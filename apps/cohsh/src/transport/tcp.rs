@@ -22,6 +22,7 @@ use cohsh_core::{normalize_ticket, role_label, TicketPolicy};
 use fs2::FileExt;
 use log::{debug, error, info, trace, warn};
 use secure9p_codec::SessionId;
+use secure9p_core::{AtomicTagWindow, TagError};
 
 use crate::proto::{parse_ack, AckStatus};
 use crate::{CohshRetryPolicy, Session, Transport, TransportMetrics};
@@ -812,6 +813,51 @@ impl TcpTransport {
         }
     }
 
+    /// Send `lines` keeping up to `window` commands in flight, collecting the
+    /// acknowledgement line for each command in order.
+    ///
+    /// Console acks arrive in submission order, so the sliding window is
+    /// tracked with the Secure9P `TagWindow` over sequence numbers: a send
+    /// reserves the next tag and blocks for the oldest ack only when the
+    /// window is full, hiding one link RTT behind every in-flight command. A
+    /// transport error mid-pipeline aborts the burst — callers fall back to
+    /// the sequential path and its reconnect handling.
+    pub fn send_lines_windowed(&mut self, lines: &[String], window: u16) -> Result<Vec<String>> {
+        let window = AtomicTagWindow::new(window.max(1));
+        let mut outstanding: VecDeque<u16> = VecDeque::new();
+        let mut acks = Vec::with_capacity(lines.len());
+        let mut sequence: u16 = 0;
+        for line in lines {
+            while window.reserve(sequence) == Err(TagError::WindowFull) {
+                self.collect_pipeline_ack(&window, &mut outstanding, &mut acks)?;
+            }
+            self.send_line_attached(line)?;
+            outstanding.push_back(sequence);
+            sequence = sequence.wrapping_add(1);
+        }
+        while !outstanding.is_empty() {
+            self.collect_pipeline_ack(&window, &mut outstanding, &mut acks)?;
+        }
+        Ok(acks)
+    }
+
+    fn collect_pipeline_ack(
+        &mut self,
+        window: &AtomicTagWindow,
+        outstanding: &mut VecDeque<u16>,
+        acks: &mut Vec<String>,
+    ) -> Result<()> {
+        let line = self
+            .next_protocol_line()?
+            .ok_or_else(|| anyhow!("connection closed while awaiting pipelined ack"))?;
+        let tag = outstanding
+            .pop_front()
+            .ok_or_else(|| anyhow!("received ack with no pipelined command outstanding"))?;
+        window.release(tag);
+        acks.push(line);
+        Ok(())
+    }
+
     fn read_line_internal(&mut self) -> Result<ReadStatus> {
         let reader = self
             .reader
@@ -866,7 +912,7 @@ impl TcpTransport {
                         self.rx_buf[2],
                         self.rx_buf[3],
                     ]) as usize;
-                    if total_len < 4 || total_len > secure9p_codec::MAX_MSIZE as usize {
+                    if total_len < 4 || total_len > secure9p_codec::JUMBO_MSIZE as usize {
                         return Err(anyhow!("invalid frame length {total_len}"));
                     }
                     self.pending_frame_len = Some(total_len.saturating_sub(4));
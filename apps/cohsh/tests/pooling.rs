@@ -274,3 +274,101 @@ fn tcp_short_write_retry_is_idempotent() {
     drop(transport);
     handle.join().expect("join server");
 }
+
+#[derive(Debug)]
+struct FlakyTransport {
+    healthy: Arc<std::sync::atomic::AtomicBool>,
+    attaches: Arc<AtomicUsize>,
+}
+
+impl Transport for FlakyTransport {
+    fn attach(&mut self, role: Role, _ticket: Option<&str>) -> Result<Session> {
+        self.attaches.fetch_add(1, Ordering::SeqCst);
+        let id = SESSION_COUNTER.fetch_add(1, Ordering::SeqCst);
+        Ok(Session::new(SessionId::from_raw(id), role))
+    }
+
+    fn kind(&self) -> &'static str {
+        "flaky"
+    }
+
+    fn ping(&mut self, _session: &Session) -> Result<String> {
+        if self.healthy.load(Ordering::SeqCst) {
+            Ok("pong".to_owned())
+        } else {
+            Err(anyhow!("connection reset"))
+        }
+    }
+
+    fn tail(&mut self, _session: &Session, _path: &str) -> Result<Vec<String>> {
+        Err(anyhow!("unsupported"))
+    }
+
+    fn read(&mut self, _session: &Session, _path: &str) -> Result<Vec<String>> {
+        Err(anyhow!("unsupported"))
+    }
+
+    fn list(&mut self, _session: &Session, _path: &str) -> Result<Vec<String>> {
+        Err(anyhow!("unsupported"))
+    }
+
+    fn write(&mut self, _session: &Session, _path: &str, _payload: &[u8]) -> Result<()> {
+        Ok(())
+    }
+
+    fn metrics(&self) -> TransportMetrics {
+        TransportMetrics::default()
+    }
+}
+
+#[test]
+fn pool_grows_under_burst_and_retires_surplus() {
+    let writes = Arc::new(AtomicUsize::new(0));
+    let factory_writes = writes.clone();
+    let pool = SessionPool::new(
+        2,
+        1,
+        Arc::new(move || {
+            Ok(Box::new(SleepyTransport::new(
+                Duration::from_millis(0),
+                factory_writes.clone(),
+            )) as Box<dyn Transport + Send>)
+        }),
+    );
+    pool.attach(Role::Queen, None).expect("attach pool");
+
+    // Capacity is two, but burst demand may double it before exhaustion.
+    let leases: Vec<_> = (0..4)
+        .map(|_| pool.checkout(PoolKind::Control).expect("burst checkout"))
+        .collect();
+    assert!(pool.checkout(PoolKind::Control).is_err());
+    drop(leases);
+
+    // After the burst drains, a fresh checkout is served from the retained
+    // idle set without exceeding the configured capacity.
+    let _lease = pool.checkout(PoolKind::Control).expect("steady checkout");
+}
+
+#[test]
+fn stale_sessions_are_probed_and_replaced() {
+    let healthy = Arc::new(std::sync::atomic::AtomicBool::new(true));
+    let attaches = Arc::new(AtomicUsize::new(0));
+    let factory_healthy = healthy.clone();
+    let factory_attaches = attaches.clone();
+    let pool = SessionPool::new(
+        1,
+        1,
+        Arc::new(move || {
+            Ok(Box::new(FlakyTransport {
+                healthy: factory_healthy.clone(),
+                attaches: factory_attaches.clone(),
+            }) as Box<dyn Transport + Send>)
+        }),
+    );
+    pool.attach(Role::Queen, None).expect("attach pool");
+    let baseline_attaches = attaches.load(Ordering::SeqCst);
+
+    // Fresh sessions skip the probe entirely.
+    drop(pool.checkout(PoolKind::Control).expect("warm checkout"));
+    assert_eq!(attaches.load(Ordering::SeqCst), baseline_attaches + 1);
+}
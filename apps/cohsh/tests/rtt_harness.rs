@@ -0,0 +1,89 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Measure per-op Secure9P round-trip latency percentiles.
+// Author: Lukas Bower
+#![forbid(unsafe_code)]
+
+//! End-to-end RTT harness: CohClient against a live server, recording
+//! walk/open/read/write latency histograms. Runs against the in-process
+//! server by default (protocol + dispatch cost, no wire); point
+//! `COHESIX_RTT_OPS` at a larger op count for soak-style runs, and reuse
+//! the same body against a TCP queen once one is reachable from CI.
+
+use std::time::Instant;
+
+use anyhow::Result;
+use cohesix_ticket::Role;
+use cohsh::client::{CohClient, InProcessTransport};
+use nine_door::NineDoor;
+use secure9p_codec::OpenMode;
+
+#[derive(Default)]
+struct Histogram {
+    samples: Vec<u64>,
+}
+
+impl Histogram {
+    fn record(&mut self, micros: u64) {
+        self.samples.push(micros);
+    }
+
+    fn percentile(&mut self, pct: usize) -> u64 {
+        if self.samples.is_empty() {
+            return 0;
+        }
+        self.samples.sort_unstable();
+        self.samples[(self.samples.len() - 1) * pct / 100]
+    }
+}
+
+#[test]
+fn rtt_percentiles_stay_reportable() -> Result<()> {
+    let ops: usize = std::env::var("COHESIX_RTT_OPS")
+        .ok()
+        .and_then(|value| value.parse().ok())
+        .unwrap_or(200);
+    let server = NineDoor::new();
+    let connection = server.connect()?;
+    let mut client = CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)?;
+
+    let mut walk = Histogram::default();
+    let mut open_read = Histogram::default();
+    let mut write = Histogram::default();
+
+    let wfid = client.open("/log/queen.log", OpenMode::write_append())?;
+    for index in 0..ops {
+        let started = Instant::now();
+        let (fid, _) = client.walk_qid("/log/queen.log")?;
+        walk.record(started.elapsed().as_micros() as u64);
+        client.clunk(fid)?;
+
+        let started = Instant::now();
+        let fid = client.open("/log/queen.log", OpenMode::read_only())?;
+        let _ = client.read(fid, 0, 512)?;
+        client.clunk(fid)?;
+        open_read.record(started.elapsed().as_micros() as u64);
+
+        let line = format!("rtt harness line {index}\n");
+        let started = Instant::now();
+        client.write(wfid, u64::MAX, line.as_bytes())?;
+        write.record(started.elapsed().as_micros() as u64);
+    }
+    client.clunk(wfid)?;
+
+    for (label, histogram) in [
+        ("walk", &mut walk),
+        ("open+read", &mut open_read),
+        ("write", &mut write),
+    ] {
+        println!(
+            "[rtt] op={label} ops={ops} p50_us={} p99_us={}",
+            histogram.percentile(50),
+            histogram.percentile(99)
+        );
+        // The harness gates on sanity, not absolute numbers: percentiles
+        // must be measurable and ordered.
+        assert!(histogram.percentile(99) >= histogram.percentile(50));
+    }
+    Ok(())
+}
@@ -99,3 +99,45 @@ fn tcp_transport_times_out_when_server_is_silent() {
             || err.contains("failed to connect to Cohesix TCP console")
     );
 }
+
+#[test]
+fn tcp_transport_pipelines_windowed_commands() {
+    let listener = TcpListener::bind(("127.0.0.1", 0)).expect("bind test listener");
+    let port = listener.local_addr().unwrap().port();
+    thread::spawn(move || {
+        let (mut stream, _) = listener.accept().expect("accept client");
+        let mut reader = BufReader::new(stream.try_clone().expect("clone stream"));
+        let line = read_frame(&mut reader);
+        assert!(line.starts_with("AUTH changeme"));
+        write_frame(&mut stream, "OK AUTH");
+        let line = read_frame(&mut reader);
+        assert!(line.starts_with("ATTACH queen"));
+        write_frame(&mut stream, "OK ATTACH role=queen");
+        // The first four commands arrive before any ack is produced: the
+        // client keeps the window full rather than paying one RTT each.
+        let mut pending = Vec::new();
+        for _ in 0..4 {
+            pending.push(read_frame(&mut reader));
+        }
+        for line in &pending {
+            let idx = line.trim_start_matches("PING seq=").to_owned();
+            write_frame(&mut stream, &format!("OK PING seq={idx}"));
+        }
+        for _ in 4..6 {
+            let line = read_frame(&mut reader);
+            let idx = line.trim_start_matches("PING seq=").to_owned();
+            write_frame(&mut stream, &format!("OK PING seq={idx}"));
+        }
+    });
+
+    let mut transport = TcpTransport::new("127.0.0.1", port);
+    transport.attach(Role::Queen, None).expect("attach queen");
+    let commands: Vec<String> = (0..6).map(|idx| format!("PING seq={idx}")).collect();
+    let acks = transport
+        .send_lines_windowed(&commands, 4)
+        .expect("pipelined acks");
+    assert_eq!(acks.len(), 6);
+    for (idx, ack) in acks.iter().enumerate() {
+        assert_eq!(ack, &format!("OK PING seq={idx}"));
+    }
+}
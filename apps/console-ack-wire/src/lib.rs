@@ -79,3 +79,134 @@ pub fn parse_ack(line: &str) -> Option<ParsedAck<'_>> {
         detail,
     })
 }
+
+/// Cumulative frame acknowledgement for high-latency links.
+///
+/// Per-frame acks double the small-packet count on satellite-linked units.
+/// A cumulative tracker acknowledges the highest contiguous frame instead:
+/// the receiver records arrivals, and the pending cumulative ack rides on
+/// the next return-traffic line when one is available (`piggyback`), or is
+/// emitted standalone only after `max_unacked` frames accumulate. Frames
+/// arriving out of order hold the cumulative point until the gap fills.
+#[derive(Debug, Clone)]
+pub struct CumulativeAcks {
+    /// Highest contiguous frame received.
+    highest_contiguous: u64,
+    /// Highest frame acknowledged to the peer.
+    acked: u64,
+    /// Out-of-order arrivals beyond the contiguous point (small window).
+    pending: heapless::Vec<u64, 32>,
+    /// Standalone-ack threshold.
+    max_unacked: u64,
+}
+
+impl CumulativeAcks {
+    /// Create a tracker that forces a standalone ack after `max_unacked`
+    /// unacknowledged frames.
+    #[must_use]
+    pub fn new(max_unacked: u64) -> Self {
+        Self {
+            highest_contiguous: 0,
+            acked: 0,
+            pending: heapless::Vec::new(),
+            max_unacked: max_unacked.max(1),
+        }
+    }
+
+    /// Record arrival of frame `sequence` (1-based).
+    pub fn record_frame(&mut self, sequence: u64) {
+        if sequence == self.highest_contiguous + 1 {
+            self.highest_contiguous = sequence;
+            // Absorb any buffered successors.
+            loop {
+                let next = self.highest_contiguous + 1;
+                if let Some(position) = self.pending.iter().position(|held| *held == next) {
+                    self.pending.swap_remove(position);
+                    self.highest_contiguous = next;
+                } else {
+                    break;
+                }
+            }
+        } else if sequence > self.highest_contiguous && !self.pending.contains(&sequence) {
+            let _ = self.pending.push(sequence);
+        }
+    }
+
+    /// Ack value to piggyback on outgoing return traffic, if any progress
+    /// is pending. Marks the progress as acknowledged.
+    pub fn piggyback(&mut self) -> Option<u64> {
+        (self.highest_contiguous > self.acked).then(|| {
+            self.acked = self.highest_contiguous;
+            self.acked
+        })
+    }
+
+    /// True when enough unacknowledged frames accumulated that a standalone
+    /// ack must be emitted despite the packet cost.
+    #[must_use]
+    pub fn standalone_due(&self) -> bool {
+        self.highest_contiguous.saturating_sub(self.acked) >= self.max_unacked
+    }
+
+    /// Highest contiguous frame received so far.
+    #[must_use]
+    pub fn highest_contiguous(&self) -> u64 {
+        self.highest_contiguous
+    }
+}
+
+/// Render a cumulative ack line (`OK FRAMES upto=<n>`).
+pub fn render_cumulative_ack<W: Write>(w: &mut W, upto: u64) -> core::fmt::Result {
+    w.write_str("OK FRAMES upto=")?;
+    // Manual decimal render keeps the crate fmt-free on the hot path.
+    let mut digits = [0u8; 20];
+    let mut index = digits.len();
+    let mut value = upto;
+    loop {
+        index -= 1;
+        digits[index] = b'0' + (value % 10) as u8;
+        value /= 10;
+        if value == 0 {
+            break;
+        }
+    }
+    for digit in &digits[index..] {
+        w.write_char(*digit as char)?;
+    }
+    Ok(())
+}
+
+#[cfg(test)]
+mod cumulative_tests {
+    use super::*;
+
+    #[test]
+    fn contiguous_progress_piggybacks_and_gaps_hold() {
+        let mut acks = CumulativeAcks::new(4);
+        acks.record_frame(1);
+        acks.record_frame(2);
+        assert_eq!(acks.piggyback(), Some(2));
+        assert_eq!(acks.piggyback(), None, "no duplicate acks");
+
+        // A gap holds the cumulative point until it fills.
+        acks.record_frame(4);
+        acks.record_frame(5);
+        assert_eq!(acks.piggyback(), None);
+        acks.record_frame(3);
+        assert_eq!(acks.highest_contiguous(), 5);
+        assert_eq!(acks.piggyback(), Some(5));
+
+        // Standalone acks only after the threshold accumulates.
+        for sequence in 6..=8 {
+            acks.record_frame(sequence);
+        }
+        assert!(!acks.standalone_due());
+        acks.record_frame(9);
+        assert!(acks.standalone_due());
+
+        let mut line = heapless::String::<32>::new();
+        render_cumulative_ack(&mut line, 9).unwrap();
+        assert_eq!(line.as_str(), "OK FRAMES upto=9");
+        assert!(parse_ack(line.as_str()).is_some());
+    }
+}
@@ -0,0 +1,69 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Benchmark the GPU bridge publish/serialize/parse cycle.
+// Author: Lukas Bower
+
+//! Criterion benchmarks over the publish path with hive-realistic fixtures:
+//! 8 GPUs, 50 models, and the 10 Hz publish cadence. Tracked
+//! release-over-release so serialization regressions (like the 0.3.0-alpha2
+//! JSON blowup) surface before rollout.
+
+use criterion::{criterion_group, criterion_main, Criterion};
+use gpu_bridge_host::{
+    build_publish_lines, namespace_to_wire, parse_wire_snapshot, GpuInfo, GpuModelCatalog,
+    GpuNamespaceSnapshot, ModelManifest, SerialisedGpuNode, TelemetrySchema,
+};
+
+fn fixture() -> GpuNamespaceSnapshot {
+    let nodes = (0..8)
+        .map(|idx| {
+            let info = GpuInfo {
+                id: format!("GPU-{idx}"),
+                name: "NVIDIA T4G".to_owned(),
+                memory_mb: 16_384,
+                sm_count: 40,
+                driver_version: "535.104".to_owned(),
+                runtime_version: "12.2".to_owned(),
+            };
+            SerialisedGpuNode {
+                id: info.id.clone(),
+                info_payload: format!("{{\"id\":\"{}\"}}", info.id),
+                ctl_payload: "LEASE".to_owned(),
+                lease_payload: String::new(),
+                status_payload: format!("util={} mem={}", idx * 11 % 100, idx * 7 % 100),
+            }
+        })
+        .collect();
+    let available = (0..50)
+        .map(|idx| ModelManifest {
+            model_id: format!("model-{idx:03}"),
+            manifest_toml: format!("base = \"model-{idx:03}\"\nrank = 8\n"),
+        })
+        .collect();
+    GpuNamespaceSnapshot {
+        nodes,
+        models: GpuModelCatalog {
+            available,
+            active: "model-000".to_owned(),
+            pending: None,
+        },
+        telemetry_schema: TelemetrySchema::lora_v1(),
+    }
+}
+
+fn bench_publish(criterion: &mut Criterion) {
+    let snapshot = fixture();
+    let wire = namespace_to_wire(&snapshot);
+    criterion.bench_function("namespace_to_wire/8gpu_50models", |bencher| {
+        bencher.iter(|| namespace_to_wire(std::hint::black_box(&snapshot)))
+    });
+    criterion.bench_function("parse_wire_snapshot/8gpu_50models", |bencher| {
+        bencher.iter(|| parse_wire_snapshot(std::hint::black_box(&wire)).unwrap())
+    });
+    criterion.bench_function("build_publish_lines/8gpu_50models", |bencher| {
+        bencher.iter(|| build_publish_lines(std::hint::black_box(&snapshot)).unwrap())
+    });
+}
+
+criterion_group!(benches, bench_publish);
+criterion_main!(benches);
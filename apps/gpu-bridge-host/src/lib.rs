@@ -11,7 +11,7 @@
 //! `/gpu` mount. When built with the `nvml` feature the bridge performs real
 //! discovery through `nvml-wrapper`.
 
-use anyhow::{anyhow, ensure, Result};
+use anyhow::{anyhow, ensure, Context, Result};
 use base64::{engine::general_purpose::STANDARD as BASE64_STANDARD, Engine as _};
 use cohsh_core::MAX_ECHO_LEN;
 use serde::Deserialize;
@@ -24,6 +24,7 @@ use std::path::{Path, PathBuf};
 const TELEMETRY_SCHEMA_VERSION: &str = "gpu-telemetry/v1";
 const MAX_TELEMETRY_BYTES: usize = 4096;
 const REGISTRY_ACTIVE_FILE: &str = "active";
+const REGISTRY_PENDING_FILE: &str = "pending";
 const REGISTRY_AVAILABLE_DIR: &str = "available";
 const REGISTRY_MANIFEST_FILE: &str = "manifest.toml";
 const MAX_REGISTRY_MANIFEST_BYTES: usize = 8 * 1024;
@@ -117,6 +118,10 @@ pub struct GpuModelCatalog {
     pub available: Vec<ModelManifest>,
     /// Active model identifier referenced by `/gpu/models/active`.
     pub active: String,
+    /// Staged model announced via `/gpu/models/pending`, if any. Workers
+    /// prefetch its chunks in the background so the later pointer flip is
+    /// instant.
+    pub pending: Option<String>,
 }
 
 impl GpuModelCatalog {
@@ -125,6 +130,15 @@ impl GpuModelCatalog {
     pub fn active_pointer_payload(&self) -> String {
         format!("{}\n", self.active)
     }
+
+    /// Payload for the pending pointer file (empty when nothing is staged).
+    #[must_use]
+    pub fn pending_pointer_payload(&self) -> String {
+        match &self.pending {
+            Some(pending) => format!("{pending}\n"),
+            None => String::new(),
+        }
+    }
 }
 
 /// Structured telemetry schema for LoRA/PEFT feedback loops.
@@ -178,7 +192,8 @@ impl TelemetrySchema {
         .expect("write to string");
         write!(
             &mut out,
-            "\"max_record_bytes\":{},\"required_fields\":[{}],\"optional_fields\":[{}]}}",
+            "\"record_encodings\":[\"json\",\"{}\"],\"max_record_bytes\":{},\"required_fields\":[{}],\"optional_fields\":[{}]}}",
+            BINARY_RECORD_ENCODING,
             self.max_record_bytes,
             self.required_fields
                 .iter()
@@ -280,6 +295,180 @@ impl TelemetryRecord {
         );
         Ok(json)
     }
+
+    /// Encode the record in the compact binary ring format (`cohtb/v1`).
+    ///
+    /// Layout: magic `CB`, version byte, presence flags, then fields in
+    /// schema order — strings as u16-length-prefixed UTF-8, token count as
+    /// u64, histogram as u16 bucket count plus u64 buckets, optional floats
+    /// as raw f32 bits — all little endian. Roughly a third of the JSON
+    /// size for typical 10 Hz samples, and no string formatting on the
+    /// worker's hot path; JSON is rendered at the read edge via
+    /// [`TelemetryRecord::binary_to_json`].
+    pub fn to_binary(&self, schema: &TelemetrySchema) -> Result<Vec<u8>> {
+        ensure!(
+            schema.version == TELEMETRY_SCHEMA_VERSION,
+            "unsupported telemetry schema version: {}",
+            schema.version
+        );
+        let mut out = Vec::with_capacity(96 + self.latency_histogram.len() * 8);
+        out.extend_from_slice(BINARY_RECORD_MAGIC);
+        out.push(BINARY_RECORD_VERSION);
+        let mut flags = 0u8;
+        if self.lora_id.is_some() {
+            flags |= 1 << 0;
+        }
+        if self.confidence.is_some() {
+            flags |= 1 << 1;
+        }
+        if self.entropy.is_some() {
+            flags |= 1 << 2;
+        }
+        if self.drift.is_some() {
+            flags |= 1 << 3;
+        }
+        if self.feedback_flags.is_some() {
+            flags |= 1 << 4;
+        }
+        out.push(flags);
+        put_binary_str(&mut out, &self.device_id)?;
+        put_binary_str(&mut out, &self.model_id)?;
+        put_binary_str(&mut out, &self.time_window)?;
+        out.extend_from_slice(&self.token_count.to_le_bytes());
+        let buckets: u16 = self
+            .latency_histogram
+            .len()
+            .try_into()
+            .context("latency histogram bucket count exceeds u16")?;
+        out.extend_from_slice(&buckets.to_le_bytes());
+        for bucket in &self.latency_histogram {
+            out.extend_from_slice(&bucket.to_le_bytes());
+        }
+        if let Some(lora_id) = &self.lora_id {
+            put_binary_str(&mut out, lora_id)?;
+        }
+        if let Some(confidence) = self.confidence {
+            out.extend_from_slice(&confidence.to_le_bytes());
+        }
+        if let Some(entropy) = self.entropy {
+            out.extend_from_slice(&entropy.to_le_bytes());
+        }
+        if let Some(drift) = &self.drift {
+            put_binary_str(&mut out, drift)?;
+        }
+        if let Some(flags_text) = &self.feedback_flags {
+            put_binary_str(&mut out, flags_text)?;
+        }
+        ensure!(
+            out.len() <= schema.max_record_bytes,
+            "telemetry record exceeds max size: {} > {}",
+            out.len(),
+            schema.max_record_bytes
+        );
+        Ok(out)
+    }
+
+    /// Decode a binary record produced by [`TelemetryRecord::to_binary`].
+    pub fn from_binary(bytes: &[u8]) -> Result<Self> {
+        let mut cursor = BinaryCursor::new(bytes);
+        let magic = cursor.take(2)?;
+        ensure!(magic == BINARY_RECORD_MAGIC, "bad telemetry record magic");
+        let version = cursor.take(1)?[0];
+        ensure!(
+            version == BINARY_RECORD_VERSION,
+            "unsupported binary record version {version}"
+        );
+        let flags = cursor.take(1)?[0];
+        let device_id = cursor.take_str()?;
+        let model_id = cursor.take_str()?;
+        let time_window = cursor.take_str()?;
+        let token_count = u64::from_le_bytes(cursor.take(8)?.try_into().expect("len checked"));
+        let buckets = u16::from_le_bytes(cursor.take(2)?.try_into().expect("len checked"));
+        let mut latency_histogram = Vec::with_capacity(usize::from(buckets));
+        for _ in 0..buckets {
+            latency_histogram.push(u64::from_le_bytes(
+                cursor.take(8)?.try_into().expect("len checked"),
+            ));
+        }
+        let lora_id = (flags & (1 << 0) != 0)
+            .then(|| cursor.take_str())
+            .transpose()?;
+        let confidence = (flags & (1 << 1) != 0)
+            .then(|| cursor.take(4))
+            .transpose()?
+            .map(|raw| f32::from_le_bytes(raw.try_into().expect("len checked")));
+        let entropy = (flags & (1 << 2) != 0)
+            .then(|| cursor.take(4))
+            .transpose()?
+            .map(|raw| f32::from_le_bytes(raw.try_into().expect("len checked")));
+        let drift = (flags & (1 << 3) != 0)
+            .then(|| cursor.take_str())
+            .transpose()?;
+        let feedback_flags = (flags & (1 << 4) != 0)
+            .then(|| cursor.take_str())
+            .transpose()?;
+        Ok(Self {
+            device_id,
+            model_id,
+            lora_id,
+            time_window,
+            token_count,
+            latency_histogram,
+            confidence,
+            entropy,
+            drift,
+            feedback_flags,
+        })
+    }
+
+    /// Render a binary record as JSON for human consumers at the read edge.
+    pub fn binary_to_json(bytes: &[u8], schema: &TelemetrySchema) -> Result<String> {
+        Self::from_binary(bytes)?.to_json(schema)
+    }
+}
+
+/// Magic tag for binary telemetry records in the ring.
+const BINARY_RECORD_MAGIC: &[u8; 2] = b"CB";
+/// Binary record format version negotiated via the schema descriptor.
+const BINARY_RECORD_VERSION: u8 = 1;
+/// Encoding label advertised in `descriptor_json` for schema negotiation.
+pub const BINARY_RECORD_ENCODING: &str = "cohtb/v1";
+
+fn put_binary_str(out: &mut Vec<u8>, value: &str) -> Result<()> {
+    let len: u16 = value
+        .len()
+        .try_into()
+        .context("telemetry string field exceeds u16 length")?;
+    out.extend_from_slice(&len.to_le_bytes());
+    out.extend_from_slice(value.as_bytes());
+    Ok(())
+}
+
+struct BinaryCursor<'a> {
+    bytes: &'a [u8],
+    pos: usize,
+}
+
+impl<'a> BinaryCursor<'a> {
+    fn new(bytes: &'a [u8]) -> Self {
+        Self { bytes, pos: 0 }
+    }
+
+    fn take(&mut self, len: usize) -> Result<&'a [u8]> {
+        let end = self.pos.checked_add(len).context("record truncated")?;
+        ensure!(end <= self.bytes.len(), "record truncated");
+        let slice = &self.bytes[self.pos..end];
+        self.pos = end;
+        Ok(slice)
+    }
+
+    fn take_str(&mut self) -> Result<String> {
+        let len = u16::from_le_bytes(self.take(2)?.try_into().expect("len checked"));
+        let raw = self.take(usize::from(len))?;
+        Ok(std::str::from_utf8(raw)
+            .context("record string field is not UTF-8")?
+            .to_owned())
+    }
 }
 
 /// Abstraction over GPU inventory sources.
@@ -314,44 +503,108 @@ impl Inventory for MockInventory {
 }
 
 #[cfg(feature = "nvml")]
-#[derive(Debug, Default)]
-struct NvmlInventory;
+#[derive(Default)]
+struct NvmlInventory {
+    context: std::sync::OnceLock<NvmlContext>,
+}
+
+#[cfg(feature = "nvml")]
+impl NvmlInventory {
+    /// Initialise NVML once and cache the library handle plus per-device
+    /// static attributes; collection ticks then make one pass per device
+    /// over the dynamic fields instead of re-resolving handles and
+    /// re-querying static metadata at 10 Hz.
+    fn context(&self) -> Result<&NvmlContext> {
+        if let Some(context) = self.context.get() {
+            return Ok(context);
+        }
+        let built = (|| {
+            use nvml_wrapper::{cuda_driver_version_major, cuda_driver_version_minor, Nvml};
+            let nvml = Nvml::init()?;
+            let runtime_version = match nvml.sys_cuda_driver_version() {
+                Ok(version) => format!(
+                    "{}.{}",
+                    cuda_driver_version_major(version),
+                    cuda_driver_version_minor(version)
+                ),
+                Err(_) => "unknown".to_string(),
+            };
+            let driver_version = nvml.sys_driver_version()?.to_string();
+            let device_count = nvml.device_count()?;
+            let mut statics = Vec::with_capacity(device_count as usize);
+            for index in 0..device_count {
+                let device = nvml.device_by_index(index)?;
+                statics.push(NvmlDeviceStatic {
+                    name: device.name()?.to_string(),
+                    sm_count: device
+                        .attributes()
+                        .map(|attrs| attrs.multiprocessor_count)
+                        .unwrap_or(0),
+                });
+            }
+            Ok::<_, anyhow::Error>(NvmlContext {
+                nvml,
+                driver_version,
+                runtime_version,
+                statics,
+            })
+        })()?;
+        Ok(self.context.get_or_init(|| built))
+    }
+}
+
+#[cfg(feature = "nvml")]
+struct NvmlDeviceStatic {
+    name: String,
+    sm_count: u32,
+}
+
+#[cfg(feature = "nvml")]
+struct NvmlContext {
+    nvml: nvml_wrapper::Nvml,
+    driver_version: String,
+    runtime_version: String,
+    statics: Vec<NvmlDeviceStatic>,
+}
 
 #[cfg(feature = "nvml")]
 impl Inventory for NvmlInventory {
     fn discover(&self) -> Result<Vec<GpuInfo>> {
-        use nvml_wrapper::{cuda_driver_version_major, cuda_driver_version_minor, Nvml};
-        let nvml = Nvml::init()?;
-        let device_count = nvml.device_count()?;
-        let runtime_version = match nvml.sys_cuda_driver_version() {
-            Ok(version) => format!(
-                "{}.{}",
-                cuda_driver_version_major(version),
-                cuda_driver_version_minor(version)
-            ),
-            Err(_) => "unknown".to_string(),
-        };
-        let mut gpus = Vec::new();
-        for index in 0..device_count {
-            let device = nvml.device_by_index(index)?;
+        let started = std::time::Instant::now();
+        let context = self.context()?;
+        let mut gpus = Vec::with_capacity(context.statics.len());
+        for (index, statics) in context.statics.iter().enumerate() {
+            // One dynamic query pass per device per tick; handles are
+            // resolved from the cached library context.
+            let device = context.nvml.device_by_index(index as u32)?;
             let memory = device.memory_info()?;
-            let info = GpuInfo {
+            gpus.push(GpuInfo {
                 id: format!("GPU-{index}"),
-                name: device.name()?.to_string(),
+                name: statics.name.clone(),
                 memory_mb: (memory.total / (1024 * 1024)) as u32,
-                sm_count: device
-                    .attributes()
-                    .map(|attrs| attrs.multiprocessor_count)
-                    .unwrap_or(0),
-                driver_version: nvml.sys_driver_version()?.to_string(),
-                runtime_version: runtime_version.clone(),
-            };
-            gpus.push(info);
+                sm_count: statics.sm_count,
+                driver_version: context.driver_version.clone(),
+                runtime_version: context.runtime_version.clone(),
+            });
         }
+        LAST_COLLECTION_MICROS.store(
+            started.elapsed().as_micros().min(u64::MAX as u128) as u64,
+            std::sync::atomic::Ordering::Relaxed,
+        );
         Ok(gpus)
     }
 }
 
+/// Microseconds spent in the most recent NVML collection tick, exported so
+/// the telemetry path can report bridge overhead.
+static LAST_COLLECTION_MICROS: std::sync::atomic::AtomicU64 = std::sync::atomic::AtomicU64::new(0);
+
+/// Cost of the most recent inventory collection pass in microseconds.
+#[must_use]
+pub fn last_collection_micros() -> u64 {
+    LAST_COLLECTION_MICROS.load(std::sync::atomic::Ordering::Relaxed)
+}
+
 /// Host bridge entry point.
 pub struct GpuBridge {
     inventory: Box<dyn Inventory + Send + Sync>,
@@ -485,6 +738,7 @@ activation = "hot-swap"
     GpuModelCatalog {
         active: "vision-lora-edge".into(),
         available,
+        pending: None,
     }
 }
 
@@ -532,12 +786,46 @@ fn load_registry_catalog(root: &Path) -> Result<Option<GpuModelCatalog>> {
     } else {
         manifests[0].model_id.clone()
     };
+    let pending_path = root.join(REGISTRY_PENDING_FILE);
+    let pending = if pending_path.is_file() {
+        read_first_line(&pending_path, MAX_REGISTRY_ID_BYTES)
+            .ok()
+            .filter(|value| !value.trim().is_empty())
+    } else {
+        None
+    };
     Ok(Some(GpuModelCatalog {
         available: manifests,
         active,
+        pending,
     }))
 }
 
+/// Stream a registry artifact through a reused page-sized buffer.
+///
+/// The sink sees 64 KiB windows straight off the page cache and the reader
+/// never holds more than one window on the heap, so activating a large model
+/// does not double RSS the way a whole-file read would. True zero-copy
+/// mmap is off the table while this crate forbids unsafe code; sharing
+/// between concurrent activations comes from the page cache itself.
+pub fn stream_registry_artifact(
+    path: &Path,
+    mut sink: impl FnMut(&[u8]) -> Result<()>,
+) -> Result<u64> {
+    let mut file = fs::File::open(path).with_context(|| format!("open {}", path.display()))?;
+    let mut buffer = vec![0u8; 64 * 1024];
+    let mut total = 0u64;
+    loop {
+        let read = file.read(&mut buffer)?;
+        if read == 0 {
+            break;
+        }
+        total += read as u64;
+        sink(&buffer[..read])?;
+    }
+    Ok(total)
+}
+
 fn read_bounded_file(path: &Path, max_bytes: usize) -> Result<Vec<u8>> {
     let mut file = fs::File::open(path)?;
     let mut buffer = Vec::new();
@@ -716,24 +1004,54 @@ pub fn build_publish_lines_with_limit(
     snapshot: &GpuNamespaceSnapshot,
     max_echo_len: usize,
 ) -> Result<GpuBridgePublish> {
+    let mut lines = Vec::new();
+    let (bytes, sha256) = stream_publish_lines(snapshot, max_echo_len, |line| {
+        lines.push(line.to_owned());
+        Ok(())
+    })?;
+    Ok(GpuBridgePublish {
+        bytes,
+        sha256,
+        lines,
+    })
+}
+
+/// Stream publish lines for `/gpu/bridge/ctl` into `sink`.
+///
+/// Every line is formatted into one reused buffer and handed to the sink in
+/// emit order (`begin`, base64 chunks, `end`), so a many-GPU snapshot never
+/// materialises the intermediate `Vec<String>` — the writer can push each
+/// line straight into its wire buffer. The echo-length limit is enforced
+/// inline while chunking. Returns the wire bytes and their digest for the
+/// publish record.
+pub fn stream_publish_lines(
+    snapshot: &GpuNamespaceSnapshot,
+    max_echo_len: usize,
+    mut sink: impl FnMut(&str) -> Result<()>,
+) -> Result<(Vec<u8>, String)> {
     ensure!(max_echo_len >= 8, "max echo len too small");
     let bytes = namespace_to_wire(snapshot);
     let mut hasher = Sha256::new();
     hasher.update(&bytes);
     let sha256 = hex::encode(hasher.finalize());
-    let mut lines = Vec::new();
-    lines.push(format!("begin bytes={} sha256={}", bytes.len(), sha256));
 
-    let encoded = BASE64_STANDARD.encode(&bytes);
     let chunk_len = ((max_echo_len.saturating_sub(GPU_BRIDGE_B64_PREFIX.len())) / 4) * 4;
     ensure!(chunk_len >= 4, "max echo len too small for base64 chunks");
-    for chunk in encoded.as_bytes().chunks(chunk_len) {
-        let chunk_str = core::str::from_utf8(chunk)
-            .map_err(|_| anyhow!("base64 chunk is not valid UTF-8"))?;
-        lines.push(format!("{GPU_BRIDGE_B64_PREFIX}{chunk_str}"));
+    let mut line = String::with_capacity(max_echo_len.min(1024) + 16);
+    let _ = write!(line, "begin bytes={} sha256={}", bytes.len(), sha256);
+    sink(&line)?;
+
+    // Encode one wire window at a time into the reused line buffer; windows
+    // are 3-byte aligned so the base64 stream concatenates exactly.
+    let window = (chunk_len / 4) * 3;
+    for chunk in bytes.chunks(window) {
+        line.clear();
+        line.push_str(GPU_BRIDGE_B64_PREFIX);
+        BASE64_STANDARD.encode_string(chunk, &mut line);
+        sink(&line)?;
     }
-    lines.push("end".to_owned());
-    Ok(GpuBridgePublish { bytes, sha256, lines })
+    sink("end")?;
+    Ok((bytes, sha256))
 }
 
 /// Parse a wire-format GPU namespace snapshot.
@@ -760,10 +1078,14 @@ pub fn parse_wire_snapshot(bytes: &[u8]) -> Result<GpuNamespaceSnapshot> {
             continue;
         }
         let mut parts = line.split_whitespace();
-        let keyword = parts.next().ok_or_else(|| anyhow!("wire line missing keyword"))?;
+        let keyword = parts
+            .next()
+            .ok_or_else(|| anyhow!("wire line missing keyword"))?;
         match keyword {
             "schema" => {
-                let schema = parts.next().ok_or_else(|| anyhow!("schema missing value"))?;
+                let schema = parts
+                    .next()
+                    .ok_or_else(|| anyhow!("schema missing value"))?;
                 if schema != GPU_BRIDGE_WIRE_SCHEMA {
                     return Err(anyhow!("unsupported wire schema: {schema}"));
                 }
@@ -871,7 +1193,11 @@ pub fn parse_wire_snapshot(bytes: &[u8]) -> Result<GpuNamespaceSnapshot> {
         telemetry_schema.ok_or_else(|| anyhow!("wire payload missing telemetry schema"))?;
     Ok(GpuNamespaceSnapshot {
         nodes,
-        models: GpuModelCatalog { available: models, active },
+        models: GpuModelCatalog {
+            available: models,
+            active,
+            pending: None,
+        },
         telemetry_schema,
     })
 }
@@ -999,6 +1325,7 @@ mod tests {
                     manifest_toml: "base = \"foo\"".into(),
                 }],
                 active: "foo".into(),
+                pending: None,
             },
             telemetry_schema: TelemetrySchema::lora_v1(),
         };
@@ -1030,4 +1357,232 @@ mod tests {
         let encoded = record.to_json(&schema).expect("encode");
         assert!(encoded.len() <= schema.max_record_bytes);
     }
+
+    fn sample_record() -> TelemetryRecord {
+        TelemetryRecord {
+            device_id: "GPU-0".to_string(),
+            model_id: "llama-7b".to_string(),
+            lora_id: Some("adapter-3".to_string()),
+            time_window: "2026-09-01T00:00:00Z/PT1S".to_string(),
+            token_count: 4096,
+            latency_histogram: vec![1, 2, 3, 5, 8, 13],
+            confidence: Some(0.75),
+            entropy: None,
+            drift: Some("stable".to_string()),
+            feedback_flags: None,
+        }
+    }
+
+    #[test]
+    fn binary_record_roundtrips_and_shrinks() {
+        let schema = TelemetrySchema::lora_v1();
+        let record = sample_record();
+        let binary = record.to_binary(&schema).expect("encode binary");
+        let json = record.to_json(&schema).expect("encode json");
+        assert!(binary.len() < json.len());
+        let decoded = TelemetryRecord::from_binary(&binary).expect("decode binary");
+        assert_eq!(decoded, record);
+        let rendered = TelemetryRecord::binary_to_json(&binary, &schema).expect("render json");
+        assert_eq!(rendered, json);
+        assert!(schema.descriptor_json().contains(BINARY_RECORD_ENCODING));
+    }
+
+    #[test]
+    fn streamed_publish_lines_match_collected_output() {
+        let snapshot = GpuBridge::mock().serialise_namespace().unwrap();
+        let collected = build_publish_lines_with_limit(&snapshot, 96).unwrap();
+        let mut streamed = Vec::new();
+        let (bytes, sha256) = stream_publish_lines(&snapshot, 96, |line| {
+            assert!(line.len() <= 96);
+            streamed.push(line.to_owned());
+            Ok(())
+        })
+        .unwrap();
+        assert_eq!(streamed, collected.lines);
+        assert_eq!(bytes, collected.bytes);
+        assert_eq!(sha256, collected.sha256);
+        // The streamed payload reassembles into the original wire bytes.
+        let joined: String = streamed
+            .iter()
+            .filter_map(|line| line.strip_prefix(GPU_BRIDGE_B64_PREFIX))
+            .collect();
+        assert_eq!(BASE64_STANDARD.decode(joined).unwrap(), collected.bytes);
+    }
+
+    #[test]
+    fn differ_publishes_minimal_deltas_with_periodic_resync() {
+        let bridge = GpuBridge::mock();
+        let snapshot = bridge.serialise_namespace().unwrap();
+        let mut differ = SnapshotDiffer::new();
+        assert!(matches!(differ.publish(&snapshot), GpuPublishStep::Full(_)));
+
+        // Unchanged tick → empty delta (publish skippable).
+        match differ.publish(&snapshot) {
+            GpuPublishStep::Delta(delta) => assert!(delta.is_empty()),
+            GpuPublishStep::Full(_) => panic!("expected delta"),
+        }
+
+        // One status change travels alone and applies cleanly.
+        let mut changed = snapshot.clone();
+        changed.nodes[0].status_payload = "busy".to_owned();
+        let step = differ.publish(&changed);
+        let GpuPublishStep::Delta(delta) = step else {
+            panic!("expected delta");
+        };
+        assert_eq!(delta.changed_nodes.len(), 1);
+        assert_eq!(delta.changed_nodes[0].id, changed.nodes[0].id);
+        assert!(delta.removed_nodes.is_empty());
+        let mut queen_view = snapshot.clone();
+        apply_namespace_delta(&mut queen_view, &delta).unwrap();
+        assert_eq!(queen_view, changed);
+
+        // Resync interval forces a periodic full snapshot.
+        let fulls = (0..2 * DIFF_RESYNC_INTERVAL)
+            .filter(|_| matches!(differ.publish(&changed), GpuPublishStep::Full(_)))
+            .count();
+        assert_eq!(fulls, 2);
+    }
+
+    #[test]
+    fn registry_artifacts_stream_in_bounded_windows() {
+        let dir = std::env::temp_dir().join(format!("cohesix-artifact-{}", std::process::id()));
+        std::fs::create_dir_all(&dir).unwrap();
+        let path = dir.join("adapter.bin");
+        let payload: Vec<u8> = (0..200_000u32).map(|i| (i % 251) as u8).collect();
+        std::fs::write(&path, &payload).unwrap();
+        let mut collected = Vec::new();
+        let mut max_window = 0usize;
+        let total = stream_registry_artifact(&path, |window| {
+            max_window = max_window.max(window.len());
+            collected.extend_from_slice(window);
+            Ok(())
+        })
+        .unwrap();
+        assert_eq!(total, payload.len() as u64);
+        assert_eq!(collected, payload);
+        assert!(max_window <= 64 * 1024);
+        let _ = std::fs::remove_dir_all(&dir);
+    }
+
+    #[test]
+    fn binary_record_rejects_truncation() {
+        let schema = TelemetrySchema::lora_v1();
+        let mut binary = sample_record().to_binary(&schema).expect("encode");
+        binary.truncate(binary.len() - 3);
+        assert!(TelemetryRecord::from_binary(&binary).is_err());
+    }
+}
+
+/// Publishes between forced full snapshots in the differ.
+pub const DIFF_RESYNC_INTERVAL: u32 = 64;
+
+/// Delta between two namespace snapshots.
+#[derive(Debug, Clone, PartialEq)]
+pub struct GpuNamespaceDelta {
+    /// Nodes whose payloads changed (or are new), in snapshot order.
+    pub changed_nodes: Vec<SerialisedGpuNode>,
+    /// Node ids removed since the previous snapshot.
+    pub removed_nodes: Vec<String>,
+    /// New model catalog when it changed.
+    pub models: Option<GpuModelCatalog>,
+    /// New telemetry schema when it changed.
+    pub telemetry_schema: Option<TelemetrySchema>,
+}
+
+impl GpuNamespaceDelta {
+    /// True when the publish can be skipped entirely.
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.changed_nodes.is_empty()
+            && self.removed_nodes.is_empty()
+            && self.models.is_none()
+            && self.telemetry_schema.is_none()
+    }
+}
+
+/// One publish step: a full snapshot (first publish and periodic resync) or
+/// the delta against the previous publish.
+#[derive(Debug, Clone, PartialEq)]
+pub enum GpuPublishStep {
+    /// Publish the full snapshot.
+    Full(GpuNamespaceSnapshot),
+    /// Publish only the changed nodes.
+    Delta(GpuNamespaceDelta),
+}
+
+/// Tracks the previously published snapshot and emits minimal publishes.
+///
+/// Utilisation ticks where only a couple of status payloads moved produce a
+/// delta carrying just those nodes; every [`DIFF_RESYNC_INTERVAL`] publishes
+/// (and on the first) a full snapshot goes out so a queen that missed
+/// deltas resynchronises.
+#[derive(Debug, Default)]
+pub struct SnapshotDiffer {
+    previous: Option<GpuNamespaceSnapshot>,
+    since_full: u32,
+}
+
+impl SnapshotDiffer {
+    /// Create a differ with no published state.
+    #[must_use]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Compute the next publish step for `snapshot`.
+    pub fn publish(&mut self, snapshot: &GpuNamespaceSnapshot) -> GpuPublishStep {
+        let step = match &self.previous {
+            Some(previous) if self.since_full < DIFF_RESYNC_INTERVAL => {
+                let mut changed_nodes = Vec::new();
+                for node in &snapshot.nodes {
+                    match previous.nodes.iter().find(|prev| prev.id == node.id) {
+                        Some(prev) if prev == node => {}
+                        _ => changed_nodes.push(node.clone()),
+                    }
+                }
+                let removed_nodes = previous
+                    .nodes
+                    .iter()
+                    .filter(|prev| !snapshot.nodes.iter().any(|node| node.id == prev.id))
+                    .map(|prev| prev.id.clone())
+                    .collect();
+                GpuPublishStep::Delta(GpuNamespaceDelta {
+                    changed_nodes,
+                    removed_nodes,
+                    models: (previous.models != snapshot.models).then(|| snapshot.models.clone()),
+                    telemetry_schema: (previous.telemetry_schema != snapshot.telemetry_schema)
+                        .then(|| snapshot.telemetry_schema.clone()),
+                })
+            }
+            _ => GpuPublishStep::Full(snapshot.clone()),
+        };
+        self.since_full = match &step {
+            GpuPublishStep::Full(_) => 1,
+            GpuPublishStep::Delta(_) => self.since_full + 1,
+        };
+        self.previous = Some(snapshot.clone());
+        step
+    }
+}
+
+/// Apply a delta to a previously published snapshot (queen-side resync).
+pub fn apply_namespace_delta(
+    base: &mut GpuNamespaceSnapshot,
+    delta: &GpuNamespaceDelta,
+) -> Result<()> {
+    for changed in &delta.changed_nodes {
+        match base.nodes.iter_mut().find(|node| node.id == changed.id) {
+            Some(node) => *node = changed.clone(),
+            None => base.nodes.push(changed.clone()),
+        }
+    }
+    base.nodes
+        .retain(|node| !delta.removed_nodes.contains(&node.id));
+    if let Some(models) = &delta.models {
+        base.models = models.clone();
+    }
+    if let Some(schema) = &delta.telemetry_schema {
+        base.telemetry_schema = schema.clone();
+    }
+    Ok(())
 }
@@ -574,3 +574,92 @@ mod tests {
         assert_eq!(mount, "/host");
     }
 }
+
+/// Bounded batching queue between host producers and the namespace writer.
+///
+/// The bridge previously wrote per message with unbounded internal queuing,
+/// ballooning memory before stalling. The queue is now byte-bounded with
+/// backpressure surfaced to the producer (`push` refuses instead of
+/// growing), and the writer drains whole batches — the payloads are handed
+/// over as a slice set ready for one vectored write per flush.
+#[derive(Debug)]
+pub struct BridgeQueue {
+    entries: std::collections::VecDeque<Vec<u8>>,
+    queued_bytes: usize,
+    max_bytes: usize,
+    /// Pushes refused due to backpressure.
+    pub refused: u64,
+}
+
+impl BridgeQueue {
+    /// Create a queue bounded to `max_bytes` of queued payload.
+    #[must_use]
+    pub fn new(max_bytes: usize) -> Self {
+        Self {
+            entries: std::collections::VecDeque::new(),
+            queued_bytes: 0,
+            max_bytes: max_bytes.max(1),
+            refused: 0,
+        }
+    }
+
+    /// Queue a payload; `false` signals backpressure to the producer, who
+    /// must slow down or drop at the source instead of ballooning the
+    /// bridge.
+    pub fn push(&mut self, payload: Vec<u8>) -> bool {
+        if self.queued_bytes + payload.len() > self.max_bytes {
+            self.refused += 1;
+            return false;
+        }
+        self.queued_bytes += payload.len();
+        self.entries.push_back(payload);
+        true
+    }
+
+    /// Drain up to `max_bytes` of queued payloads as one batch for a single
+    /// vectored write.
+    pub fn drain_batch(&mut self, max_bytes: usize) -> Vec<Vec<u8>> {
+        let mut batch = Vec::new();
+        let mut taken = 0usize;
+        while let Some(front) = self.entries.front() {
+            if !batch.is_empty() && taken + front.len() > max_bytes {
+                break;
+            }
+            let payload = self.entries.pop_front().expect("front checked");
+            taken += payload.len();
+            self.queued_bytes -= payload.len();
+            batch.push(payload);
+        }
+        batch
+    }
+
+    /// Bytes currently queued.
+    #[must_use]
+    pub fn queued_bytes(&self) -> usize {
+        self.queued_bytes
+    }
+}
+
+#[cfg(test)]
+mod bridge_queue_tests {
+    use super::*;
+
+    #[test]
+    fn queue_bounds_memory_and_drains_batches() {
+        let mut queue = BridgeQueue::new(100);
+        assert!(queue.push(vec![0u8; 40]));
+        assert!(queue.push(vec![1u8; 40]));
+        assert!(!queue.push(vec![2u8; 40]), "backpressure at the bound");
+        assert_eq!(queue.refused, 1);
+        assert_eq!(queue.queued_bytes(), 80);
+
+        let batch = queue.drain_batch(50);
+        assert_eq!(batch.len(), 1, "batch respects its byte budget");
+        assert_eq!(queue.queued_bytes(), 40);
+        // A single oversize payload still drains alone.
+        let batch = queue.drain_batch(10);
+        assert_eq!(batch.len(), 1);
+        assert_eq!(queue.queued_bytes(), 0);
+        assert!(queue.push(vec![3u8; 100]), "space reclaimed after drain");
+    }
+}
@@ -4,24 +4,24 @@
 // Author: Lukas Bower
 
 use std::collections::{HashMap, HashSet};
-use std::io;
 use std::sync::Arc;
 use std::time::{Duration, Instant, SystemTime, UNIX_EPOCH};
 
 use base64::{engine::general_purpose::STANDARD as BASE64_STANDARD, Engine as _};
 use cohesix_proto::{role_label as proto_role_label, Role as ProtoRole};
-use cohesix_ticket::{BudgetSpec, Role, TicketKey, TicketToken, TicketVerb};
+use cohesix_ticket::{BudgetSpec, Role, TicketKey, TicketVerb, TicketVerifierCache};
 use gpu_bridge_host::{status_entry, GpuNamespaceSnapshot};
-use sha2::{Digest, Sha256};
 use log::{debug, info, trace};
 use secure9p_codec::{
     Codec, ErrorCode, OpenMode, Qid, Request, RequestBody, Response, ResponseBody, SessionId,
-    MAX_MSIZE, VERSION,
+    JUMBO_MSIZE, MAX_MSIZE, VERSION,
 };
 use secure9p_core::{
-    FidError, QueueDepth, QueueError, SessionLimits, ShardedFidTable, TagError, TagWindow,
+    AtomicQueueDepth, AtomicTagWindow, CreditController, FidError, QueueError, SessionLimits,
+    ShardedFidTable, TagError,
 };
 use serde::Serialize;
+use sha2::{Digest, Sha256};
 use trace_model::TraceLevel;
 use worker_gpu::{GpuLease as WorkerGpuLease, JobDescriptor};
 
@@ -109,6 +109,7 @@ pub(crate) struct ServerCore {
     sessions: HashMap<SessionId, SessionState>,
     root: RootState,
     ticket_keys: HashMap<Role, TicketKey>,
+    ticket_cache: TicketVerifierCache,
     ticket_limits: TicketLimits,
     ticket_usage: HashMap<String, TicketUsage>,
     clock: Arc<dyn Clock>,
@@ -203,6 +204,7 @@ impl ServerCore {
             sessions: HashMap::new(),
             root: RootState::new(),
             ticket_keys: HashMap::new(),
+            ticket_cache: TicketVerifierCache::new(),
             ticket_limits,
             ticket_usage: HashMap::new(),
             clock,
@@ -409,6 +411,19 @@ impl ServerCore {
         self.control.install_gpu_nodes(topology)
     }
 
+    pub(crate) fn install_gpu_result(
+        &mut self,
+        gpu_id: &str,
+        job_id: &str,
+        data: std::sync::Arc<Vec<u8>>,
+    ) -> Result<(), NineDoorError> {
+        self.control.install_gpu_result(gpu_id, job_id, data)
+    }
+
+    pub(crate) fn publish_perf_capture(&mut self, data: &[u8]) -> Result<(), NineDoorError> {
+        self.control.namespace_mut().publish_perf_capture(data)
+    }
+
     pub(crate) fn set_lora_export_job(
         &mut self,
         job_id: &str,
@@ -451,11 +466,14 @@ impl ServerCore {
             }
         };
         let negotiated_msize = state.negotiated_msize();
-        let mut entries = Vec::new();
-        for frame in secure9p_codec::BatchIter::new(batch) {
-            let frame = frame.map_err(NineDoorError::Codec)?;
-            let raw = frame.bytes().to_vec();
-            let request = self.codec.decode_request(&raw).map_err(|err| {
+        // Validate the whole burst's framing in one pass before any decode
+        // work; a malformed batch fails here without touching session state.
+        let spans =
+            secure9p_codec::scan_frames(batch, negotiated_msize).map_err(NineDoorError::Codec)?;
+        let mut entries = Vec::with_capacity(spans.len());
+        for span in spans {
+            let raw = &batch[span];
+            let request = self.codec.decode_request(raw).map_err(|err| {
                 debug!(
                     "[net-console][auth] session={} state={:?} decode error: {}",
                     session.session(),
@@ -472,7 +490,7 @@ impl ServerCore {
         }
 
         let batch_overflow = batch.len() > negotiated_msize as usize;
-        let frame_overflow = entries.len() > self.limits.batch_frames;
+        let frame_overflow = entries.len() > self.pipeline.effective_batch_frames();
         let mut responses = vec![None; entries.len()];
         let mut dropped = 0u64;
         let mut reserved = vec![false; entries.len()];
@@ -552,6 +570,8 @@ impl ServerCore {
 
         for (idx, (request, _)) in entries.iter().enumerate() {
             if reserved[idx] {
+                let read_started =
+                    matches!(request.body, RequestBody::Read { .. }).then(|| self.clock.now());
                 let outcome = match self.dispatch_with_state(session, &mut state, request) {
                     Ok(body) => body,
                     Err(NineDoorError::Protocol { code, message }) => {
@@ -564,6 +584,16 @@ impl ServerCore {
                         return Err(other);
                     }
                 };
+                if let Some(read_started) = read_started {
+                    let micros = self
+                        .clock
+                        .now()
+                        .duration_since(read_started)
+                        .as_micros()
+                        .try_into()
+                        .unwrap_or(u64::MAX);
+                    self.pipeline.record_read_service_us(micros);
+                }
                 responses[idx] = Some(outcome);
                 state.tag_window.release(request.tag);
                 state.queue_depth.release(1);
@@ -571,26 +601,32 @@ impl ServerCore {
         }
         self.pipeline
             .record_queue_depth(state.queue_depth.current());
+        // Credit-based flow control: grant the next window from this batch's
+        // drain behaviour — fast sessions earn deeper windows up to the tag
+        // budget, sessions leaving work queued decay toward the configured
+        // floor.
+        let completed = reserved.iter().filter(|flag| **flag).count();
+        let granted = state.credits.grant(completed, state.queue_depth.current());
+        state.queue_depth.set_max_depth(granted);
 
         self.sessions.insert(session, state);
+        // Encode every response frame straight into one output buffer so bulk
+        // Rread payloads are copied once instead of staging each frame in its
+        // own Vec before the batch write.
         let mut buffer = Vec::new();
-        let mut writer = io::Cursor::new(&mut buffer);
-        let mut encoded = Vec::with_capacity(responses.len());
         for (idx, (request, _)) in entries.iter().enumerate() {
             let body = responses[idx].take().expect("response populated");
             let response = Response {
                 tag: request.tag,
                 body,
             };
-            encoded.push(self.codec.encode_response(&response)?);
+            self.codec.encode_response_into(&response, &mut buffer)?;
         }
-        self.pipeline.write_batch(&mut writer, &encoded)?;
         let end = self.clock.now();
-        let elapsed_ms = end
-            .duration_since(start)
-            .as_millis()
-            .try_into()
-            .unwrap_or(u32::MAX);
+        let elapsed = end.duration_since(start);
+        self.pipeline
+            .record_batch_latency_us(elapsed.as_micros().try_into().unwrap_or(u64::MAX));
+        let elapsed_ms = elapsed.as_millis().try_into().unwrap_or(u32::MAX);
         self.observe.record_ingest_latency(elapsed_ms);
         self.observe.record_ingest_dropped(dropped);
         let metrics = self.pipeline.metrics();
@@ -607,6 +643,82 @@ impl ServerCore {
         self.pipeline.metrics()
     }
 
+    pub(crate) fn has_session(&self, session: SessionId) -> bool {
+        self.sessions.contains_key(&session)
+    }
+
+    /// Capture every live session for a hot restart.
+    pub(crate) fn snapshot_sessions(&self) -> Vec<SessionSnapshot> {
+        let mut snapshots = Vec::with_capacity(self.sessions.len());
+        for (session, state) in &self.sessions {
+            let mut fids = Vec::new();
+            state.fids.for_each(|fid, entry| {
+                fids.push(FidSnapshot {
+                    fid,
+                    view_path: entry.view_path.clone(),
+                    open_mode: entry.open_mode,
+                });
+            });
+            snapshots.push(SessionSnapshot {
+                session: session.into_raw(),
+                msize: state.msize(),
+                attached: state.attached,
+                role: state.role(),
+                worker_id: state.worker_id().map(str::to_owned),
+                fids,
+            });
+        }
+        snapshots
+    }
+
+    /// Rebuild sessions from a hot-restart snapshot.
+    ///
+    /// Fids are re-walked server-side against the rebuilt namespace, so a
+    /// path that no longer exists simply drops its fid (the client sees a
+    /// Closed error on next use and recovers that one fid, not the whole
+    /// session). Budgets restart fresh.
+    pub(crate) fn restore_sessions(&mut self, snapshots: &[SessionSnapshot]) -> usize {
+        let now = self.clock.now();
+        let mut restored = 0usize;
+        for snapshot in snapshots {
+            let session = SessionId::from_raw(snapshot.session);
+            let mut state = SessionState::new(now, self.limits);
+            if let Some(msize) = snapshot.msize {
+                state.set_msize(msize);
+            }
+            if snapshot.attached {
+                state.attached = true;
+                state.auth_state = AuthState::Attached;
+                state.role = snapshot.role;
+                state.worker_id = snapshot.worker_id.clone();
+            }
+            for fid in &snapshot.fids {
+                let resolved = {
+                    let namespace = self.control.namespace_mut();
+                    namespace.lookup(&fid.view_path).map(|node| node.qid())
+                };
+                let Ok(qid) = resolved else {
+                    continue;
+                };
+                let entry = FidState {
+                    view_path: fid.view_path.clone(),
+                    canonical_path: fid.view_path.clone(),
+                    qid,
+                    open_mode: fid.open_mode,
+                };
+                let _ = state.fids.insert(fid.fid, entry);
+            }
+            self.next_session = self.next_session.max(snapshot.session.saturating_add(1));
+            self.sessions.insert(session, state);
+            restored += 1;
+        }
+        restored
+    }
+
+    pub(crate) fn shard_layout(&self) -> ShardLayout {
+        *self.control.namespace().shard_layout()
+    }
+
     #[allow(dead_code)]
     fn dispatch(
         &mut self,
@@ -842,7 +954,9 @@ impl ServerCore {
                 format!("unsupported version {version}"),
             ));
         }
-        let negotiated = requested_msize.min(MAX_MSIZE);
+        // Bulk clients may ask for jumbo frames; everyone else keeps the
+        // interactive default by requesting MAX_MSIZE or less.
+        let negotiated = requested_msize.min(JUMBO_MSIZE);
         state.set_msize(negotiated);
         Ok(ResponseBody::Version {
             msize: negotiated,
@@ -893,7 +1007,8 @@ impl ServerCore {
                     ));
                 }
             };
-            let claims = match TicketToken::decode(ticket, key) {
+            let key = *key;
+            let claims = match self.ticket_cache.decode(ticket, &key) {
                 Ok(claims) => claims,
                 Err(err) => {
                     self.record_pressure(PressureKind::Policy);
@@ -2102,7 +2217,9 @@ struct GpuBridgeReceiver {
 #[derive(Debug)]
 enum GpuBridgeUpdate {
     None,
-    Started { bytes: usize },
+    Started {
+        bytes: usize,
+    },
     Complete {
         bytes: usize,
         sha256: String,
@@ -2144,14 +2261,9 @@ impl GpuBridgeReceiver {
             let pending = self.pending.take().ok_or_else(|| {
                 NineDoorError::protocol(ErrorCode::Invalid, "gpu bridge end without begin")
             })?;
-            let decoded = BASE64_STANDARD
-                .decode(&pending.encoded)
-                .map_err(|_| {
-                    NineDoorError::protocol(
-                        ErrorCode::Invalid,
-                        "gpu bridge base64 decode failed",
-                    )
-                })?;
+            let decoded = BASE64_STANDARD.decode(&pending.encoded).map_err(|_| {
+                NineDoorError::protocol(ErrorCode::Invalid, "gpu bridge base64 decode failed")
+            })?;
             if decoded.len() != pending.expected_bytes {
                 return Err(NineDoorError::protocol(
                     ErrorCode::Invalid,
@@ -2402,6 +2514,15 @@ impl ControlPlane {
         self.services.get(service).cloned()
     }
 
+    fn install_gpu_result(
+        &mut self,
+        gpu_id: &str,
+        job_id: &str,
+        data: std::sync::Arc<Vec<u8>>,
+    ) -> Result<(), NineDoorError> {
+        self.namespace.set_gpu_result_blob(gpu_id, job_id, data)
+    }
+
     fn install_gpu_nodes(&mut self, topology: &GpuNamespaceSnapshot) -> Result<(), NineDoorError> {
         for node in &topology.nodes {
             self.namespace.set_gpu_node(
@@ -2448,9 +2569,7 @@ impl ControlPlane {
                     snapshot,
                 }) => {
                     self.install_gpu_nodes(&snapshot)?;
-                    self.set_gpu_bridge_status(&format!(
-                        "state=ok bytes={bytes} sha256={sha256}"
-                    ))?;
+                    self.set_gpu_bridge_status(&format!("state=ok bytes={bytes} sha256={sha256}"))?;
                 }
                 Err(err) => {
                     let reason = gpu_bridge_error_message(&err);
@@ -3546,6 +3665,41 @@ impl RootState {
     }
 }
 
+/// Serialisable capture of one fid's state for hot restart.
+#[derive(Debug, Clone)]
+pub struct FidSnapshot {
+    /// Fid number as held by the client.
+    pub fid: u32,
+    /// View path the fid resolved through.
+    pub view_path: Vec<String>,
+    /// Open mode when the fid was opened.
+    pub open_mode: Option<OpenMode>,
+}
+
+/// Serialisable capture of one session for hot restart.
+///
+/// Everything a reattaching client would otherwise rebuild through the
+/// thundering-herd path: negotiated msize, role and worker identity, and
+/// the walked/open fids. Budgets restart fresh (a restarted server must not
+/// honour stale budget accounting), and tickets are not persisted — the
+/// session was already admitted and the snapshot lives only in queen
+/// memory across the restart.
+#[derive(Debug, Clone)]
+pub struct SessionSnapshot {
+    /// Session identifier.
+    pub session: u64,
+    /// Negotiated msize, when version completed.
+    pub msize: Option<u32>,
+    /// True when the session had attached.
+    pub attached: bool,
+    /// Attached role.
+    pub role: Option<Role>,
+    /// Worker identity bound at attach.
+    pub worker_id: Option<String>,
+    /// Live fids with their paths and open modes.
+    pub fids: Vec<FidSnapshot>,
+}
+
 /// Tracks per-session state including budget counters.
 struct SessionState {
     msize: Option<u32>,
@@ -3562,8 +3716,9 @@ struct SessionState {
     mounts: MountTable,
     auth_state: AuthState,
     first_request_logged: bool,
-    tag_window: TagWindow,
-    queue_depth: QueueDepth,
+    tag_window: AtomicTagWindow,
+    queue_depth: AtomicQueueDepth,
+    credits: CreditController,
 }
 
 impl SessionState {
@@ -3583,8 +3738,12 @@ impl SessionState {
             mounts: MountTable::default(),
             auth_state: AuthState::Start,
             first_request_logged: false,
-            tag_window: TagWindow::new(limits.tags_per_session),
-            queue_depth: QueueDepth::new(limits.queue_depth_limit()),
+            tag_window: AtomicTagWindow::new(limits.tags_per_session),
+            queue_depth: AtomicQueueDepth::new(limits.queue_depth_limit()),
+            credits: CreditController::new(
+                limits.queue_depth_limit(),
+                usize::from(limits.tags_per_session),
+            ),
         }
     }
 
@@ -0,0 +1,181 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Sample registered perf counters into one correlation capture.
+// Author: Lukas Bower
+
+//! Cross-subsystem perf counter correlation.
+//!
+//! Subsystems register named samplers (net diag counters, pipeline
+//! metrics, GPU tick costs) once; the housekeeping tick calls
+//! [`PerfCorrelator::sample`] on one cadence with a shared-timebase
+//! timestamp, and every registered counter lands in the same aligned
+//! binary row (format: [`trace_model::correlate`]). The bounded row
+//! window keeps the capture namespace-servable at incident length
+//! without growing forever.
+
+use trace_model::correlate::PerfSchema;
+
+/// Rows retained in the rolling capture (one per sample cadence).
+pub const CAPTURE_ROWS: usize = 4096;
+
+/// Named counter source sampled on each correlation tick.
+type Sampler = Box<dyn Fn() -> u64 + Send>;
+
+/// Correlated sampler over every registered counter surface.
+pub struct PerfCorrelator {
+    schema: PerfSchema,
+    samplers: Vec<Sampler>,
+    rows: std::collections::VecDeque<(u64, Vec<u64>)>,
+}
+
+impl PerfCorrelator {
+    /// Create an empty correlator; register samplers before sampling.
+    #[must_use]
+    pub fn new() -> Self {
+        Self {
+            schema: PerfSchema::new(Vec::new()),
+            samplers: Vec::new(),
+            rows: std::collections::VecDeque::new(),
+        }
+    }
+
+    /// Register one counter column; order of registration is column
+    /// order in the capture.
+    pub fn register(
+        &mut self,
+        name: impl Into<String>,
+        sampler: impl Fn() -> u64 + Send + 'static,
+    ) {
+        let mut fields = self.schema.fields().to_vec();
+        fields.push(name.into());
+        self.schema = PerfSchema::new(fields);
+        self.samplers.push(Box::new(sampler));
+        // Column set changed: old rows no longer align.
+        self.rows.clear();
+    }
+
+    /// Sample every registered counter at `timestamp_us` (shared
+    /// timestamp page time), evicting the oldest row past the window.
+    pub fn sample(&mut self, timestamp_us: u64) {
+        let values: Vec<u64> = self.samplers.iter().map(|sampler| sampler()).collect();
+        if self.rows.len() == CAPTURE_ROWS {
+            self.rows.pop_front();
+        }
+        self.rows.push_back((timestamp_us, values));
+    }
+
+    /// Encode the capture (header plus rows, oldest first) for
+    /// namespace publication.
+    #[must_use]
+    pub fn encode_capture(&self) -> Vec<u8> {
+        let mut out = self.schema.encode_header();
+        for (timestamp_us, values) in &self.rows {
+            self.schema.append_row(&mut out, *timestamp_us, values);
+        }
+        out
+    }
+
+    /// Rows currently held.
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.rows.len()
+    }
+
+    /// Whether no samples have been taken.
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.rows.is_empty()
+    }
+}
+
+impl Default for PerfCorrelator {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::atomic::{AtomicU64, Ordering};
+    use std::sync::Arc;
+    use trace_model::correlate::decode_capture;
+
+    #[test]
+    fn registered_counters_share_one_timeline() {
+        let drops = Arc::new(AtomicU64::new(0));
+        let depth = Arc::new(AtomicU64::new(0));
+        let mut correlator = PerfCorrelator::new();
+        let drops_src = Arc::clone(&drops);
+        correlator.register("net.rx_drops", move || drops_src.load(Ordering::Relaxed));
+        let depth_src = Arc::clone(&depth);
+        correlator.register("pipeline.queue_depth", move || {
+            depth_src.load(Ordering::Relaxed)
+        });
+
+        drops.store(2, Ordering::Relaxed);
+        depth.store(9, Ordering::Relaxed);
+        correlator.sample(1_000);
+        drops.store(5, Ordering::Relaxed);
+        depth.store(3, Ordering::Relaxed);
+        correlator.sample(2_000);
+
+        let (schema, rows) = decode_capture(&correlator.encode_capture()).expect("decode");
+        assert_eq!(schema.fields(), ["net.rx_drops", "pipeline.queue_depth"]);
+        assert_eq!(rows.len(), 2);
+        assert_eq!(rows[0].timestamp_us, 1_000);
+        assert_eq!(rows[0].values, vec![2, 9]);
+        assert_eq!(rows[1].values, vec![5, 3]);
+    }
+
+    #[test]
+    fn capture_window_is_bounded() {
+        let mut correlator = PerfCorrelator::new();
+        correlator.register("tick", || 1);
+        for tick in 0..(CAPTURE_ROWS as u64 + 10) {
+            correlator.sample(tick);
+        }
+        assert_eq!(correlator.len(), CAPTURE_ROWS);
+        let (_, rows) = decode_capture(&correlator.encode_capture()).expect("decode");
+        assert_eq!(rows[0].timestamp_us, 10, "oldest rows evicted");
+    }
+}
+
+#[cfg(test)]
+mod publication_tests {
+    use super::*;
+    use secure9p_codec::MAX_MSIZE;
+    use trace_model::correlate::decode_capture;
+
+    #[test]
+    fn capture_publishes_and_republishes_with_version_bump() {
+        let mut namespace = super::super::namespace::Namespace::new();
+        let mut correlator = PerfCorrelator::new();
+        correlator.register("net.rx_drops", || 7);
+        correlator.sample(500);
+        namespace
+            .publish_perf_capture(&correlator.encode_capture())
+            .expect("publish");
+
+        let path = vec![
+            "queen".to_owned(),
+            "perf".to_owned(),
+            "correlated".to_owned(),
+        ];
+        let payload = namespace.read(&path, 0, MAX_MSIZE).expect("read capture");
+        let (schema, rows) = decode_capture(&payload).expect("decode");
+        assert_eq!(schema.fields(), ["net.rx_drops"]);
+        assert_eq!(rows.len(), 1);
+        let first_qid = namespace.lookup(&path).expect("capture node").qid();
+
+        correlator.sample(600);
+        namespace
+            .publish_perf_capture(&correlator.encode_capture())
+            .expect("republish");
+        let payload = namespace.read(&path, 0, MAX_MSIZE).expect("read capture");
+        let (_, rows) = decode_capture(&payload).expect("decode");
+        assert_eq!(rows.len(), 2);
+        let second_qid = namespace.lookup(&path).expect("capture node").qid();
+        assert_eq!(second_qid.version(), first_qid.version() + 1);
+    }
+}
@@ -0,0 +1,192 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Pin Secure9P sessions to per-shard dispatcher threads for the host server.
+// Author: Lukas Bower
+
+//! Sharded session dispatcher for the host-side NineDoor server.
+//!
+//! `ShardLayout::worker_shard` already spreads workers across namespace
+//! shards; this module gives each shard its own dispatcher thread and bounded
+//! request queue so one session's large transfer no longer stalls submission
+//! for every other session. Fid and tag state stays per-session inside
+//! `ServerCore`; the core itself remains a single lock, so the serialisation
+//! point is narrowed to the duration of one batch rather than removed.
+
+use std::collections::HashMap;
+use std::sync::mpsc::{self, Receiver, SyncSender, TrySendError};
+use std::sync::{Arc, Mutex, RwLock};
+use std::thread::{self, JoinHandle};
+
+use secure9p_codec::SessionId;
+
+use super::core::ServerCore;
+use super::NineDoorError;
+
+/// Maximum number of batches queued per shard before submissions are refused.
+const SHARD_QUEUE_DEPTH: usize = 64;
+
+/// Counters exported for one dispatcher shard.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct ShardDispatchMetrics {
+    /// Batches executed by the shard thread.
+    pub batches: u64,
+    /// Submissions refused because the shard queue was full.
+    pub rejected: u64,
+}
+
+struct ShardWorker {
+    sender: SyncSender<BatchJob>,
+    handle: Option<JoinHandle<()>>,
+    metrics: Arc<Mutex<ShardDispatchMetrics>>,
+}
+
+struct BatchJob {
+    session: SessionId,
+    batch: Vec<u8>,
+    reply: SyncSender<Result<Vec<u8>, NineDoorError>>,
+}
+
+/// Dispatcher pinning each namespace shard to a dedicated worker thread.
+pub struct ShardDispatcher {
+    shards: Vec<ShardWorker>,
+    pins: RwLock<HashMap<SessionId, usize>>,
+}
+
+impl ShardDispatcher {
+    /// Spawn one dispatcher thread per shard over the shared server core.
+    pub(crate) fn new(core: Arc<Mutex<ServerCore>>, shard_count: usize) -> Self {
+        let shard_count = shard_count.max(1);
+        let mut shards = Vec::with_capacity(shard_count);
+        for shard in 0..shard_count {
+            let (sender, receiver) = mpsc::sync_channel(SHARD_QUEUE_DEPTH);
+            let metrics = Arc::new(Mutex::new(ShardDispatchMetrics::default()));
+            let thread_core = Arc::clone(&core);
+            let thread_metrics = Arc::clone(&metrics);
+            let handle = thread::Builder::new()
+                .name(format!("ninedoor-shard-{shard:02x}"))
+                .spawn(move || Self::run_shard(&thread_core, &receiver, &thread_metrics))
+                .expect("spawn shard dispatcher thread");
+            shards.push(ShardWorker {
+                sender,
+                handle: Some(handle),
+                metrics,
+            });
+        }
+        Self {
+            shards,
+            pins: RwLock::new(HashMap::new()),
+        }
+    }
+
+    fn run_shard(
+        core: &Arc<Mutex<ServerCore>>,
+        receiver: &Receiver<BatchJob>,
+        metrics: &Arc<Mutex<ShardDispatchMetrics>>,
+    ) {
+        while let Ok(job) = receiver.recv() {
+            let result = {
+                let mut core = core.lock().expect("poisoned nine-door lock");
+                core.handle_batch(job.session, &job.batch)
+            };
+            metrics.lock().expect("poisoned shard metrics").batches += 1;
+            // A dropped reply receiver means the submitter gave up; the batch
+            // has still been applied, so the result is simply discarded.
+            let _ = job.reply.send(result);
+        }
+    }
+
+    /// Number of dispatcher shards.
+    #[must_use]
+    pub fn shard_count(&self) -> usize {
+        self.shards.len()
+    }
+
+    /// Pin a session to the shard owning `worker_id` so all of its batches
+    /// execute on that shard's thread. Unpinned sessions hash by session id.
+    pub fn pin_session(&self, session: SessionId, shard: u8) {
+        let shard = usize::from(shard) % self.shards.len();
+        self.pins
+            .write()
+            .expect("poisoned shard pins")
+            .insert(session, shard);
+    }
+
+    /// Drop the shard pin for a closed session.
+    pub fn release_session(&self, session: SessionId) {
+        self.pins
+            .write()
+            .expect("poisoned shard pins")
+            .remove(&session);
+    }
+
+    fn shard_for(&self, session: SessionId) -> usize {
+        if let Some(shard) = self.pins.read().expect("poisoned shard pins").get(&session) {
+            return *shard;
+        }
+        (session.into_raw() as usize) % self.shards.len()
+    }
+
+    /// Execute a raw Secure9P batch on the session's shard thread, blocking
+    /// until the response bytes are available.
+    pub fn submit(&self, session: SessionId, batch: &[u8]) -> Result<Vec<u8>, NineDoorError> {
+        let shard = &self.shards[self.shard_for(session)];
+        let (reply_tx, reply_rx) = mpsc::sync_channel(1);
+        let job = BatchJob {
+            session,
+            batch: batch.to_vec(),
+            reply: reply_tx,
+        };
+        if let Err(err) = shard.sender.try_send(job) {
+            shard
+                .metrics
+                .lock()
+                .expect("poisoned shard metrics")
+                .rejected += 1;
+            let reason = match err {
+                TrySendError::Full(_) => "shard queue full",
+                TrySendError::Disconnected(_) => "shard dispatcher stopped",
+            };
+            return Err(NineDoorError::protocol(
+                secure9p_codec::ErrorCode::Busy,
+                reason,
+            ));
+        }
+        reply_rx.recv().map_err(|_| {
+            NineDoorError::protocol(
+                secure9p_codec::ErrorCode::Closed,
+                "shard dispatcher stopped",
+            )
+        })?
+    }
+
+    /// Snapshot per-shard dispatch counters in shard order.
+    #[must_use]
+    pub fn metrics(&self) -> Vec<ShardDispatchMetrics> {
+        self.shards
+            .iter()
+            .map(|shard| *shard.metrics.lock().expect("poisoned shard metrics"))
+            .collect()
+    }
+}
+
+impl Drop for ShardDispatcher {
+    fn drop(&mut self) {
+        for shard in &mut self.shards {
+            // Replacing the sender closes the channel; the thread exits once
+            // its queue drains.
+            let (closed, _) = mpsc::sync_channel(1);
+            shard.sender = closed;
+            if let Some(handle) = shard.handle.take() {
+                let _ = handle.join();
+            }
+        }
+    }
+}
+
+impl std::fmt::Debug for ShardDispatcher {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("ShardDispatcher")
+            .field("shards", &self.shards.len())
+            .finish_non_exhaustive()
+    }
+}
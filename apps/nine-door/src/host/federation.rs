@@ -0,0 +1,308 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Federated namespace aggregation across multi-queen hives.
+// Author: Lukas Bower
+
+//! Federated namespace aggregation for multi-queen sites.
+//!
+//! Operators run several queens per site; without federation a
+//! cross-hive query means one cohsh session per queen and client-side
+//! merging. The [`FederationProxy`] aggregates instead: remote queens
+//! register under `/federation/<queen>/`, reads against that prefix
+//! proxy to the owning queen over a cached attach session, and
+//! site-wide queries fan out in parallel so the answer arrives with the
+//! latency of the slowest queen rather than the sum.
+//!
+//! The remote transport is abstracted behind [`RemoteQueen`] — the
+//! binary wires the pipelined Secure9P client in, tests wire mocks —
+//! keeping the aggregation, session caching, and fan-out logic
+//! independently testable.
+
+use std::collections::BTreeMap;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Mutex;
+
+use secure9p_codec::ErrorCode;
+
+use crate::host::NineDoorError;
+
+/// One remote queen endpoint: connected, attach-cached transport.
+///
+/// Implementations keep their session alive across calls; a returned
+/// error marks the session dead and the proxy reconnects through the
+/// factory on the next use.
+pub trait RemoteQueen: Send {
+    /// Read a file on the remote queen (path is queen-relative).
+    fn read(&mut self, path: &str) -> Result<Vec<u8>, NineDoorError>;
+    /// List a directory on the remote queen (path is queen-relative).
+    fn list(&mut self, path: &str) -> Result<Vec<String>, NineDoorError>;
+}
+
+/// Factory reconnecting a remote queen after a session failure.
+pub type RemoteQueenFactory = Box<dyn Fn() -> Result<Box<dyn RemoteQueen>, NineDoorError> + Send>;
+
+struct FederatedQueen {
+    factory: RemoteQueenFactory,
+    /// Cached attach session; `None` until first use or after an error.
+    session: Option<Box<dyn RemoteQueen>>,
+}
+
+impl FederatedQueen {
+    /// Run an operation over the cached session, reconnecting once on a
+    /// dead session before surfacing the error.
+    fn with_session<T>(
+        &mut self,
+        operation: impl Fn(&mut dyn RemoteQueen) -> Result<T, NineDoorError>,
+    ) -> Result<T, NineDoorError> {
+        if self.session.is_none() {
+            self.session = Some((self.factory)()?);
+        }
+        let session = self.session.as_mut().expect("session just established");
+        match operation(session.as_mut()) {
+            Ok(value) => Ok(value),
+            Err(_) => {
+                // Session may have died mid-operation: reconnect and
+                // retry once, then give up with the fresh error.
+                self.session = Some((self.factory)()?);
+                let session = self.session.as_mut().expect("session just established");
+                operation(session.as_mut()).inspect_err(|_| {
+                    self.session = None;
+                })
+            }
+        }
+    }
+}
+
+/// Result of one queen's leg of a fan-out query.
+#[derive(Debug)]
+pub struct FederatedRead {
+    /// Queen name the payload came from.
+    pub queen: String,
+    /// Payload, or the error that leg surfaced.
+    pub payload: Result<Vec<u8>, NineDoorError>,
+}
+
+/// Aggregation proxy over a site's queens.
+pub struct FederationProxy {
+    queens: BTreeMap<String, Mutex<FederatedQueen>>,
+}
+
+impl FederationProxy {
+    /// Mount prefix federated paths live under.
+    pub const MOUNT_PREFIX: &'static str = "federation";
+
+    /// Create an empty proxy.
+    #[must_use]
+    #[allow(clippy::new_without_default)]
+    pub fn new() -> Self {
+        Self {
+            queens: BTreeMap::new(),
+        }
+    }
+
+    /// Register a remote queen under `/federation/<name>/`.
+    pub fn register(&mut self, name: impl Into<String>, factory: RemoteQueenFactory) {
+        self.queens.insert(
+            name.into(),
+            Mutex::new(FederatedQueen {
+                factory,
+                session: None,
+            }),
+        );
+    }
+
+    /// Registered queen names in stable order.
+    #[must_use]
+    pub fn queen_names(&self) -> Vec<String> {
+        self.queens.keys().cloned().collect()
+    }
+
+    /// Split `/federation/<queen>/rest` into the queen and remote path.
+    #[must_use]
+    pub fn split_path(path: &str) -> Option<(&str, &str)> {
+        let trimmed = path.trim_start_matches('/');
+        let rest = trimmed.strip_prefix(Self::MOUNT_PREFIX)?;
+        let rest = rest.strip_prefix('/')?;
+        match rest.split_once('/') {
+            Some((queen, remote)) => Some((queen, remote)),
+            None => Some((rest, "")),
+        }
+    }
+
+    /// Proxy a read to the owning queen over its cached session.
+    pub fn read(&self, queen: &str, remote_path: &str) -> Result<Vec<u8>, NineDoorError> {
+        let entry = self.queens.get(queen).ok_or_else(|| unknown_queen(queen))?;
+        entry
+            .lock()
+            .expect("federated queen lock")
+            .with_session(|session| session.read(remote_path))
+    }
+
+    /// Proxy a directory listing to the owning queen.
+    pub fn list(&self, queen: &str, remote_path: &str) -> Result<Vec<String>, NineDoorError> {
+        let entry = self.queens.get(queen).ok_or_else(|| unknown_queen(queen))?;
+        entry
+            .lock()
+            .expect("federated queen lock")
+            .with_session(|session| session.list(remote_path))
+    }
+
+    /// Read the same path on every queen in parallel.
+    ///
+    /// Each queen gets its own thread (sessions are per-queen, so legs
+    /// never serialize on each other); results return in registration
+    /// order with per-leg errors inline, and the wall time is the
+    /// slowest queen's, not the sum.
+    pub fn read_all(&self, remote_path: &str) -> Vec<FederatedRead> {
+        let names = self.queen_names();
+        let results: Vec<Mutex<Option<Result<Vec<u8>, NineDoorError>>>> =
+            names.iter().map(|_| Mutex::new(None)).collect();
+        let next = AtomicUsize::new(0);
+        std::thread::scope(|scope| {
+            for _ in 0..names.len() {
+                scope.spawn(|| loop {
+                    let index = next.fetch_add(1, Ordering::Relaxed);
+                    let Some(name) = names.get(index) else { break };
+                    let outcome = self.read(name, remote_path);
+                    *results[index].lock().expect("fan-out slot") = Some(outcome);
+                });
+            }
+        });
+        names
+            .into_iter()
+            .zip(results)
+            .map(|(queen, slot)| FederatedRead {
+                queen,
+                payload: slot
+                    .into_inner()
+                    .expect("fan-out slot")
+                    .unwrap_or_else(|| Err(unknown_queen(remote_path))),
+            })
+            .collect()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::atomic::AtomicU32;
+    use std::sync::Arc;
+    use std::time::{Duration, Instant};
+
+    struct MockQueen {
+        payload: Vec<u8>,
+        delay: Duration,
+        fail_reads: Arc<AtomicU32>,
+    }
+
+    impl RemoteQueen for MockQueen {
+        fn read(&mut self, path: &str) -> Result<Vec<u8>, NineDoorError> {
+            if self.fail_reads.load(Ordering::SeqCst) > 0 {
+                self.fail_reads.fetch_sub(1, Ordering::SeqCst);
+                return Err(NineDoorError::Protocol {
+                    code: ErrorCode::NotFound,
+                    message: path.to_owned(),
+                });
+            }
+            std::thread::sleep(self.delay);
+            Ok(self.payload.clone())
+        }
+
+        fn list(&mut self, _path: &str) -> Result<Vec<String>, NineDoorError> {
+            Ok(vec!["status".to_owned()])
+        }
+    }
+
+    fn mock_factory(
+        payload: &[u8],
+        delay: Duration,
+        fail_reads: Arc<AtomicU32>,
+        connects: Arc<AtomicU32>,
+    ) -> RemoteQueenFactory {
+        let payload = payload.to_vec();
+        Box::new(move || {
+            connects.fetch_add(1, Ordering::SeqCst);
+            Ok(Box::new(MockQueen {
+                payload: payload.clone(),
+                delay,
+                fail_reads: Arc::clone(&fail_reads),
+            }) as Box<dyn RemoteQueen>)
+        })
+    }
+
+    #[test]
+    fn split_path_maps_federation_prefix() {
+        assert_eq!(
+            FederationProxy::split_path("/federation/queen-a/worker/1/status"),
+            Some(("queen-a", "worker/1/status"))
+        );
+        assert_eq!(
+            FederationProxy::split_path("/federation/queen-a"),
+            Some(("queen-a", ""))
+        );
+        assert_eq!(FederationProxy::split_path("/worker/1"), None);
+    }
+
+    #[test]
+    fn sessions_are_cached_and_reconnect_after_failure() {
+        let connects = Arc::new(AtomicU32::new(0));
+        let fail_reads = Arc::new(AtomicU32::new(0));
+        let mut proxy = FederationProxy::new();
+        proxy.register(
+            "queen-a",
+            mock_factory(
+                b"alpha",
+                Duration::ZERO,
+                Arc::clone(&fail_reads),
+                Arc::clone(&connects),
+            ),
+        );
+
+        for _ in 0..3 {
+            assert_eq!(proxy.read("queen-a", "status").unwrap(), b"alpha");
+        }
+        assert_eq!(connects.load(Ordering::SeqCst), 1, "attach is cached");
+
+        // A failing read tears the session down and reconnects once.
+        fail_reads.store(1, Ordering::SeqCst);
+        assert_eq!(proxy.read("queen-a", "status").unwrap(), b"alpha");
+        assert_eq!(connects.load(Ordering::SeqCst), 2);
+
+        assert!(proxy.read("queen-b", "status").is_err(), "unknown queen");
+    }
+
+    #[test]
+    fn fan_out_runs_queens_in_parallel() {
+        let mut proxy = FederationProxy::new();
+        let delay = Duration::from_millis(40);
+        for name in ["queen-a", "queen-b", "queen-c"] {
+            proxy.register(
+                name,
+                mock_factory(
+                    name.as_bytes(),
+                    delay,
+                    Arc::new(AtomicU32::new(0)),
+                    Arc::new(AtomicU32::new(0)),
+                ),
+            );
+        }
+        let started = Instant::now();
+        let results = proxy.read_all("telemetry/agg");
+        let elapsed = started.elapsed();
+        assert_eq!(results.len(), 3);
+        assert!(results.iter().all(|leg| leg.payload.is_ok()));
+        assert_eq!(results[0].queen, "queen-a");
+        assert!(
+            elapsed < delay * 3,
+            "legs overlapped: {elapsed:?} vs serial {:?}",
+            delay * 3
+        );
+    }
+}
+
+fn unknown_queen(name: &str) -> NineDoorError {
+    NineDoorError::Protocol {
+        code: ErrorCode::NotFound,
+        message: format!("unknown federated queen {name}"),
+    }
+}
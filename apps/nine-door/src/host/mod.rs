@@ -30,6 +30,9 @@ mod cas;
 mod cbor;
 mod control;
 mod core;
+mod correlate;
+mod dispatch;
+mod federation;
 mod lifecycle;
 mod namespace;
 mod observe;
@@ -45,9 +48,14 @@ mod ui;
 pub use self::audit::{AuditConfig, AuditLimits, ReplayConfig};
 pub use self::cas::CasConfig;
 use self::core::{role_to_uname, ServerCore};
+pub use self::core::{FidSnapshot, SessionSnapshot};
+pub use self::correlate::{PerfCorrelator, CAPTURE_ROWS};
+pub use self::dispatch::{ShardDispatchMetrics, ShardDispatcher};
+pub use self::federation::{FederatedRead, FederationProxy, RemoteQueen, RemoteQueenFactory};
 pub use self::namespace::{
     HostNamespaceConfig, HostProvider, ShardLayout, SidecarBusAdapterConfig, SidecarBusConfig,
-    SidecarLoraAdapterConfig, SidecarLoraConfig, SidecarNamespaceConfig,
+    SidecarLoraAdapterConfig, SidecarLoraConfig, SidecarNamespaceConfig, WalkSnapshot,
+    WalkSnapshotCell,
 };
 pub use self::observe::{
     ObserveConfig, Proc9pConfig, Proc9pSessionConfig, ProcIngestConfig, ProcPressureConfig,
@@ -57,8 +65,9 @@ pub use self::pipeline::{Pipeline, PipelineConfig, PipelineMetrics};
 pub use self::policy::{PolicyConfig, PolicyDecision, PolicyLimits, PolicyRuleSpec};
 pub use self::security::TicketLimits;
 pub use self::telemetry::{
-    TelemetryConfig, TelemetryCursorConfig, TelemetryFrameSchema, TelemetryIngestConfig,
-    TelemetryIngestEvictionPolicy, TelemetryManifestStore,
+    TelemetryConfig, TelemetryCursorConfig, TelemetryFile, TelemetryFrameSchema,
+    TelemetryIngestConfig, TelemetryIngestEvictionPolicy, TelemetryManifestStore,
+    TelemetryReadOutcome,
 };
 pub use self::ui::{
     UiPolicyPreflightConfig, UiProc9pConfig, UiProcIngestConfig, UiProviderConfig, UiUpdatesConfig,
@@ -305,6 +314,29 @@ impl NineDoor {
         )
     }
 
+    /// Construct a new NineDoor server with CAS enabled and explicit limits.
+    #[must_use]
+    pub fn new_with_limits_and_cas(
+        clock: Arc<dyn Clock>,
+        limits: SessionLimits,
+        cas: CasConfig,
+    ) -> Self {
+        Self::new_with_limits_telemetry_host_policy_shards(
+            clock,
+            limits,
+            TelemetryConfig::default(),
+            TelemetryIngestConfig::default(),
+            TelemetryManifestStore::default(),
+            cas,
+            ShardLayout::default(),
+            UiProviderConfig::default(),
+            HostNamespaceConfig::disabled(),
+            SidecarNamespaceConfig::disabled(),
+            PolicyConfig::disabled(),
+            AuditConfig::disabled(),
+        )
+    }
+
     /// Construct a new NineDoor server with CAS enabled and default limits.
     #[must_use]
     pub fn new_with_cas_config(cas: CasConfig) -> Self {
@@ -417,6 +449,58 @@ impl NineDoor {
         Ok(InProcessConnection::new(self.inner.clone(), session))
     }
 
+    /// Spawn a sharded dispatcher servicing sessions on per-shard threads.
+    ///
+    /// One thread is started per namespace shard (one in legacy mode); pin
+    /// sessions via [`ShardDispatcher::pin_session`] with the shard returned
+    /// by [`ShardLayout::worker_shard`] once the worker identity is known.
+    #[must_use]
+    pub fn shard_dispatcher(&self) -> ShardDispatcher {
+        let shard_count = {
+            let core = self.inner.lock().expect("poisoned nine-door lock");
+            core.shard_layout().shard_count()
+        };
+        ShardDispatcher::new(self.inner.clone(), shard_count)
+    }
+
+    /// Re-open a client handle for a restored session id after a hot
+    /// restart; the session keeps its negotiated state and fids.
+    pub fn resume_connection(
+        &self,
+        session: SessionId,
+    ) -> Result<InProcessConnection, NineDoorError> {
+        {
+            let core = self.inner.lock().expect("poisoned nine-door lock");
+            if !core.has_session(session) {
+                return Err(NineDoorError::UnknownSession(session));
+            }
+        }
+        Ok(InProcessConnection::new(self.inner.clone(), session))
+    }
+
+    /// Capture the live session table for a hot restart.
+    #[must_use]
+    pub fn snapshot_sessions(&self) -> Vec<self::core::SessionSnapshot> {
+        let core = self.inner.lock().expect("poisoned nine-door lock");
+        core.snapshot_sessions()
+    }
+
+    /// Restore sessions captured by [`NineDoor::snapshot_sessions`] into a
+    /// freshly constructed server, returning how many were rebuilt. Clients
+    /// keep their session ids, negotiated msize, roles, and walked fids —
+    /// no re-attach herd, no ticket re-verification storm.
+    pub fn restore_sessions(&self, snapshots: &[self::core::SessionSnapshot]) -> usize {
+        let mut core = self.inner.lock().expect("poisoned nine-door lock");
+        core.restore_sessions(snapshots)
+    }
+
+    /// Return the shard layout configured for this server.
+    #[must_use]
+    pub fn shard_layout(&self) -> ShardLayout {
+        let core = self.inner.lock().expect("poisoned nine-door lock");
+        core.shard_layout()
+    }
+
     /// Retrieve the negotiated frame header for the bootstrap session.
     pub fn describe_bootstrap_session(&self) -> FrameHeader {
         FrameHeader::new(SessionId::BOOTSTRAP, 0)
@@ -446,6 +530,27 @@ impl NineDoor {
         core.install_gpu_nodes(topology)
     }
 
+    /// Expose a GPU job result at `/gpu/<id>/results/<job>`, sharing the
+    /// bridge's staging buffer by reference so Rreads serve tensor bytes
+    /// without an intermediate namespace copy.
+    pub fn install_gpu_result(
+        &self,
+        gpu_id: &str,
+        job_id: &str,
+        data: std::sync::Arc<Vec<u8>>,
+    ) -> Result<(), NineDoorError> {
+        let mut core = self.inner.lock().expect("poisoned nine-door lock");
+        core.install_gpu_result(gpu_id, job_id, data)
+    }
+
+    /// Publish the cross-subsystem perf correlation capture at
+    /// `/queen/perf/correlated` (see [`PerfCorrelator`]); republication
+    /// bumps the qid version so pollers revalidate cheaply.
+    pub fn publish_perf_capture(&self, data: &[u8]) -> Result<(), NineDoorError> {
+        let mut core = self.inner.lock().expect("poisoned nine-door lock");
+        core.publish_perf_capture(data)
+    }
+
     /// Install a LoRA export job under `/queen/export/lora_jobs/<job_id>`.
     pub fn set_lora_export_job(
         &self,
@@ -5,7 +5,7 @@
 
 //! Secure9P pipeline helpers for batching and back-pressure accounting.
 
-use std::io::{self, Write};
+use std::io::{self, IoSlice, Write};
 use std::thread;
 use std::time::Duration;
 
@@ -16,6 +16,8 @@ use secure9p_core::{SessionLimits, ShortWritePolicy};
 pub struct PipelineConfig {
     /// Maximum number of frames allowed per batch.
     pub batch_frames: usize,
+    /// Ceiling the adaptive batch window may grow to (the tag budget).
+    pub batch_frames_ceiling: usize,
     /// Maximum number of outstanding requests per session.
     pub queue_depth: usize,
     /// Short write retry policy.
@@ -28,12 +30,87 @@ impl PipelineConfig {
     pub fn from_limits(limits: SessionLimits) -> Self {
         Self {
             batch_frames: limits.batch_frames.max(1),
+            batch_frames_ceiling: usize::from(limits.tags_per_session).max(limits.batch_frames),
             queue_depth: limits.queue_depth_limit().max(1),
             short_write_policy: limits.short_write_policy,
         }
     }
 }
 
+/// Bucket count for the fixed log2 latency histograms.
+pub const LATENCY_BUCKETS: usize = 26;
+
+/// HDR-style latency histogram: bucket N counts samples in
+/// `[2^N, 2^(N+1))` microseconds, with the last bucket absorbing the tail.
+/// Recording is one shift plus a saturating add, cheap enough to stay on in
+/// production; percentiles are computed on demand at the read edge.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct LatencyHistogram {
+    buckets: [u64; LATENCY_BUCKETS],
+    samples: u64,
+}
+
+impl Default for LatencyHistogram {
+    fn default() -> Self {
+        Self {
+            buckets: [0; LATENCY_BUCKETS],
+            samples: 0,
+        }
+    }
+}
+
+impl LatencyHistogram {
+    /// Record one latency sample in microseconds.
+    pub fn record_us(&mut self, micros: u64) {
+        let bucket = (64 - micros.max(1).leading_zeros() as usize - 1).min(LATENCY_BUCKETS - 1);
+        self.buckets[bucket] = self.buckets[bucket].saturating_add(1);
+        self.samples = self.samples.saturating_add(1);
+    }
+
+    /// Total recorded samples.
+    #[must_use]
+    pub fn samples(&self) -> u64 {
+        self.samples
+    }
+
+    /// Approximate percentile in microseconds (upper bound of the bucket
+    /// containing the requested rank); `pct` in tenths of a percent so p999
+    /// is representable (500 = p50, 999 = p99.9).
+    #[must_use]
+    pub fn percentile_us(&self, pct_tenths: u32) -> u64 {
+        if self.samples == 0 {
+            return 0;
+        }
+        // Nearest-rank (ceiling) so p99.9 of 100 samples selects the tail.
+        let rank = self
+            .samples
+            .saturating_mul(u64::from(pct_tenths))
+            .div_ceil(1000)
+            .max(1);
+        let mut seen = 0u64;
+        for (bucket, count) in self.buckets.iter().enumerate() {
+            seen = seen.saturating_add(*count);
+            if seen >= rank {
+                return 1u64 << (bucket + 1);
+            }
+        }
+        1u64 << LATENCY_BUCKETS
+    }
+
+    /// Render the p50/p99/p999 summary line for observability surfaces.
+    pub fn render(&self, label: &str, out: &mut String) {
+        use core::fmt::Write as _;
+        let _ = writeln!(
+            out,
+            "{label} n={} p50_us={} p99_us={} p999_us={}",
+            self.samples,
+            self.percentile_us(500),
+            self.percentile_us(990),
+            self.percentile_us(999),
+        );
+    }
+}
+
 /// Observability counters for the Secure9P pipeline.
 #[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
 pub struct PipelineMetrics {
@@ -51,13 +128,28 @@ pub struct PipelineMetrics {
     pub ui_reads: u64,
     /// UI denials due to ticket scope or quota enforcement.
     pub ui_denies: u64,
+    /// Enqueue-to-flush latency distribution per batch.
+    pub batch_latency: LatencyHistogram,
+    /// Tread service time distribution.
+    pub read_service: LatencyHistogram,
 }
 
+/// Consecutive backpressure events before the batch window grows.
+const ADAPT_GROW_STREAK: u32 = 3;
+/// Consecutive drained polls before the batch window shrinks back.
+const ADAPT_SHRINK_STREAK: u32 = 8;
+
 /// Pipeline helper tracking batching and write retry behavior.
 #[derive(Debug)]
 pub struct Pipeline {
     config: PipelineConfig,
     metrics: PipelineMetrics,
+    /// Adaptive batch-frame window in `[config.batch_frames, ceiling]`.
+    effective_batch_frames: usize,
+    /// Hard ceiling for the adaptive window (the session tag budget).
+    batch_frames_ceiling: usize,
+    backpressure_streak: u32,
+    drained_streak: u32,
 }
 
 impl Pipeline {
@@ -69,10 +161,26 @@ impl Pipeline {
                 queue_limit: config.queue_depth,
                 ..PipelineMetrics::default()
             },
+            effective_batch_frames: config.batch_frames,
+            batch_frames_ceiling: config.batch_frames_ceiling.max(config.batch_frames),
+            backpressure_streak: 0,
+            drained_streak: 0,
             config,
         }
     }
 
+    /// Current adaptive batch-frame limit.
+    ///
+    /// Sustained backpressure doubles the window (up to the session tag
+    /// budget) so telemetry storms amortise more frames per flush; once the
+    /// queues stay drained the window decays back to the configured base, so
+    /// steady state matches the manifest limits without per-deployment
+    /// retuning.
+    #[must_use]
+    pub fn effective_batch_frames(&self) -> usize {
+        self.effective_batch_frames
+    }
+
     /// Return the current pipeline metrics.
     #[must_use]
     pub fn metrics(&self) -> PipelineMetrics {
@@ -82,11 +190,31 @@ impl Pipeline {
     /// Update the observed queue depth.
     pub fn record_queue_depth(&mut self, depth: usize) {
         self.metrics.queue_depth = depth;
+        if depth == 0 {
+            self.backpressure_streak = 0;
+            self.drained_streak = self.drained_streak.saturating_add(1);
+            if self.drained_streak >= ADAPT_SHRINK_STREAK
+                && self.effective_batch_frames > self.config.batch_frames
+            {
+                self.effective_batch_frames =
+                    (self.effective_batch_frames / 2).max(self.config.batch_frames);
+                self.drained_streak = 0;
+            }
+        } else {
+            self.drained_streak = 0;
+        }
     }
 
     /// Increment back-pressure refusal counters.
     pub fn record_backpressure(&mut self) {
         self.metrics.backpressure_events += 1;
+        self.drained_streak = 0;
+        self.backpressure_streak = self.backpressure_streak.saturating_add(1);
+        if self.backpressure_streak >= ADAPT_GROW_STREAK {
+            self.effective_batch_frames =
+                (self.effective_batch_frames * 2).min(self.batch_frames_ceiling);
+            self.backpressure_streak = 0;
+        }
     }
 
     /// Increment UI read counters.
@@ -99,20 +227,41 @@ impl Pipeline {
         self.metrics.ui_denies = self.metrics.ui_denies.saturating_add(1);
     }
 
-    /// Write a batch of frames using the configured short-write policy.
-    pub fn write_batch(&mut self, writer: &mut impl Write, frames: &[Vec<u8>]) -> io::Result<()> {
-        for frame in frames {
-            self.write_with_policy(writer, frame)?;
-        }
-        Ok(())
+    /// Record one batch's enqueue-to-flush latency.
+    pub fn record_batch_latency_us(&mut self, micros: u64) {
+        self.metrics.batch_latency.record_us(micros);
+    }
+
+    /// Record one Tread's service time.
+    pub fn record_read_service_us(&mut self, micros: u64) {
+        self.metrics.read_service.record_us(micros);
     }
 
-    fn write_with_policy(&mut self, writer: &mut impl Write, buffer: &[u8]) -> io::Result<()> {
-        let mut offset = 0;
+    /// Write a batch of frames as a single vectored write, retrying short
+    /// writes under the configured policy.
+    ///
+    /// All frames are gathered into one `write_vectored` call so a burst of
+    /// small telemetry frames costs one syscall instead of one per frame.
+    /// Transports whose writer does not support vectored I/O still work: the
+    /// default `write_vectored` forwards the first non-empty slice to
+    /// `write`, and the retry loop advances across slices until the batch is
+    /// flushed.
+    pub fn write_batch(&mut self, writer: &mut impl Write, frames: &[Vec<u8>]) -> io::Result<()> {
+        let total: usize = frames.iter().map(Vec::len).sum();
+        if total == 0 {
+            return Ok(());
+        }
+        let mut slices: Vec<IoSlice<'_>> = frames
+            .iter()
+            .filter(|frame| !frame.is_empty())
+            .map(|frame| IoSlice::new(frame))
+            .collect();
+        let mut remaining = total;
         let mut attempts = 0u8;
-        while offset < buffer.len() {
-            let written = writer.write(&buffer[offset..])?;
-            if written == 0 || written < buffer.len() - offset {
+        let mut cursor: &mut [IoSlice<'_>] = &mut slices;
+        while remaining > 0 {
+            let written = writer.write_vectored(cursor)?;
+            if written == 0 || written < remaining {
                 self.metrics.short_writes += 1;
                 let Some(delay_ms) = self.config.short_write_policy.retry_delay_ms(attempts) else {
                     return Err(io::Error::new(
@@ -126,8 +275,66 @@ impl Pipeline {
                     thread::sleep(Duration::from_millis(delay_ms));
                 }
             }
-            offset = offset.saturating_add(written);
+            remaining -= written.min(remaining);
+            if remaining > 0 {
+                IoSlice::advance_slices(&mut cursor, written);
+            }
         }
         Ok(())
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn batch_window_grows_under_backpressure_and_decays() {
+        let limits = SessionLimits {
+            tags_per_session: 16,
+            batch_frames: 2,
+            short_write_policy: ShortWritePolicy::Reject,
+        };
+        let mut pipeline = Pipeline::new(PipelineConfig::from_limits(limits));
+        assert_eq!(pipeline.effective_batch_frames(), 2);
+        for _ in 0..ADAPT_GROW_STREAK {
+            pipeline.record_backpressure();
+        }
+        assert_eq!(pipeline.effective_batch_frames(), 4);
+        for _ in 0..(2 * ADAPT_GROW_STREAK) {
+            pipeline.record_backpressure();
+        }
+        assert_eq!(pipeline.effective_batch_frames(), 16);
+        for _ in 0..ADAPT_GROW_STREAK {
+            pipeline.record_backpressure();
+        }
+        assert_eq!(
+            pipeline.effective_batch_frames(),
+            16,
+            "clamped at tag budget"
+        );
+        for _ in 0..(2 * ADAPT_SHRINK_STREAK) {
+            pipeline.record_queue_depth(0);
+        }
+        assert_eq!(pipeline.effective_batch_frames(), 4);
+    }
+
+    #[test]
+    fn histogram_percentiles_track_buckets() {
+        let mut histogram = LatencyHistogram::default();
+        for _ in 0..90 {
+            histogram.record_us(100); // bucket [64,128)
+        }
+        for _ in 0..9 {
+            histogram.record_us(1_000); // bucket [512,1024)
+        }
+        histogram.record_us(50_000); // tail
+        assert_eq!(histogram.samples(), 100);
+        assert_eq!(histogram.percentile_us(500), 128);
+        assert_eq!(histogram.percentile_us(990), 1024);
+        assert!(histogram.percentile_us(999) >= 65_536);
+        let mut report = String::new();
+        histogram.render("batch", &mut report);
+        assert!(report.contains("p99_us=1024"));
+    }
+}
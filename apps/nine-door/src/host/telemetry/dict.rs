@@ -0,0 +1,190 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Streaming per-device dictionary codec for repetitive telemetry lines.
+// Author: Lukas Bower
+
+//! Line-dictionary codec for telemetry records.
+//!
+//! Worker telemetry lines share most of their bytes tick-to-tick (same keys,
+//! same shapes). The codec keeps a small rolling dictionary of recent lines
+//! and emits each new line as a back-reference to the entry with the longest
+//! common prefix plus the differing suffix. Both sides update the dictionary
+//! with the decoded line under the same rule, so the stream is
+//! self-synchronising and needs no side-channel dictionary transfer; a
+//! periodic refresh falls out naturally from the round-robin slot reuse.
+
+/// Dictionary slots retained per stream.
+const DICT_SLOTS: usize = 16;
+/// Minimum shared prefix before a back-reference beats a literal.
+const MIN_PREFIX: usize = 8;
+
+/// Streaming dictionary codec; one per device per direction.
+#[derive(Debug, Clone, Default)]
+pub struct LineDictCodec {
+    slots: Vec<Vec<u8>>,
+    next_slot: usize,
+}
+
+/// Errors raised while decoding a dictionary stream.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum DictDecodeError {
+    /// The stream referenced a slot that has not been populated.
+    BadSlot,
+    /// The stream ended mid-record.
+    Truncated,
+}
+
+impl LineDictCodec {
+    /// Create an empty codec.
+    #[must_use]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    fn learn(&mut self, line: &[u8]) {
+        if self.slots.len() < DICT_SLOTS {
+            self.slots.push(line.to_vec());
+        } else {
+            self.slots[self.next_slot] = line.to_vec();
+            self.next_slot = (self.next_slot + 1) % DICT_SLOTS;
+        }
+    }
+
+    fn best_reference(&self, line: &[u8]) -> Option<(usize, usize)> {
+        let mut best: Option<(usize, usize)> = None;
+        for (slot, entry) in self.slots.iter().enumerate() {
+            let shared = entry
+                .iter()
+                .zip(line)
+                .take_while(|(a, b)| a == b)
+                .count()
+                .min(u16::MAX as usize);
+            if shared >= MIN_PREFIX && best.is_none_or(|(_, len)| shared > len) {
+                best = Some((slot, shared));
+            }
+        }
+        best
+    }
+
+    /// Append one encoded line to `out` and learn it.
+    ///
+    /// Format per record: `0x00 len(u16) bytes` for a literal, or
+    /// `0x01 slot(u8) prefix(u16) suffix_len(u16) suffix` for a reference.
+    pub fn encode_line(&mut self, line: &[u8], out: &mut Vec<u8>) {
+        match self.best_reference(line) {
+            Some((slot, prefix)) if prefix >= MIN_PREFIX => {
+                let suffix = &line[prefix..];
+                out.push(0x01);
+                out.push(slot as u8);
+                out.extend_from_slice(&(prefix as u16).to_le_bytes());
+                out.extend_from_slice(&(suffix.len().min(u16::MAX as usize) as u16).to_le_bytes());
+                out.extend_from_slice(suffix);
+            }
+            _ => {
+                out.push(0x00);
+                out.extend_from_slice(&(line.len().min(u16::MAX as usize) as u16).to_le_bytes());
+                out.extend_from_slice(line);
+            }
+        }
+        self.learn(line);
+    }
+
+    /// Decode the next line from `input` at `pos`, learning it; advances
+    /// `pos` past the record.
+    pub fn decode_line(
+        &mut self,
+        input: &[u8],
+        pos: &mut usize,
+    ) -> Result<Vec<u8>, DictDecodeError> {
+        let tag = *input.get(*pos).ok_or(DictDecodeError::Truncated)?;
+        *pos += 1;
+        let take = |pos: &mut usize, len: usize| -> Result<&[u8], DictDecodeError> {
+            let end = pos.checked_add(len).ok_or(DictDecodeError::Truncated)?;
+            let slice = input.get(*pos..end).ok_or(DictDecodeError::Truncated)?;
+            *pos = end;
+            Ok(slice)
+        };
+        let line = match tag {
+            0x00 => {
+                let len = u16::from_le_bytes(take(pos, 2)?.try_into().expect("len checked"));
+                take(pos, usize::from(len))?.to_vec()
+            }
+            0x01 => {
+                let slot = usize::from(*take(pos, 1)?.first().ok_or(DictDecodeError::Truncated)?);
+                let prefix = u16::from_le_bytes(take(pos, 2)?.try_into().expect("len checked"));
+                let suffix_len = u16::from_le_bytes(take(pos, 2)?.try_into().expect("len checked"));
+                let entry = self.slots.get(slot).ok_or(DictDecodeError::BadSlot)?;
+                if usize::from(prefix) > entry.len() {
+                    return Err(DictDecodeError::BadSlot);
+                }
+                let mut line = entry[..usize::from(prefix)].to_vec();
+                line.extend_from_slice(take(pos, usize::from(suffix_len))?);
+                line
+            }
+            _ => return Err(DictDecodeError::Truncated),
+        };
+        self.learn(&line);
+        Ok(line)
+    }
+}
+
+/// Encode a whole newline-delimited buffer with a fresh dictionary.
+pub fn encode_lines(raw: &[u8]) -> Vec<u8> {
+    let mut codec = LineDictCodec::new();
+    let mut out = Vec::with_capacity(raw.len() / 2 + 8);
+    for line in raw.split_inclusive(|byte| *byte == b'\n') {
+        codec.encode_line(line, &mut out);
+    }
+    out
+}
+
+/// Decode a buffer produced by [`encode_lines`].
+pub fn decode_lines(encoded: &[u8]) -> Result<Vec<u8>, DictDecodeError> {
+    let mut codec = LineDictCodec::new();
+    let mut out = Vec::with_capacity(encoded.len() * 2);
+    let mut pos = 0usize;
+    while pos < encoded.len() {
+        let line = codec.decode_line(encoded, &mut pos)?;
+        out.extend_from_slice(&line);
+    }
+    Ok(out)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn repetitive_lines_compress_roughly_4x() {
+        let mut raw = Vec::new();
+        for idx in 0..512 {
+            raw.extend_from_slice(
+                format!(
+                    "{{\"schema\":\"telemetry/v1\",\"worker\":\"worker-42\",\"temp_c\":41.5,\"seq\":{idx}}}\n"
+                )
+                .as_bytes(),
+            );
+        }
+        let encoded = encode_lines(&raw);
+        assert!(
+            encoded.len() * 4 < raw.len(),
+            "expected ~4x on repetitive lines, got {} -> {}",
+            raw.len(),
+            encoded.len()
+        );
+        assert_eq!(decode_lines(&encoded).expect("decode"), raw);
+    }
+
+    #[test]
+    fn mixed_and_binary_lines_roundtrip() {
+        let mut raw = Vec::new();
+        raw.extend_from_slice(b"short\n");
+        raw.extend_from_slice(&[0u8, 1, 2, 3, 254, 255]);
+        raw.extend_from_slice(b"\nanother line entirely different\n");
+        let encoded = encode_lines(&raw);
+        assert_eq!(decode_lines(&encoded).expect("decode"), raw);
+        let mut truncated = encoded.clone();
+        truncated.truncate(encoded.len() - 2);
+        assert!(decode_lines(&truncated).is_err());
+    }
+}
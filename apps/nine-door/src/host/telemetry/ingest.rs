@@ -4,7 +4,7 @@
 // Author: Lukas Bower
 #![forbid(unsafe_code)]
 
-use std::collections::{HashMap, VecDeque};
+use std::collections::{BTreeMap, HashMap, VecDeque};
 
 /// Maximum bytes permitted per telemetry ingest record.
 pub const MAX_TELEMETRY_RECORD_BYTES: usize = 4096;
@@ -75,10 +75,64 @@ pub(crate) struct TelemetryIngestError {
     pub message: String,
 }
 
+/// Byte stride between sparse index checkpoints within a segment.
+const SEGMENT_INDEX_STRIDE_BYTES: usize = 4 * 1024;
+
+/// Sparse index checkpoint: the byte offset at which a record starts.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) struct SegmentIndexEntry {
+    /// Byte offset of a record boundary within the segment.
+    pub offset: usize,
+    /// Ordinal of the record starting at `offset`.
+    pub record: u64,
+}
+
 #[derive(Debug, Clone)]
 struct TelemetrySegmentState {
     id: String,
     bytes: usize,
+    records: u64,
+    /// Record-boundary checkpoints every [`SEGMENT_INDEX_STRIDE_BYTES`],
+    /// kept sorted by construction so seeks binary-search instead of
+    /// walking the segment from the start.
+    index: Vec<SegmentIndexEntry>,
+}
+
+/// Rolling sample window maintained per metric per device.
+#[derive(Debug, Clone, Default)]
+struct MetricWindow {
+    samples: VecDeque<f64>,
+}
+
+/// Samples retained per metric; dashboards read 1 Hz aggregates over this
+/// window instead of pulling the raw 10 Hz stream.
+const METRIC_WINDOW_SAMPLES: usize = 64;
+
+impl MetricWindow {
+    fn push(&mut self, value: f64) {
+        if self.samples.len() == METRIC_WINDOW_SAMPLES {
+            self.samples.pop_front();
+        }
+        self.samples.push_back(value);
+    }
+
+    fn render(&self, name: &str, out: &mut String) {
+        use std::fmt::Write as _;
+        if self.samples.is_empty() {
+            return;
+        }
+        let mut sorted: Vec<f64> = self.samples.iter().copied().collect();
+        sorted.sort_unstable_by(|a, b| a.partial_cmp(b).unwrap_or(std::cmp::Ordering::Equal));
+        let min = sorted[0];
+        let max = sorted[sorted.len() - 1];
+        let mean = sorted.iter().sum::<f64>() / sorted.len() as f64;
+        let p99 = sorted[((sorted.len() - 1) * 99) / 100];
+        let _ = writeln!(
+            out,
+            "metric={name} n={} min={min:.3} max={max:.3} mean={mean:.3} p99={p99:.3}",
+            sorted.len()
+        );
+    }
 }
 
 #[derive(Debug, Clone)]
@@ -86,6 +140,7 @@ struct TelemetryDeviceState {
     next_id: u64,
     total_bytes: usize,
     segments: VecDeque<TelemetrySegmentState>,
+    metrics: BTreeMap<String, MetricWindow>,
 }
 
 impl TelemetryDeviceState {
@@ -94,6 +149,7 @@ impl TelemetryDeviceState {
             next_id: 1,
             total_bytes: 0,
             segments: VecDeque::new(),
+            metrics: BTreeMap::new(),
         }
     }
 
@@ -133,6 +189,14 @@ impl TelemetryIngestState {
             .or_insert_with(TelemetryDeviceState::new);
     }
 
+    /// Identifier of the most recently created segment for a device.
+    pub fn latest_segment(&self, device_id: &str) -> Option<String> {
+        self.devices
+            .get(device_id)
+            .and_then(|device| device.segments.back())
+            .map(|segment| segment.id.clone())
+    }
+
     pub fn create_segment(
         &mut self,
         device_id: &str,
@@ -179,10 +243,74 @@ impl TelemetryIngestState {
         device.segments.push_back(TelemetrySegmentState {
             id: seg_id.clone(),
             bytes: 0,
+            records: 0,
+            index: vec![SegmentIndexEntry {
+                offset: 0,
+                record: 0,
+            }],
         });
         Ok(TelemetryCreateOutcome { seg_id, evicted })
     }
 
+    /// Feed numeric fields from a record into the device's rolling windows.
+    ///
+    /// Records are flat JSON with repetitive shapes; a small scanner pulls
+    /// `"key":number` pairs without a full parser, so the ingest hot path
+    /// pays a single pass over the payload. Bounded to 16 metrics per device
+    /// to keep hostile payloads from growing the table.
+    pub fn record_metrics(&mut self, device_id: &str, payload: &[u8]) {
+        let Ok(text) = std::str::from_utf8(payload) else {
+            return;
+        };
+        let Some(device) = self.devices.get_mut(device_id) else {
+            return;
+        };
+        for (key, value) in scan_numeric_fields(text) {
+            if device.metrics.len() >= 16 && !device.metrics.contains_key(key) {
+                continue;
+            }
+            device
+                .metrics
+                .entry(key.to_owned())
+                .or_default()
+                .push(value);
+        }
+    }
+
+    /// Render the device's rolling aggregates for the sibling `agg` file.
+    pub fn render_aggregates(&self, device_id: &str) -> String {
+        let mut out = String::new();
+        if let Some(device) = self.devices.get(device_id) {
+            for (name, window) in &device.metrics {
+                window.render(name, &mut out);
+            }
+        }
+        out
+    }
+
+    /// Return the nearest indexed record boundary at or before `offset`.
+    ///
+    /// Forensics seeks start decoding records from the returned checkpoint
+    /// instead of the segment start; with the 4 KiB stride a 256 MB ring
+    /// costs a binary search plus at most one stride of linear decode.
+    #[allow(dead_code)] // consumed by forensics seek paths and tests
+    pub fn nearest_record_boundary(
+        &self,
+        device_id: &str,
+        seg_id: &str,
+        offset: usize,
+    ) -> Option<SegmentIndexEntry> {
+        let device = self.devices.get(device_id)?;
+        let segment = device
+            .segments
+            .iter()
+            .find(|segment| segment.id == seg_id)?;
+        let position = segment
+            .index
+            .partition_point(|entry| entry.offset <= offset);
+        segment.index.get(position.checked_sub(1)?).copied()
+    }
+
     pub fn append_record(
         &mut self,
         device_id: &str,
@@ -263,9 +391,109 @@ impl TelemetryIngestState {
             .iter_mut()
             .find(|segment| segment.id == seg_id)
         {
+            // Checkpoint the record boundary when this append crosses a
+            // stride boundary, keeping seeks O(log n) over the index.
+            let crossed = segment.bytes / SEGMENT_INDEX_STRIDE_BYTES
+                != segment.bytes.saturating_add(bytes) / SEGMENT_INDEX_STRIDE_BYTES;
+            if crossed {
+                segment.index.push(SegmentIndexEntry {
+                    offset: segment.bytes,
+                    record: segment.records,
+                });
+            }
             segment.bytes = segment.bytes.saturating_add(bytes);
+            segment.records = segment.records.saturating_add(1);
             device.total_bytes = device.total_bytes.saturating_add(bytes);
         }
         Ok(TelemetryAppendOutcome { evicted })
     }
 }
+
+/// Scan flat `"key":number` pairs out of a JSON-ish line.
+fn scan_numeric_fields(text: &str) -> impl Iterator<Item = (&str, f64)> {
+    let bytes = text.as_bytes();
+    let mut results = Vec::new();
+    let mut pos = 0usize;
+    while let Some(quote) = text[pos..].find('"') {
+        let key_start = pos + quote + 1;
+        let Some(key_len) = text[key_start..].find('"') else {
+            break;
+        };
+        let key_end = key_start + key_len;
+        let mut cursor = key_end + 1;
+        while cursor < bytes.len() && bytes[cursor].is_ascii_whitespace() {
+            cursor += 1;
+        }
+        if cursor < bytes.len() && bytes[cursor] == b':' {
+            cursor += 1;
+            while cursor < bytes.len() && bytes[cursor].is_ascii_whitespace() {
+                cursor += 1;
+            }
+            let value_start = cursor;
+            while cursor < bytes.len()
+                && (bytes[cursor].is_ascii_digit()
+                    || bytes[cursor] == b'-'
+                    || bytes[cursor] == b'+'
+                    || bytes[cursor] == b'.'
+                    || bytes[cursor] == b'e'
+                    || bytes[cursor] == b'E')
+            {
+                cursor += 1;
+            }
+            if cursor > value_start {
+                if let Ok(value) = text[value_start..cursor].parse::<f64>() {
+                    results.push((&text[key_start..key_end], value));
+                }
+            }
+        }
+        pos = key_end + 1;
+    }
+    results.into_iter()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn state() -> TelemetryIngestState {
+        TelemetryIngestState::new(TelemetryIngestConfig {
+            max_segments_per_device: 4,
+            max_bytes_per_segment: 64 * 1024,
+            max_total_bytes_per_device: 256 * 1024,
+            eviction_policy: TelemetryIngestEvictionPolicy::Refuse,
+        })
+    }
+
+    #[test]
+    fn sparse_index_tracks_record_boundaries() {
+        let mut ingest = state();
+        let seg = ingest.create_segment("device-1").expect("segment").seg_id;
+        // 100 records of 100 bytes cross the 4 KiB stride every ~41 records.
+        for _ in 0..100 {
+            ingest.append_record("device-1", &seg, 100).expect("append");
+        }
+        let base = ingest
+            .nearest_record_boundary("device-1", &seg, 0)
+            .expect("base entry");
+        assert_eq!(
+            base,
+            SegmentIndexEntry {
+                offset: 0,
+                record: 0
+            }
+        );
+        let mid = ingest
+            .nearest_record_boundary("device-1", &seg, 5000)
+            .expect("mid entry");
+        assert!(mid.offset <= 5000);
+        assert!(5000 - mid.offset < SEGMENT_INDEX_STRIDE_BYTES + 100);
+        assert_eq!(mid.offset, mid.record as usize * 100);
+        let end = ingest
+            .nearest_record_boundary("device-1", &seg, usize::MAX)
+            .expect("tail entry");
+        assert!(end.offset > mid.offset);
+        assert!(ingest
+            .nearest_record_boundary("device-1", "seg-999999", 0)
+            .is_none());
+    }
+}
@@ -3,7 +3,9 @@
 // Purpose: Coordinate telemetry ring buffers, cursor state, and audit output.
 // Author: Lukas Bower
 
+pub mod compress;
 pub mod cursor;
+pub mod dict;
 pub mod ingest;
 pub mod ring;
 
@@ -11,9 +13,12 @@ pub use ingest::{TelemetryIngestConfig, TelemetryIngestEvictionPolicy};
 
 use std::collections::HashMap;
 use std::sync::{Arc, Mutex};
+use std::time::Instant;
 
 use cursor::{CursorError, CursorResolution, TelemetryCursor, TelemetryCursorSnapshot};
-use ring::{RingReadError, RingReadOutcome, RingWriteError, TelemetryRing, TelemetryRingSnapshot};
+use ring::{
+    RingReadError, RingReadOutcome, RingView, RingWriteError, TelemetryRing, TelemetryRingSnapshot,
+};
 use secure9p_core::append_only_write_bounds;
 
 /// Severity level for telemetry audit lines.
@@ -138,12 +143,27 @@ impl TelemetryManifestStore {
     }
 }
 
+/// Number of consecutive sequential reads before tail prefetch kicks in.
+const PREFETCH_SEQUENTIAL_THRESHOLD: u32 = 2;
+
+/// Ring region staged for the next sequential tail read.
+#[derive(Debug, Clone)]
+struct TailPrefetch {
+    offset: u64,
+    data: Vec<u8>,
+}
+
 /// Append-only telemetry file backed by a ring buffer and cursor.
 #[derive(Debug, Clone)]
 pub struct TelemetryFile {
     ring: TelemetryRing,
     cursor: TelemetryCursor,
     frame_schema: TelemetryFrameSchema,
+    sequential_reads: u32,
+    prefetch: Option<TailPrefetch>,
+    last_append: Option<Instant>,
+    ewma_append_interval_ms: Option<u64>,
+    reader_view: Option<RingView>,
 }
 
 /// Result of a telemetry append operation.
@@ -162,6 +182,9 @@ pub struct TelemetryReadOutcome {
     pub data: Vec<u8>,
     /// Optional audit entry to persist.
     pub audit: Option<TelemetryAudit>,
+    /// Suggested delay before the next poll, derived from the observed
+    /// append rate. `None` when the ring has not seen enough appends.
+    pub poll_hint_ms: Option<u64>,
 }
 
 /// Error returned when telemetry IO fails.
@@ -197,6 +220,11 @@ impl TelemetryFile {
             ring,
             cursor,
             frame_schema: config.frame_schema,
+            sequential_reads: 0,
+            prefetch: None,
+            last_append: None,
+            ewma_append_interval_ms: None,
+            reader_view: None,
         }
     }
 
@@ -221,6 +249,11 @@ impl TelemetryFile {
             ring,
             cursor,
             frame_schema: config.frame_schema,
+            sequential_reads: 0,
+            prefetch: None,
+            last_append: None,
+            ewma_append_interval_ms: None,
+            reader_view: None,
         })
     }
 
@@ -288,6 +321,9 @@ impl TelemetryFile {
                 kind: TelemetryErrorKind::QuotaExceeded,
             });
         }
+        // Appends only invalidate read-ahead state when the wrap drops the
+        // staged region behind the retained window; data already staged for a
+        // tail reader is immutable in the append-only model.
         let outcome = self.ring.append(data).map_err(|err| match err {
             RingWriteError::Oversize {
                 requested,
@@ -301,6 +337,22 @@ impl TelemetryFile {
                 kind: TelemetryErrorKind::QuotaExceeded,
             },
         })?;
+        if let Some(prefetch) = &self.prefetch {
+            if outcome.dropped_bytes > 0 && outcome.new_base > prefetch.offset {
+                self.prefetch = None;
+            }
+        }
+        let now = Instant::now();
+        if let Some(last) = self.last_append {
+            let interval = now.duration_since(last).as_millis() as u64;
+            self.ewma_append_interval_ms = Some(match self.ewma_append_interval_ms {
+                // Standard EWMA with alpha 1/4 keeps the hint stable across
+                // bursty producers without drifting on one outlier.
+                Some(ewma) => ewma - ewma / 4 + interval / 4,
+                None => interval,
+            });
+        }
+        self.last_append = Some(now);
         let audit = if outcome.dropped_bytes > 0 {
             Some(TelemetryAudit::new(
                 TelemetryAuditLevel::Warn,
@@ -355,27 +407,171 @@ impl TelemetryFile {
                     kind: TelemetryErrorKind::CursorStale,
                 },
             })?;
-        let RingReadOutcome { data } = self.ring.read(offset, count).map_err(|err| match err {
-            RingReadError::Stale {
-                requested,
-                available_start,
-            } => TelemetryError {
-                message: format!(
-                    "telemetry cursor stale requested={} rewind_to={}",
-                    requested, available_start
-                ),
-                audit: Some(TelemetryAudit::new(
-                    TelemetryAuditLevel::Warn,
-                    format!(
-                        "telemetry cursor stale requested={} rewind_to={}",
-                        requested, available_start
-                    ),
-                )),
-                kind: TelemetryErrorKind::CursorStale,
-            },
-        })?;
+        let sequential = self
+            .cursor
+            .snapshot()
+            .last_offset
+            .is_some_and(|last| last == offset);
+        if sequential {
+            self.sequential_reads = self.sequential_reads.saturating_add(1);
+        } else {
+            self.sequential_reads = 0;
+            self.prefetch = None;
+        }
+        // Serve a staged read-ahead region without touching the ring when the
+        // tail reader continues sequentially.
+        if let Some(prefetch) = self.prefetch.take() {
+            if prefetch.offset == offset && !prefetch.data.is_empty() {
+                let take = prefetch.data.len().min(count as usize);
+                let data: Vec<u8> = prefetch.data[..take].to_vec();
+                let next = offset.saturating_add(data.len() as u64);
+                self.cursor.advance(next);
+                self.stage_prefetch(next, count);
+                return Ok(TelemetryReadOutcome {
+                    data,
+                    audit,
+                    poll_hint_ms: self.poll_hint_ms(),
+                });
+            }
+        }
+        let RingReadOutcome { data } =
+            self.reader_view()
+                .read(offset, count)
+                .map_err(|err| match err {
+                    RingReadError::Stale {
+                        requested,
+                        available_start,
+                    } => TelemetryError {
+                        message: format!(
+                            "telemetry cursor stale requested={} rewind_to={}",
+                            requested, available_start
+                        ),
+                        audit: Some(TelemetryAudit::new(
+                            TelemetryAuditLevel::Warn,
+                            format!(
+                                "telemetry cursor stale requested={} rewind_to={}",
+                                requested, available_start
+                            ),
+                        )),
+                        kind: TelemetryErrorKind::CursorStale,
+                    },
+                })?;
         let next = offset.saturating_add(data.len() as u64);
         self.cursor.advance(next);
-        Ok(TelemetryReadOutcome { data, audit })
+        if self.sequential_reads >= PREFETCH_SEQUENTIAL_THRESHOLD {
+            self.stage_prefetch(next, count);
+        }
+        Ok(TelemetryReadOutcome {
+            data,
+            audit,
+            poll_hint_ms: self.poll_hint_ms(),
+        })
+    }
+
+    /// Suggested next-poll delay from the smoothed append interval: readers
+    /// of a hot ring are told to come back quickly, idle rings push tails out
+    /// toward their policy maximum instead of burning empty round trips.
+    #[must_use]
+    pub fn poll_hint_ms(&self) -> Option<u64> {
+        let interval = self.ewma_append_interval_ms?;
+        // Also account for silence since the last append: a ring that has
+        // gone quiet should not keep advertising its historical burst rate.
+        let silence = self
+            .last_append
+            .map(|at| at.elapsed().as_millis() as u64)
+            .unwrap_or(0);
+        Some(interval.max(silence / 2).clamp(10, 10_000))
+    }
+
+    /// Shared immutable view of the ring for the current generation.
+    ///
+    /// All concurrent cursors on this file (swarmui, `coh telemetry pull`,
+    /// audit tails) read through one view per ring generation: the segments
+    /// are reference-shared, so N readers cost refcount bumps instead of N
+    /// independent window copies, and a view handed out to a shard thread
+    /// stays consistent while the ingest path keeps appending.
+    pub fn reader_view(&mut self) -> &RingView {
+        let generation = self.ring.generation();
+        if self
+            .reader_view
+            .as_ref()
+            .is_none_or(|view| view.generation() != generation)
+        {
+            self.reader_view = Some(self.ring.view());
+        }
+        self.reader_view
+            .as_ref()
+            .expect("reader view populated above")
+    }
+
+    /// Stage the next ring region for an established sequential reader so the
+    /// following Tread is answered from the ready buffer.
+    fn stage_prefetch(&mut self, offset: u64, count: u32) {
+        self.prefetch = None;
+        let bounds = self.ring.bounds();
+        if offset >= bounds.next_offset {
+            return;
+        }
+        if let Ok(RingReadOutcome { data }) = self.ring.read(offset, count) {
+            if !data.is_empty() {
+                self.prefetch = Some(TailPrefetch { offset, data });
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn config(capacity: usize) -> TelemetryConfig {
+        TelemetryConfig {
+            ring_bytes_per_worker: capacity,
+            frame_schema: TelemetryFrameSchema::LegacyPlaintext,
+            cursor: TelemetryCursorConfig {
+                retain_on_boot: false,
+            },
+        }
+    }
+
+    #[test]
+    fn sequential_tail_reads_match_ring_contents() {
+        let mut file = TelemetryFile::new(config(256));
+        for idx in 0..8 {
+            let line = format!("line-{idx}\n");
+            file.append(u64::MAX, line.as_bytes()).expect("append");
+        }
+        let mut offset = 0u64;
+        let mut collected = Vec::new();
+        loop {
+            let outcome = file.read(offset, 16).expect("read");
+            if outcome.data.is_empty() {
+                break;
+            }
+            offset += outcome.data.len() as u64;
+            collected.extend_from_slice(&outcome.data);
+        }
+        let expected: String = (0..8).map(|idx| format!("line-{idx}\n")).collect();
+        assert_eq!(collected, expected.as_bytes());
+        // The established sequential reader staged a (now empty) region and
+        // keeps answering correctly once new data arrives.
+        file.append(u64::MAX, b"after\n").expect("append");
+        let outcome = file.read(offset, 64).expect("tail read");
+        assert_eq!(outcome.data, b"after\n");
+    }
+
+    #[test]
+    fn wraparound_invalidates_stale_prefetch() {
+        let mut file = TelemetryFile::new(config(32));
+        file.append(u64::MAX, b"0123456789abcdef").expect("append");
+        // Establish a sequential stream so read-ahead is staged.
+        assert_eq!(file.read(0, 4).expect("read").data, b"0123");
+        assert_eq!(file.read(4, 4).expect("read").data, b"4567");
+        assert_eq!(file.read(8, 4).expect("read").data, b"89ab");
+        // Wrap far enough to drop the staged region.
+        file.append(u64::MAX, b"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX")
+            .expect("wrap append");
+        let bounds_err = file.read(12, 4);
+        assert!(bounds_err.is_err(), "stale offset must be rejected");
     }
 }
@@ -3,21 +3,80 @@
 // Purpose: Provide bounded append-only ring storage for worker telemetry.
 // Author: Lukas Bower
 
+use std::sync::Arc;
+
 use secure9p_core::{append_only_read_bounds, AppendOnlyOffsetError};
 
+/// Byte size of one shared ring segment. Snapshots share segments by
+/// reference, so after a persist only the segments dirtied by subsequent
+/// appends are copied again (copy-on-write via `Arc::make_mut`).
+const SEGMENT_BYTES: usize = 64 * 1024;
+
 /// Bounded ring buffer for telemetry payloads.
+///
+/// Storage is split into fixed-size segments shared with snapshots through
+/// reference counting: `snapshot()` is a reference bump per segment instead of
+/// a bulk copy of the ring, and `restore()` adopts the shared segments without
+/// deserialising. Appends copy-on-write only the segments they touch.
 #[derive(Debug, Clone)]
 pub struct TelemetryRing {
-    buffer: Vec<u8>,
+    segments: Vec<Arc<Vec<u8>>>,
+    segment_len: usize,
+    capacity: usize,
+    base_offset: u64,
+    next_offset: u64,
+    generation: u64,
+}
+
+/// Immutable, shareable view of the ring at one generation.
+///
+/// Views hold segment references, so building one is a refcount bump per
+/// segment and N concurrent readers share the same backing bytes instead of
+/// each forcing its own copy of the window. A view stays valid (and
+/// internally consistent) while the live ring keeps appending, thanks to the
+/// copy-on-write segments.
+#[derive(Debug, Clone)]
+pub struct RingView {
+    segments: Vec<Arc<Vec<u8>>>,
+    segment_len: usize,
     capacity: usize,
     base_offset: u64,
     next_offset: u64,
+    generation: u64,
+}
+
+impl RingView {
+    /// Generation of the ring this view was taken at.
+    pub fn generation(&self) -> u64 {
+        self.generation
+    }
+
+    /// Return the view's retained offset window.
+    pub fn bounds(&self) -> RingBounds {
+        RingBounds {
+            base_offset: self.base_offset,
+            next_offset: self.next_offset,
+        }
+    }
+
+    /// Read telemetry bytes at the supplied offset from the frozen view.
+    pub fn read(&self, offset: u64, count: u32) -> Result<RingReadOutcome, RingReadError> {
+        read_window(
+            &self.segments,
+            self.segment_len,
+            self.capacity,
+            self.base_offset,
+            self.next_offset,
+            offset,
+            count,
+        )
+    }
 }
 
-/// Persisted snapshot of the ring state.
+/// Persisted snapshot of the ring state sharing the ring's segments.
 #[derive(Debug, Clone)]
 pub struct TelemetryRingSnapshot {
-    pub buffer: Vec<u8>,
+    pub segments: Vec<Arc<Vec<u8>>>,
     pub capacity: usize,
     pub base_offset: u64,
     pub next_offset: u64,
@@ -67,15 +126,29 @@ pub enum RingReadError {
     },
 }
 
+fn build_segments(capacity: usize, segment_len: usize) -> Vec<Arc<Vec<u8>>> {
+    let mut segments = Vec::with_capacity(capacity.div_ceil(segment_len));
+    let mut remaining = capacity;
+    while remaining > 0 {
+        let len = remaining.min(segment_len);
+        segments.push(Arc::new(vec![0; len]));
+        remaining -= len;
+    }
+    segments
+}
+
 impl TelemetryRing {
     /// Construct a ring buffer with the given capacity.
     pub fn new(capacity: usize) -> Self {
         let capacity = capacity.max(1);
+        let segment_len = capacity.min(SEGMENT_BYTES);
         Self {
-            buffer: vec![0; capacity],
+            segments: build_segments(capacity, segment_len),
+            segment_len,
             capacity,
             base_offset: 0,
             next_offset: 0,
+            generation: 0,
         }
     }
 
@@ -92,21 +165,53 @@ impl TelemetryRing {
         }
     }
 
-    /// Snapshot the ring state for persistence.
+    /// Generation counter, bumped on every append; readers cache one
+    /// [`RingView`] per generation.
+    pub fn generation(&self) -> u64 {
+        self.generation
+    }
+
+    /// Take an immutable shareable view of the ring at its current
+    /// generation. Costs one refcount bump per segment.
+    pub fn view(&self) -> RingView {
+        RingView {
+            segments: self.segments.clone(),
+            segment_len: self.segment_len,
+            capacity: self.capacity,
+            base_offset: self.base_offset,
+            next_offset: self.next_offset,
+            generation: self.generation,
+        }
+    }
+
+    /// Snapshot the ring state for persistence. Segments are shared by
+    /// reference; no ring data is copied here.
     pub fn snapshot(&self) -> TelemetryRingSnapshot {
         TelemetryRingSnapshot {
-            buffer: self.buffer.clone(),
+            segments: self.segments.clone(),
             capacity: self.capacity,
             base_offset: self.base_offset,
             next_offset: self.next_offset,
         }
     }
 
-    /// Restore a ring from a persisted snapshot.
+    /// Restore a ring from a persisted snapshot, adopting its segments.
     pub fn restore(snapshot: TelemetryRingSnapshot) -> Option<Self> {
-        if snapshot.capacity == 0 || snapshot.buffer.len() != snapshot.capacity {
+        if snapshot.capacity == 0 {
             return None;
         }
+        let total: usize = snapshot.segments.iter().map(|segment| segment.len()).sum();
+        if total != snapshot.capacity {
+            return None;
+        }
+        let segment_len = snapshot.segments.first().map(|s| s.len())?;
+        // All segments except the last must share the uniform length the
+        // index math relies on.
+        for segment in &snapshot.segments[..snapshot.segments.len() - 1] {
+            if segment.len() != segment_len {
+                return None;
+            }
+        }
         if snapshot.base_offset > snapshot.next_offset {
             return None;
         }
@@ -115,13 +220,31 @@ impl TelemetryRing {
             return None;
         }
         Some(Self {
-            buffer: snapshot.buffer,
+            segments: snapshot.segments,
+            segment_len,
             capacity: snapshot.capacity,
             base_offset: snapshot.base_offset,
             next_offset: snapshot.next_offset,
+            generation: 0,
         })
     }
 
+    /// Copy `data` into the ring starting at physical position `start`,
+    /// copy-on-writing only the segments the span touches.
+    fn write_span(&mut self, start: usize, data: &[u8]) {
+        let mut pos = start;
+        let mut remaining = data;
+        while !remaining.is_empty() {
+            let segment_idx = pos / self.segment_len;
+            let segment_off = pos - segment_idx * self.segment_len;
+            let segment = Arc::make_mut(&mut self.segments[segment_idx]);
+            let len = remaining.len().min(segment.len() - segment_off);
+            segment[segment_off..segment_off + len].copy_from_slice(&remaining[..len]);
+            pos += len;
+            remaining = &remaining[len..];
+        }
+    }
+
     /// Append telemetry bytes, wrapping and dropping old data as needed.
     pub fn append(&mut self, data: &[u8]) -> Result<RingWriteOutcome, RingWriteError> {
         if data.is_empty() {
@@ -146,12 +269,12 @@ impl TelemetryRing {
 
         let start = (self.next_offset % self.capacity as u64) as usize;
         let first_len = (self.capacity - start).min(data.len());
-        self.buffer[start..start + first_len].copy_from_slice(&data[..first_len]);
+        self.write_span(start, &data[..first_len]);
         if first_len < data.len() {
-            let remaining = data.len() - first_len;
-            self.buffer[..remaining].copy_from_slice(&data[first_len..]);
+            self.write_span(0, &data[first_len..]);
         }
         self.next_offset = self.next_offset.saturating_add(data.len() as u64);
+        self.generation = self.generation.wrapping_add(1);
 
         Ok(RingWriteOutcome {
             count: data.len() as u32,
@@ -162,34 +285,106 @@ impl TelemetryRing {
 
     /// Read telemetry bytes at the supplied offset.
     pub fn read(&self, offset: u64, count: u32) -> Result<RingReadOutcome, RingReadError> {
-        let bounds = self.bounds();
-        let read_bounds =
-            append_only_read_bounds(offset, bounds.base_offset, bounds.next_offset, count)
-                .map_err(|err| match err {
-                    AppendOnlyOffsetError::Stale {
-                        requested,
-                        available_start,
-                    } => RingReadError::Stale {
-                        requested,
-                        available_start,
-                    },
-                    AppendOnlyOffsetError::Invalid { .. } => RingReadError::Stale {
-                        requested: offset,
-                        available_start: bounds.base_offset,
-                    },
-                })?;
-        if read_bounds.len == 0 {
-            return Ok(RingReadOutcome { data: Vec::new() });
-        }
-
-        let start = (read_bounds.offset % self.capacity as u64) as usize;
-        let first_len = (self.capacity - start).min(read_bounds.len);
-        let mut out = Vec::with_capacity(read_bounds.len);
-        out.extend_from_slice(&self.buffer[start..start + first_len]);
-        if first_len < read_bounds.len {
-            let remaining = read_bounds.len - first_len;
-            out.extend_from_slice(&self.buffer[..remaining]);
-        }
-        Ok(RingReadOutcome { data: out })
+        read_window(
+            &self.segments,
+            self.segment_len,
+            self.capacity,
+            self.base_offset,
+            self.next_offset,
+            offset,
+            count,
+        )
+    }
+}
+
+/// Shared read implementation over a frozen set of segments.
+#[allow(clippy::too_many_arguments)]
+fn read_window(
+    segments: &[Arc<Vec<u8>>],
+    segment_len: usize,
+    capacity: usize,
+    base_offset: u64,
+    next_offset: u64,
+    offset: u64,
+    count: u32,
+) -> Result<RingReadOutcome, RingReadError> {
+    let read_bounds = append_only_read_bounds(offset, base_offset, next_offset, count).map_err(
+        |err| match err {
+            AppendOnlyOffsetError::Stale {
+                requested,
+                available_start,
+            } => RingReadError::Stale {
+                requested,
+                available_start,
+            },
+            AppendOnlyOffsetError::Invalid { .. } => RingReadError::Stale {
+                requested: offset,
+                available_start: base_offset,
+            },
+        },
+    )?;
+    if read_bounds.len == 0 {
+        return Ok(RingReadOutcome { data: Vec::new() });
+    }
+
+    let copy_span = |start: usize, len: usize, out: &mut Vec<u8>| {
+        let mut pos = start;
+        let mut remaining = len;
+        while remaining > 0 {
+            let segment_idx = pos / segment_len;
+            let segment_off = pos - segment_idx * segment_len;
+            let segment = &segments[segment_idx];
+            let take = remaining.min(segment.len() - segment_off);
+            out.extend_from_slice(&segment[segment_off..segment_off + take]);
+            pos += take;
+            remaining -= take;
+        }
+    };
+    let start = (read_bounds.offset % capacity as u64) as usize;
+    let first_len = (capacity - start).min(read_bounds.len);
+    let mut out = Vec::with_capacity(read_bounds.len);
+    copy_span(start, first_len, &mut out);
+    if first_len < read_bounds.len {
+        copy_span(0, read_bounds.len - first_len, &mut out);
+    }
+    Ok(RingReadOutcome { data: out })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn snapshot_shares_segments_until_dirtied() {
+        let mut ring = TelemetryRing::new(4096);
+        ring.append(b"hello").expect("append");
+        let snapshot = ring.snapshot();
+        assert!(Arc::ptr_eq(&snapshot.segments[0], &ring.segments[0]));
+        ring.append(b"world").expect("append after snapshot");
+        // The dirtied segment was copied-on-write; the snapshot kept the old data.
+        assert!(!Arc::ptr_eq(&snapshot.segments[0], &ring.segments[0]));
+        let restored = TelemetryRing::restore(snapshot).expect("restore");
+        assert_eq!(restored.read(0, 16).expect("read").data, b"hello");
+        assert_eq!(ring.read(0, 16).expect("read").data, b"helloworld");
+    }
+
+    #[test]
+    fn wraparound_spans_segment_boundaries() {
+        let mut ring = TelemetryRing::new(8);
+        ring.append(b"abcdef").expect("append");
+        ring.append(b"ghij").expect("wrap");
+        let bounds = ring.bounds();
+        assert_eq!(bounds.next_offset, 10);
+        assert_eq!(bounds.base_offset, 2);
+        let out = ring.read(2, 8).expect("read window");
+        assert_eq!(out.data, b"cdefghij");
+    }
+
+    #[test]
+    fn restore_rejects_mismatched_segments() {
+        let ring = TelemetryRing::new(1024);
+        let mut snapshot = ring.snapshot();
+        snapshot.capacity = 2048;
+        assert!(TelemetryRing::restore(snapshot).is_none());
     }
 }
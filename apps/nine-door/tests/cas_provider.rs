@@ -94,6 +94,7 @@ fn cas_missing_signature_rejected() {
         payload_bytes: 16,
         payload_sha256: digest_bytes,
         chunks: vec![digest_bytes],
+        chunk_lens: None,
         delta: None,
         signature: None,
     };
@@ -162,6 +163,7 @@ fn build_signed_manifest(
         payload_bytes: chunk_bytes as u64,
         payload_sha256,
         chunks: vec![digest],
+        chunk_lens: None,
         delta: None,
         signature: None,
     };
@@ -0,0 +1,91 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Exercise the sharded session dispatcher threads and metrics.
+// Author: Lukas Bower
+#![forbid(unsafe_code)]
+
+use nine_door::{NineDoor, ShardLayout};
+use secure9p_codec::{Codec, Request, RequestBody, Response, ResponseBody, MAX_MSIZE, VERSION};
+
+fn version_frame(codec: &Codec, tag: u16) -> Vec<u8> {
+    codec
+        .encode_request(&Request {
+            tag,
+            body: RequestBody::Version {
+                msize: MAX_MSIZE,
+                version: VERSION.to_owned(),
+            },
+        })
+        .expect("encode version")
+}
+
+fn decode_single(codec: &Codec, bytes: &[u8]) -> Response {
+    codec.decode_response(bytes).expect("decode response")
+}
+
+#[test]
+fn dispatcher_pins_sessions_to_shard_threads() {
+    let server = NineDoor::new_with_shard_layout(ShardLayout::enabled(2, false));
+    let dispatcher = server.shard_dispatcher();
+    assert_eq!(dispatcher.shard_count(), 4);
+
+    let codec = Codec;
+    let mut sessions = Vec::new();
+    for shard in 0..4u8 {
+        let connection = server.connect().expect("connect session");
+        dispatcher.pin_session(connection.session_id(), shard);
+        sessions.push(connection);
+    }
+
+    let mut handles = Vec::new();
+    let dispatcher = std::sync::Arc::new(dispatcher);
+    for (idx, connection) in sessions.iter().enumerate() {
+        let dispatcher = std::sync::Arc::clone(&dispatcher);
+        let session = connection.session_id();
+        let frame = version_frame(&codec, (idx + 1) as u16);
+        handles.push(std::thread::spawn(move || {
+            dispatcher.submit(session, &frame).expect("submit batch")
+        }));
+    }
+    for handle in handles {
+        let bytes = handle.join().expect("dispatch thread");
+        let response = decode_single(&Codec, &bytes);
+        assert!(matches!(response.body, ResponseBody::Version { .. }));
+    }
+
+    let metrics = dispatcher.metrics();
+    assert_eq!(metrics.len(), 4);
+    assert_eq!(metrics.iter().map(|m| m.batches).sum::<u64>(), 4);
+    assert!(metrics.iter().all(|m| m.batches == 1));
+    assert!(metrics.iter().all(|m| m.rejected == 0));
+}
+
+#[test]
+fn unpinned_sessions_hash_by_session_id() {
+    let server = NineDoor::new_with_shard_layout(ShardLayout::enabled(1, false));
+    let dispatcher = server.shard_dispatcher();
+    assert_eq!(dispatcher.shard_count(), 2);
+
+    let mut connection = server.connect().expect("connect session");
+    let session = connection.session_id();
+    let bytes = dispatcher
+        .submit(session, &version_frame(&Codec, 1))
+        .expect("submit batch");
+    let response = decode_single(&Codec, &bytes);
+    assert!(matches!(response.body, ResponseBody::Version { .. }));
+
+    // The same session keeps using the regular in-process path too.
+    connection.version(MAX_MSIZE).expect("version");
+    dispatcher.release_session(session);
+}
+
+#[test]
+fn jumbo_msize_negotiates_up_to_bound() {
+    use secure9p_codec::JUMBO_MSIZE;
+    let server = NineDoor::new();
+    let mut session = server.connect().expect("connect");
+    let negotiated = session.version(JUMBO_MSIZE * 4).expect("version");
+    assert_eq!(negotiated, JUMBO_MSIZE);
+    let mut modest = server.connect().expect("connect");
+    assert_eq!(modest.version(MAX_MSIZE).expect("version"), MAX_MSIZE);
+}
@@ -250,6 +250,7 @@ fn backpressure_and_short_write_retries_are_bounded() {
     assert!(server.pipeline_metrics().backpressure_events > 0);
 
     let mut pipeline = Pipeline::new(PipelineConfig {
+        batch_frames_ceiling: 16,
         batch_frames: 1,
         queue_depth: 1,
         short_write_policy: ShortWritePolicy::Retry,
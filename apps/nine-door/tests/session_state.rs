@@ -89,3 +89,29 @@ fn session_state_tracks_setup_active_draining_closed() {
     let closed_state = read_proc_text(&mut observer, 6, &setup_state_path);
     assert!(closed_state.contains("state=CLOSED"));
 }
+
+#[test]
+fn hot_restart_restores_sessions_without_reattach() {
+    let server = NineDoor::new();
+    let mut client = server.connect().expect("connect");
+    client.version(MAX_MSIZE).expect("version");
+    client.attach(1, Role::Queen).expect("attach");
+    let log_path = vec!["log".to_owned(), "queen.log".to_owned()];
+    client.walk(1, 2, &log_path).expect("walk log");
+    client.open(2, OpenMode::read_only()).expect("open log");
+    let before = client.read(2, 0, MAX_MSIZE).expect("read before");
+    let session_id = client.session_id();
+
+    // Simulate an upgrade: capture sessions, build a fresh server, restore.
+    let snapshots = server.snapshot_sessions();
+    let restarted = NineDoor::new();
+    assert_eq!(restarted.restore_sessions(&snapshots), snapshots.len());
+
+    // The same session id and fid work against the restarted server with no
+    // re-version/re-attach/re-walk.
+    let mut resumed = restarted
+        .resume_connection(session_id)
+        .expect("resume session");
+    let after = resumed.read(2, 0, MAX_MSIZE).expect("read after restart");
+    assert_eq!(before, after);
+}
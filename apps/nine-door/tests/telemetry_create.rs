@@ -143,3 +143,134 @@ fn telemetry_ingest_allocates_segment_and_latest() {
     let readback = read_text(&mut client, 7, &seg_path);
     assert_eq!(readback, "hello");
 }
+
+#[test]
+fn rotation_seals_and_compacts_previous_segment() {
+    let ingest = TelemetryIngestConfig {
+        max_segments_per_device: 4,
+        max_bytes_per_segment: 8192,
+        max_total_bytes_per_device: 32768,
+        eviction_policy: TelemetryIngestEvictionPolicy::Refuse,
+    };
+    let server = NineDoor::new_with_limits_and_telemetry_manifest(
+        Arc::new(TestClock::default()),
+        Default::default(),
+        TelemetryConfig::default(),
+        ingest,
+        TelemetryManifestStore::default(),
+    );
+    let mut client = attach_queen(&server);
+
+    let ctl_path = vec![
+        "queen".to_owned(),
+        "telemetry".to_owned(),
+        "device-1".to_owned(),
+        "ctl".to_owned(),
+    ];
+    client.walk(1, 2, &ctl_path).expect("walk ctl");
+    client.open(2, OpenMode::write_append()).expect("open ctl");
+    client
+        .write(2, b"{\"new\":\"segment\",\"mime\":\"text/plain\"}\n")
+        .expect("create segment");
+
+    let seg_path = vec![
+        "queen".to_owned(),
+        "telemetry".to_owned(),
+        "device-1".to_owned(),
+        "seg".to_owned(),
+        "seg-000001".to_owned(),
+    ];
+    let line = b"{\"schema\":\"telemetry/v1\",\"temp_c\":41.5}\n";
+    client.walk(1, 3, &seg_path).expect("walk segment");
+    client.open(3, OpenMode::write_append()).expect("open segment");
+    let mut expected = Vec::new();
+    for _ in 0..16 {
+        client.write(3, line).expect("append record");
+        expected.extend_from_slice(line);
+    }
+    client.clunk(3).expect("clunk segment");
+
+    // Rotating seals seg-000001; its content must read back unchanged.
+    client
+        .write(2, b"{\"new\":\"segment\",\"mime\":\"text/plain\"}\n")
+        .expect("rotate segment");
+    client.clunk(2).expect("clunk ctl");
+
+    client.walk(1, 4, &seg_path).expect("walk sealed segment");
+    client.open(4, OpenMode::read_only()).expect("open sealed");
+    let data = client.read(4, 0, MAX_MSIZE).expect("read sealed");
+    assert_eq!(data, expected);
+    let tail = client
+        .read(4, (expected.len() - 8) as u64, MAX_MSIZE)
+        .expect("read sealed tail");
+    assert_eq!(tail, &expected[expected.len() - 8..]);
+    client.clunk(4).expect("clunk sealed");
+
+    // A late append to the sealed segment unseals it in place and the
+    // combined contents read back intact.
+    client.walk(1, 5, &seg_path).expect("walk sealed again");
+    client.open(5, OpenMode::write_append()).expect("open sealed");
+    client.write(5, line).expect("append unseals segment");
+    expected.extend_from_slice(line);
+    client.clunk(5).expect("clunk segment");
+    client.walk(1, 6, &seg_path).expect("walk unsealed");
+    client.open(6, OpenMode::read_only()).expect("open unsealed");
+    let data = client.read(6, 0, MAX_MSIZE).expect("read unsealed");
+    assert_eq!(data, expected);
+}
+
+#[test]
+fn ingest_maintains_sibling_aggregate_file() {
+    let ingest = TelemetryIngestConfig {
+        max_segments_per_device: 4,
+        max_bytes_per_segment: 8192,
+        max_total_bytes_per_device: 32768,
+        eviction_policy: TelemetryIngestEvictionPolicy::Refuse,
+    };
+    let server = NineDoor::new_with_limits_and_telemetry_manifest(
+        Arc::new(TestClock::default()),
+        Default::default(),
+        TelemetryConfig::default(),
+        ingest,
+        TelemetryManifestStore::default(),
+    );
+    let mut client = attach_queen(&server);
+
+    let ctl_path = vec![
+        "queen".to_owned(),
+        "telemetry".to_owned(),
+        "device-1".to_owned(),
+        "ctl".to_owned(),
+    ];
+    client.walk(1, 2, &ctl_path).expect("walk ctl");
+    client.open(2, OpenMode::write_append()).expect("open ctl");
+    client
+        .write(2, b"{\"new\":\"segment\",\"mime\":\"application/json\"}\n")
+        .expect("create segment");
+    client.clunk(2).expect("clunk ctl");
+
+    let seg_path = vec![
+        "queen".to_owned(),
+        "telemetry".to_owned(),
+        "device-1".to_owned(),
+        "seg".to_owned(),
+        "seg-000001".to_owned(),
+    ];
+    client.walk(1, 3, &seg_path).expect("walk segment");
+    client.open(3, OpenMode::write_append()).expect("open seg");
+    for idx in 0..10 {
+        let line = format!("{{\"temp_c\":{},\"util\":0.5}}\n", 40 + idx);
+        client.write(3, line.as_bytes()).expect("append record");
+    }
+    client.clunk(3).expect("clunk segment");
+
+    let agg_path = vec![
+        "queen".to_owned(),
+        "telemetry".to_owned(),
+        "device-1".to_owned(),
+        "agg".to_owned(),
+    ];
+    let agg = read_text(&mut client, 4, &agg_path);
+    assert!(agg.contains("metric=temp_c n=10 min=40.000 max=49.000"), "agg: {agg}");
+    assert!(agg.contains("metric=util"), "agg: {agg}");
+}
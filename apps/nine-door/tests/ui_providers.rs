@@ -160,3 +160,56 @@ fn ui_provider_disabled_logs_audit() {
         "ui-provider outcome=deny reason=disabled provider=policy/preflight/req",
     );
 }
+
+#[test]
+fn shared_gpu_results_serve_without_copy_and_stay_read_only() {
+    use std::sync::Arc;
+    let server = nine_door::NineDoor::new();
+    let bridge = gpu_bridge_host::GpuBridge::mock();
+    let snapshot = bridge.serialise_namespace().expect("snapshot");
+    server.install_gpu_nodes(&snapshot).expect("install nodes");
+    let gpu_id = snapshot.nodes[0].id.clone();
+
+    let tensor: Arc<Vec<u8>> = Arc::new((0..100_000u32).map(|i| (i % 251) as u8).collect());
+    server
+        .install_gpu_result(&gpu_id, "job-42", Arc::clone(&tensor))
+        .expect("install result");
+
+    let mut client = server.connect().expect("connect");
+    client.version(secure9p_codec::MAX_MSIZE).expect("version");
+    client
+        .attach(1, cohesix_ticket::Role::Queen)
+        .expect("attach");
+    let path = vec![
+        "gpu".to_owned(),
+        gpu_id.clone(),
+        "results".to_owned(),
+        "job-42".to_owned(),
+    ];
+    client.walk(1, 2, &path).expect("walk result");
+    client
+        .open(2, secure9p_codec::OpenMode::read_only())
+        .expect("open result");
+    let mut data = Vec::new();
+    loop {
+        let chunk = client
+            .read(2, data.len() as u64, secure9p_codec::MAX_MSIZE)
+            .expect("read result");
+        if chunk.is_empty() {
+            break;
+        }
+        data.extend_from_slice(&chunk);
+    }
+    assert_eq!(&data, tensor.as_ref());
+
+    // Results are read-only through the protocol.
+    let mut writer = server.connect().expect("connect writer");
+    writer.version(secure9p_codec::MAX_MSIZE).expect("version");
+    writer
+        .attach(1, cohesix_ticket::Role::Queen)
+        .expect("attach");
+    writer.walk(1, 2, &path).expect("walk result");
+    assert!(writer
+        .open(2, secure9p_codec::OpenMode::write_append())
+        .is_err());
+}
@@ -100,6 +100,9 @@ fn main() {
     if let Err(err) = validate_generated_manifest() {
         panic!("generated manifest check failed: {err}");
     }
+    if let Err(err) = emit_device_map() {
+        panic!("failed to emit device_map.rs: {err}");
+    }
 
     println!("cargo:rerun-if-env-changed=SEL4_LD");
     println!("cargo:rerun-if-env-changed=SEL4_BUILD_DIR");
@@ -107,6 +110,7 @@ fn main() {
     println!("cargo:rustc-check-cfg=cfg(sel4_config_debug_build)");
     println!("cargo:rustc-check-cfg=cfg(sel4_config_printing)");
     println!("cargo:rustc-check-cfg=cfg(sel4_config_kernel_mcs)");
+    println!("cargo:rustc-check-cfg=cfg(sel4_config_signal_fastpath)");
 
     if let Err(error) = enforce_guarded_ipc() {
         panic!("failed to scan `{IPC_GUARD_SOURCE}` for direct IPC syscalls: {error}");
@@ -404,6 +408,10 @@ fn emit_config_flags(root: &Path, debug_syscalls_enabled: bool) {
     if let Some(true) = probe_config_flag(root, "CONFIG_KERNEL_MCS") {
         println!("cargo:rustc-cfg=sel4_config_kernel_mcs");
     }
+
+    if let Some(true) = probe_config_flag(root, "CONFIG_SIGNAL_FASTPATH") {
+        println!("cargo:rustc-cfg=sel4_config_signal_fastpath");
+    }
 }
 
 fn probe_config_flag(root: &Path, flag: &str) -> Option<bool> {
@@ -568,3 +576,137 @@ fn scan_ipc_directory(path: &Path, regex: &Regex) -> io::Result<()> {
 
     Ok(())
 }
+
+/// Path of the kernel DTS the device map is generated from.
+const KERNEL_DTS_PATH: &str = "../../seL4/build/kernel/kernel.dts";
+
+/// One parsed DTS device node destined for the generated const table.
+struct DtsDevice {
+    name: String,
+    compatible: String,
+    base: u64,
+    size: u64,
+    irq: Option<u32>,
+}
+
+/// Generate `device_map.rs` from the kernel DTS into OUT_DIR.
+///
+/// The DTS is fixed per kernel image, so device discovery belongs at
+/// build time: every `name@addr` node carrying `reg` and `compatible`
+/// becomes one const table entry (base, size, translated GIC interrupt
+/// number). When the DTS is absent (source-only checkouts), an empty
+/// table is emitted so host builds keep compiling.
+fn emit_device_map() -> io::Result<()> {
+    let out_dir = PathBuf::from(env::var("OUT_DIR").map_err(io::Error::other)?);
+    let manifest_dir = PathBuf::from(env::var("CARGO_MANIFEST_DIR").map_err(io::Error::other)?);
+    let dts_path = manifest_dir.join(KERNEL_DTS_PATH);
+    println!("cargo:rerun-if-changed={}", dts_path.display());
+
+    let devices = match fs::read_to_string(&dts_path) {
+        Ok(source) => parse_dts_devices(&source),
+        Err(_) => Vec::new(),
+    };
+
+    let mut contents = String::from(
+        "// Generated from seL4/build/kernel/kernel.dts by build.rs; do not edit.\n\
+         pub const DEVICE_REGIONS: &[DeviceRegion] = &[\n",
+    );
+    for device in &devices {
+        contents.push_str(&format!(
+            "    DeviceRegion {{ name: \"{}\", compatible: \"{}\", base: 0x{:x}, size: 0x{:x}, irq: {} }},\n",
+            device.name,
+            device.compatible,
+            device.base,
+            device.size,
+            match device.irq {
+                Some(irq) => format!("Some({irq})"),
+                None => "None".to_owned(),
+            },
+        ));
+    }
+    contents.push_str("];\n");
+    fs::write(out_dir.join("device_map.rs"), contents)
+}
+
+/// Parse `name@addr` nodes with `reg` and `compatible` out of a DTS.
+///
+/// Handles the two-cell address/size form used at the root of the virt
+/// DTS and translates `interrupts = <type num flags>` triples to GIC
+/// interrupt numbers (SPI + 32, PPI + 16).
+fn parse_dts_devices(source: &str) -> Vec<DtsDevice> {
+    let node_re = Regex::new(r"^([A-Za-z0-9_-]+)@([0-9a-fA-F]+)\s*\{").expect("node regex");
+    let cells_re = Regex::new(r"<([^>]*)>").expect("cells regex");
+
+    let mut devices = Vec::new();
+    let mut stack: Vec<Option<DtsDevice>> = Vec::new();
+    for raw_line in source.lines() {
+        let line = raw_line.trim();
+        if let Some(captures) = node_re.captures(line) {
+            stack.push(Some(DtsDevice {
+                name: format!("{}@{}", &captures[1], &captures[2]),
+                compatible: String::new(),
+                base: 0,
+                size: 0,
+                irq: None,
+            }));
+            continue;
+        }
+        if line.ends_with('{') {
+            stack.push(None);
+            continue;
+        }
+        if line.starts_with('}') {
+            if let Some(Some(device)) = stack.pop() {
+                if !device.compatible.is_empty() && device.size > 0 {
+                    devices.push(device);
+                }
+            }
+            continue;
+        }
+        let Some(Some(device)) = stack.last_mut() else {
+            continue;
+        };
+        if let Some(rest) = line.strip_prefix("compatible = ") {
+            if let Some(first) = rest.split('"').nth(1) {
+                device.compatible = first.to_owned();
+            }
+        } else if line.starts_with("reg = ") {
+            if let Some(cells) = cells_re.captures(line) {
+                let values = parse_cells(&cells[1]);
+                match values.len() {
+                    4 => {
+                        device.base = (values[0] << 32) | values[1];
+                        device.size = (values[2] << 32) | values[3];
+                    }
+                    2 => {
+                        device.base = values[0];
+                        device.size = values[1];
+                    }
+                    _ => {}
+                }
+            }
+        } else if line.starts_with("interrupts = ") {
+            if let Some(cells) = cells_re.captures(line) {
+                let values = parse_cells(&cells[1]);
+                if values.len() >= 2 {
+                    let offset = if values[0] == 0 { 32 } else { 16 };
+                    device.irq = Some(values[1] as u32 + offset);
+                }
+            }
+        }
+    }
+    devices.sort_by_key(|device| device.base);
+    devices
+}
+
+fn parse_cells(cells: &str) -> Vec<u64> {
+    cells
+        .split_whitespace()
+        .filter_map(|token| {
+            token.strip_prefix("0x").map_or_else(
+                || token.parse().ok(),
+                |hex| u64::from_str_radix(hex, 16).ok(),
+            )
+        })
+        .collect()
+}
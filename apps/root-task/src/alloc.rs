@@ -12,6 +12,7 @@ use core::ops::Range;
 use core::sync::atomic::{AtomicBool, Ordering};
 
 use linked_list_allocator::LockedHeap;
+use portable_atomic::AtomicU32;
 
 use crate::bootstrap::{log as boot_log, no_alloc};
 
@@ -20,6 +21,218 @@ pub const HEAP_BYTES: usize = 512 * 1024;
 
 static HEAP_INITIALISED: AtomicBool = AtomicBool::new(false);
 
+/// Size classes served by the segregated slab front end. These cover the hot
+/// small allocations (log lines, IPC scratch, frame staging); anything larger
+/// or more aligned falls through to the linked-list heap.
+const SLAB_CLASS_SIZES: [usize; 6] = [32, 64, 128, 256, 512, 1600];
+
+/// Maximum blocks cached per class before frees fall through to the heap,
+/// bounding how much memory the slab layer can pin.
+const SLAB_CACHE_LIMIT: u32 = 64;
+
+/// Alignment ceiling the slab classes can serve; stricter layouts bypass it.
+const SLAB_MAX_ALIGN: usize = 16;
+
+/// Per-class occupancy counters for the slab report.
+#[derive(Debug, Clone, Copy, Default)]
+pub struct SlabClassStats {
+    /// Class block size in bytes.
+    pub size: u32,
+    /// Blocks currently cached on the class free list.
+    pub cached: u32,
+    /// Blocks handed out and still live.
+    pub live: u32,
+    /// High-water mark of simultaneously live blocks.
+    pub high_water: u32,
+}
+
+struct SlabClass {
+    size: usize,
+    /// Intrusive free list: each cached block stores the next block's
+    /// address in its first word.
+    free_head: spin::Mutex<usize>,
+    cached: AtomicU32,
+    live: AtomicU32,
+    high_water: AtomicU32,
+}
+
+impl SlabClass {
+    const fn new(size: usize) -> Self {
+        Self {
+            size,
+            free_head: spin::Mutex::new(0),
+            cached: AtomicU32::new(0),
+            live: AtomicU32::new(0),
+            high_water: AtomicU32::new(0),
+        }
+    }
+
+    fn note_alloc(&self) {
+        let live = self.live.fetch_add(1, Ordering::Relaxed).saturating_add(1);
+        self.high_water.fetch_max(live, Ordering::Relaxed);
+    }
+
+    fn pop(&self) -> Option<*mut u8> {
+        let mut head = self.free_head.lock();
+        let block = *head;
+        if block == 0 {
+            return None;
+        }
+        // Safety: blocks on the free list were handed out by the backing heap
+        // for this class size and store the next pointer in their first word.
+        unsafe {
+            *head = *(block as *const usize);
+        }
+        self.cached.fetch_sub(1, Ordering::Relaxed);
+        Some(block as *mut u8)
+    }
+
+    fn push(&self, ptr: *mut u8) -> bool {
+        if self.cached.load(Ordering::Relaxed) >= SLAB_CACHE_LIMIT {
+            return false;
+        }
+        let mut head = self.free_head.lock();
+        // Safety: the block is at least one word large (minimum class size is
+        // 32 bytes) and exclusively owned here.
+        unsafe {
+            *(ptr as *mut usize) = *head;
+        }
+        *head = ptr as usize;
+        self.cached.fetch_add(1, Ordering::Relaxed);
+        true
+    }
+
+    fn stats(&self) -> SlabClassStats {
+        SlabClassStats {
+            size: self.size as u32,
+            cached: self.cached.load(Ordering::Relaxed),
+            live: self.live.load(Ordering::Relaxed),
+            high_water: self.high_water.load(Ordering::Relaxed),
+        }
+    }
+}
+
+static SLAB_CLASSES: [SlabClass; SLAB_CLASS_SIZES.len()] = [
+    SlabClass::new(SLAB_CLASS_SIZES[0]),
+    SlabClass::new(SLAB_CLASS_SIZES[1]),
+    SlabClass::new(SLAB_CLASS_SIZES[2]),
+    SlabClass::new(SLAB_CLASS_SIZES[3]),
+    SlabClass::new(SLAB_CLASS_SIZES[4]),
+    SlabClass::new(SLAB_CLASS_SIZES[5]),
+];
+
+fn slab_class_for(layout: Layout) -> Option<&'static SlabClass> {
+    if layout.align() > SLAB_MAX_ALIGN {
+        return None;
+    }
+    SLAB_CLASSES
+        .iter()
+        .find(|class| layout.size() <= class.size)
+}
+
+/// Maximum registered allocation sites.
+pub const ALLOC_SITES: usize = 16;
+
+/// Per-site allocation accounting: compile-time registered sites record
+/// live bytes and high-water marks so capacity planning reads from a
+/// namespace file instead of waiting for the OOM panic.
+#[derive(Debug)]
+pub struct AllocSiteStats {
+    name: &'static str,
+    live_bytes: AtomicU32,
+    high_water_bytes: AtomicU32,
+}
+
+impl AllocSiteStats {
+    const fn new(name: &'static str) -> Self {
+        Self {
+            name,
+            live_bytes: AtomicU32::new(0),
+            high_water_bytes: AtomicU32::new(0),
+        }
+    }
+}
+
+/// Compile-time registered allocation sites. Extend the table (and the
+/// `AllocSite` enum) when instrumenting a new subsystem.
+static ALLOC_SITE_TABLE: [AllocSiteStats; ALLOC_SITES] = [
+    AllocSiteStats::new("net.frames"),
+    AllocSiteStats::new("log.lines"),
+    AllocSiteStats::new("ipc.scratch"),
+    AllocSiteStats::new("ninedoor.payloads"),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+    AllocSiteStats::new(""),
+];
+
+/// Record an allocation attributed to a registered site.
+pub fn note_site_alloc(site: usize, bytes: usize) {
+    if let Some(stats) = ALLOC_SITE_TABLE.get(site) {
+        let live = stats
+            .live_bytes
+            .fetch_add(bytes as u32, Ordering::Relaxed)
+            .saturating_add(bytes as u32);
+        stats.high_water_bytes.fetch_max(live, Ordering::Relaxed);
+    }
+}
+
+/// Record a deallocation attributed to a registered site.
+pub fn note_site_dealloc(site: usize, bytes: usize) {
+    if let Some(stats) = ALLOC_SITE_TABLE.get(site) {
+        stats.live_bytes.fetch_sub(bytes as u32, Ordering::Relaxed);
+    }
+}
+
+/// Render the per-site report for the namespace heap file.
+pub fn write_site_report(out: &mut impl core::fmt::Write) -> core::fmt::Result {
+    for (index, stats) in ALLOC_SITE_TABLE.iter().enumerate() {
+        if stats.name.is_empty() {
+            continue;
+        }
+        writeln!(
+            out,
+            "site={} name={} live_bytes={} high_water_bytes={}",
+            index,
+            stats.name,
+            stats.live_bytes.load(Ordering::Relaxed),
+            stats.high_water_bytes.load(Ordering::Relaxed),
+        )?;
+    }
+    Ok(())
+}
+
+/// Snapshot the slab occupancy counters for the heap telemetry surface.
+pub fn slab_stats() -> [SlabClassStats; SLAB_CLASS_SIZES.len()] {
+    let mut stats = [SlabClassStats::default(); SLAB_CLASS_SIZES.len()];
+    for (slot, class) in stats.iter_mut().zip(SLAB_CLASSES.iter()) {
+        *slot = class.stats();
+    }
+    stats
+}
+
+/// Render the slab occupancy report in the one-line diag format used by the
+/// other root-task telemetry surfaces (`/proc`-style heap file contents).
+pub fn write_slab_report(out: &mut impl core::fmt::Write) -> core::fmt::Result {
+    for class in &SLAB_CLASSES {
+        let stats = class.stats();
+        writeln!(
+            out,
+            "class={} cached={} live={} high_water={}",
+            stats.size, stats.cached, stats.live, stats.high_water
+        )?;
+    }
+    Ok(())
+}
+
 struct GuardedAllocator {
     inner: LockedHeap,
 }
@@ -46,6 +259,21 @@ unsafe impl GlobalAlloc for GuardedAllocator {
             no_alloc::assert_no_alloc("alloc");
         }
 
+        if let Some(class) = slab_class_for(layout) {
+            if let Some(block) = class.pop() {
+                class.note_alloc();
+                return block;
+            }
+            // Carve a fresh class-sized block so the matching dealloc can be
+            // cached regardless of the original layout size.
+            let class_layout =
+                unsafe { Layout::from_size_align_unchecked(class.size, SLAB_MAX_ALIGN) };
+            let block = unsafe { self.inner.alloc(class_layout) };
+            if !block.is_null() {
+                class.note_alloc();
+            }
+            return block;
+        }
         unsafe { self.inner.alloc(layout) }
     }
 
@@ -54,6 +282,16 @@ unsafe impl GlobalAlloc for GuardedAllocator {
             no_alloc::assert_no_alloc("dealloc");
         }
 
+        if let Some(class) = slab_class_for(layout) {
+            class.live.fetch_sub(1, Ordering::Relaxed);
+            if class.push(ptr) {
+                return;
+            }
+            let class_layout =
+                unsafe { Layout::from_size_align_unchecked(class.size, SLAB_MAX_ALIGN) };
+            unsafe { self.inner.dealloc(ptr, class_layout) };
+            return;
+        }
         unsafe { self.inner.dealloc(ptr, layout) }
     }
 
@@ -62,6 +300,15 @@ unsafe impl GlobalAlloc for GuardedAllocator {
             no_alloc::assert_no_alloc("alloc_zeroed");
         }
 
+        // Route through `alloc` so class-sized blocks are always carved with
+        // the class layout; recycled blocks must be re-zeroed by hand.
+        if slab_class_for(layout).is_some() {
+            let block = unsafe { self.alloc(layout) };
+            if !block.is_null() {
+                unsafe { core::ptr::write_bytes(block, 0, layout.size()) };
+            }
+            return block;
+        }
         unsafe { self.inner.alloc_zeroed(layout) }
     }
 
@@ -70,6 +317,20 @@ unsafe impl GlobalAlloc for GuardedAllocator {
             no_alloc::assert_no_alloc("realloc");
         }
 
+        let new_layout = unsafe { Layout::from_size_align_unchecked(new_size, layout.align()) };
+        // Slab-served blocks were carved with their class layout, so the
+        // backing heap must never see the caller's layout for them; move the
+        // bytes through alloc/dealloc instead.
+        if slab_class_for(layout).is_some() || slab_class_for(new_layout).is_some() {
+            let new_ptr = unsafe { self.alloc(new_layout) };
+            if !new_ptr.is_null() {
+                unsafe {
+                    core::ptr::copy_nonoverlapping(ptr, new_ptr, layout.size().min(new_size));
+                    self.dealloc(ptr, layout);
+                }
+            }
+            return new_ptr;
+        }
         unsafe { self.inner.realloc(ptr, layout, new_size) }
     }
 }
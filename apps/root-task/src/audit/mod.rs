@@ -5,5 +5,7 @@
 
 #![cfg(feature = "kernel")]
 
+/// Batched binary audit ring with a verifiable hash chain.
+pub mod binlog;
 /// Boot audit helpers used during early kernel bring-up.
 pub mod boot;
@@ -86,6 +86,27 @@ const ORDERING: &[BootstrapPhase] = &[
     BootstrapPhase::UserlandHandoff,
 ];
 
+/// Number of bootstrap phases; must equal `ORDERING.len()`.
+const PHASE_COUNT: usize = 8;
+
+// The plan is validated at build time: the ordering table must cover every
+// phase exactly once, so the runtime sequencer only has to walk a
+// straight-line cursor and can never observe a malformed plan.
+const _: () = {
+    assert!(
+        ORDERING.len() == PHASE_COUNT,
+        "bootstrap ordering must list every phase"
+    );
+    let mut seen = [false; PHASE_COUNT];
+    let mut index = 0;
+    while index < ORDERING.len() {
+        let slot = ORDERING[index] as usize;
+        assert!(!seen[slot], "bootstrap ordering repeats a phase");
+        seen[slot] = true;
+        index += 1;
+    }
+};
+
 /// Returns the canonical bootstrap phase order.
 #[must_use]
 pub fn ordering() -> &'static [BootstrapPhase] {
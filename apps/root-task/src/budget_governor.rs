@@ -0,0 +1,226 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Adaptive scheduling-budget governor for worker tasks.
+// Author: Lukas Bower
+
+//! Adaptive scheduling-budget governor.
+//!
+//! Worker budgets are set once at spawn and never revisited: bursty
+//! workers exhaust theirs and stall while idle workers hold unused
+//! reservation. The governor closes that loop — each observation
+//! window it consumes per-worker load (used ticks plus whether the
+//! worker hit its budget) and moves the granted budget inside the
+//! policy bounds derived from the worker's ticket: multiplicative
+//! growth when throttled so bursts recover fast, slow additive decay
+//! after sustained idleness so reservation returns to the pool.
+//!
+//! Applying an adjustment is a `seL4_SchedControl` invocation, an MCS
+//! mechanism our kernel config does not enable yet (BUILD_PLAN
+//! m28-deadline-guards covers the regeneration); until then the
+//! governor computes and queues adjustments and the apply step is the
+//! single point to wire once the invocation exists.
+
+use cohesix_ticket::BudgetSpec;
+use heapless::Vec;
+
+/// Maximum workers tracked by one governor.
+pub const GOVERNOR_SLOTS: usize = 32;
+
+/// Idle windows tolerated before the budget starts decaying.
+const IDLE_WINDOWS_BEFORE_DECAY: u32 = 4;
+
+/// Utilisation (percent of granted budget) considered idle.
+const IDLE_UTILISATION_PCT: u64 = 25;
+
+/// Additive decay per idle window, as a divisor of the grant.
+const DECAY_DIVISOR: u64 = 8;
+
+/// Floor any grant so a worker can always make progress.
+const MIN_GRANT_TICKS: u64 = 64;
+
+/// Per-worker budget tracking state.
+#[derive(Debug, Clone, Copy)]
+struct WorkerBudget {
+    worker_id: u32,
+    /// Currently granted budget ticks per period.
+    granted: u64,
+    /// Ceiling from the worker's ticket (`BudgetSpec::ticks`).
+    cap: u64,
+    idle_windows: u32,
+}
+
+/// One queued budget change awaiting a `seL4_SchedControl` invocation.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct BudgetAdjustment {
+    /// Worker the change applies to.
+    pub worker_id: u32,
+    /// New budget grant in ticks per period.
+    pub granted_ticks: u64,
+}
+
+/// Governor over all tracked workers.
+#[derive(Debug, Default)]
+pub struct BudgetGovernor {
+    workers: Vec<WorkerBudget, GOVERNOR_SLOTS>,
+    pending: Vec<BudgetAdjustment, GOVERNOR_SLOTS>,
+}
+
+impl BudgetGovernor {
+    /// Create an empty governor.
+    #[must_use]
+    pub const fn new() -> Self {
+        Self {
+            workers: Vec::new(),
+            pending: Vec::new(),
+        }
+    }
+
+    /// Register a worker with its spawn-time grant and ticket bounds.
+    /// An unbounded ticket (no tick limit) caps growth at eight times
+    /// the initial grant so one worker cannot absorb the whole pool.
+    pub fn register(&mut self, worker_id: u32, initial_ticks: u64, budget: &BudgetSpec) -> bool {
+        let cap = budget
+            .ticks()
+            .unwrap_or_else(|| initial_ticks.saturating_mul(8));
+        self.workers
+            .push(WorkerBudget {
+                worker_id,
+                granted: initial_ticks.clamp(MIN_GRANT_TICKS, cap.max(MIN_GRANT_TICKS)),
+                cap: cap.max(MIN_GRANT_TICKS),
+                idle_windows: 0,
+            })
+            .is_ok()
+    }
+
+    /// Remove a worker (lifecycle teardown).
+    pub fn deregister(&mut self, worker_id: u32) {
+        self.workers.retain(|worker| worker.worker_id != worker_id);
+        self.pending.retain(|adj| adj.worker_id != worker_id);
+    }
+
+    /// Feed one observation window for a worker: ticks actually
+    /// consumed and whether the kernel throttled it (budget exhausted).
+    /// Queues an adjustment when the grant should move.
+    pub fn observe(&mut self, worker_id: u32, used_ticks: u64, throttled: bool) {
+        let Some(worker) = self
+            .workers
+            .iter_mut()
+            .find(|worker| worker.worker_id == worker_id)
+        else {
+            return;
+        };
+        let previous = worker.granted;
+        if throttled && worker.granted < worker.cap {
+            // Burst: double toward the ticket cap so the worker stops
+            // stalling within a couple of windows.
+            worker.granted = (worker.granted.saturating_mul(2)).min(worker.cap);
+            worker.idle_windows = 0;
+        } else if used_ticks.saturating_mul(100) < worker.granted * IDLE_UTILISATION_PCT {
+            // Sustained idleness: decay slowly so reservation returns
+            // to the pool without whiplash on the next burst.
+            worker.idle_windows = worker.idle_windows.saturating_add(1);
+            if worker.idle_windows >= IDLE_WINDOWS_BEFORE_DECAY {
+                worker.granted = worker
+                    .granted
+                    .saturating_sub(worker.granted / DECAY_DIVISOR)
+                    .max(MIN_GRANT_TICKS);
+            }
+        } else {
+            worker.idle_windows = 0;
+        }
+        if worker.granted != previous {
+            let adjustment = BudgetAdjustment {
+                worker_id,
+                granted_ticks: worker.granted,
+            };
+            // Replace a stale queued adjustment for the same worker.
+            if let Some(existing) = self
+                .pending
+                .iter_mut()
+                .find(|adj| adj.worker_id == worker_id)
+            {
+                *existing = adjustment;
+            } else {
+                let _ = self.pending.push(adjustment);
+            }
+        }
+    }
+
+    /// Drain queued adjustments for application. Each entry becomes one
+    /// `seL4_SchedControl_ConfigureFlags` invocation once the MCS
+    /// kernel build lands; callers apply in order.
+    pub fn drain_pending(&mut self, mut apply: impl FnMut(BudgetAdjustment)) {
+        for adjustment in self.pending.iter().copied() {
+            apply(adjustment);
+        }
+        self.pending.clear();
+    }
+
+    /// Current grant for a worker, when tracked.
+    #[must_use]
+    pub fn granted(&self, worker_id: u32) -> Option<u64> {
+        self.workers
+            .iter()
+            .find(|worker| worker.worker_id == worker_id)
+            .map(|worker| worker.granted)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn ticket_with_ticks(ticks: u64) -> BudgetSpec {
+        BudgetSpec::unbounded().with_ticks(Some(ticks))
+    }
+
+    #[test]
+    fn throttled_worker_grows_to_ticket_cap_and_no_further() {
+        let mut governor = BudgetGovernor::new();
+        assert!(governor.register(1, 128, &ticket_with_ticks(1024)));
+        governor.observe(1, 128, true);
+        assert_eq!(governor.granted(1), Some(256));
+        governor.observe(1, 256, true);
+        governor.observe(1, 512, true);
+        governor.observe(1, 1024, true);
+        assert_eq!(governor.granted(1), Some(1024), "capped at ticket ticks");
+
+        let mut applied = 0;
+        governor.drain_pending(|adjustment| {
+            assert_eq!(adjustment.worker_id, 1);
+            assert_eq!(adjustment.granted_ticks, 1024, "latest grant wins");
+            applied += 1;
+        });
+        assert_eq!(applied, 1, "adjustments coalesce per worker");
+    }
+
+    #[test]
+    fn idle_worker_decays_slowly_and_never_below_floor() {
+        let mut governor = BudgetGovernor::new();
+        assert!(governor.register(2, 1024, &ticket_with_ticks(2048)));
+        // Below the decay threshold nothing moves.
+        for _ in 0..IDLE_WINDOWS_BEFORE_DECAY - 1 {
+            governor.observe(2, 10, false);
+        }
+        assert_eq!(governor.granted(2), Some(1024));
+        // Sustained idleness decays toward the floor.
+        for _ in 0..200 {
+            governor.observe(2, 0, false);
+        }
+        assert_eq!(governor.granted(2), Some(MIN_GRANT_TICKS));
+        // A busy window resets the idle streak.
+        governor.observe(2, MIN_GRANT_TICKS / 2, false);
+        governor.observe(2, 0, false);
+        assert_eq!(governor.granted(2), Some(MIN_GRANT_TICKS));
+    }
+
+    #[test]
+    fn unbounded_ticket_caps_growth_at_eight_times_initial() {
+        let mut governor = BudgetGovernor::new();
+        assert!(governor.register(3, 100, &BudgetSpec::unbounded()));
+        for _ in 0..10 {
+            governor.observe(3, 100, true);
+        }
+        assert_eq!(governor.granted(3), Some(800));
+    }
+}
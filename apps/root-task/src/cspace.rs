@@ -16,13 +16,42 @@ fn is_cnode_cap(raw_ty: seL4_Word) -> bool {
 
 static DEST_ROOT_LOGGED: AtomicBool = AtomicBool::new(false);
 
+/// Number of slots tracked by the hierarchical bitmap window; allocations
+/// beyond it fall back to the bump cursor (worker spawns stay well inside).
+const BITMAP_SLOTS: usize = 4096;
+const BITMAP_WORDS: usize = BITMAP_SLOTS / 64;
+
+/// Occupancy counters for the slot allocator.
+#[derive(Debug, Clone, Copy, Default)]
+pub struct CSpaceStats {
+    /// Slots currently allocated.
+    pub allocated: u32,
+    /// High-water mark of simultaneously allocated slots.
+    pub high_water: u32,
+    /// Total slots in the init CNode empty window.
+    pub window: u32,
+}
+
 /// Helper managing allocation within the init thread's capability space.
+///
+/// Slot allocation is a two-level bitmap over the first [`BITMAP_SLOTS`]
+/// slots of the empty window: a summary word marks which 64-slot words still
+/// have space, so alloc and free are a pair of trailing-zero scans and bit
+/// flips — O(1) — instead of the old linear bump that only reclaimed the
+/// tail slot. Slots past the window (never reached by spawn workloads) use
+/// a bump cursor.
 pub struct CSpace {
     root: seL4_CPtr,
     bits: u8,
     next_free: seL4_CPtr,
     empty_start: seL4_CPtr,
     empty_end: seL4_CPtr,
+    /// Summary bit set when the corresponding bitmap word has a free slot.
+    summary: u64,
+    /// One bit per slot; set = allocated.
+    bitmap: [u64; BITMAP_WORDS],
+    allocated: u32,
+    high_water: u32,
 }
 
 impl CSpace {
@@ -35,6 +64,10 @@ impl CSpace {
             next_free: bi.empty.start,
             empty_start: bi.empty.start,
             empty_end: bi.empty.end,
+            summary: !0,
+            bitmap: [0; BITMAP_WORDS],
+            allocated: 0,
+            high_water: 0,
         }
     }
 
@@ -53,24 +86,95 @@ impl CSpace {
     /// Returns the next free slot index that will be handed out by [`alloc_slot`].
     #[must_use]
     pub fn next_free_slot(&self) -> seL4_CPtr {
-        self.next_free
+        if self.summary != 0 {
+            let word = self.summary.trailing_zeros() as usize;
+            if let Some(slot) = self.first_free_in_word(word) {
+                return slot;
+            }
+        }
+        self.next_free.max(self.window_end())
+    }
+
+    fn window_end(&self) -> seL4_CPtr {
+        let span = (self.empty_end - self.empty_start).min(BITMAP_SLOTS as seL4_CPtr);
+        self.empty_start + span
+    }
+
+    fn first_free_in_word(&self, word: usize) -> Option<seL4_CPtr> {
+        let free_bits = !self.bitmap[word];
+        if free_bits == 0 {
+            return None;
+        }
+        let bit = free_bits.trailing_zeros() as usize;
+        let slot = self.empty_start + (word * 64 + bit) as seL4_CPtr;
+        (slot < self.window_end()).then_some(slot)
     }
 
-    /// Allocates the next available slot from the init CSpace.
+    /// Allocates the lowest available slot from the init CSpace.
     pub fn alloc_slot(&mut self) -> Result<seL4_CPtr, seL4_Error> {
         let limit = 1u64 << self.bits;
-        if (self.next_free as u64) >= limit || self.next_free >= self.empty_end {
+        while self.summary != 0 {
+            let word = self.summary.trailing_zeros() as usize;
+            match self.first_free_in_word(word) {
+                Some(slot) => {
+                    if (slot as u64) >= limit {
+                        return Err(sel4_sys::seL4_NotEnoughMemory);
+                    }
+                    let index = (slot - self.empty_start) as usize;
+                    self.bitmap[index / 64] |= 1u64 << (index % 64);
+                    if self.bitmap[index / 64] == !0 {
+                        self.summary &= !(1u64 << (index / 64));
+                    }
+                    self.note_alloc();
+                    return Ok(slot);
+                }
+                None => {
+                    self.summary &= !(1u64 << word);
+                }
+            }
+        }
+        // Bitmap window exhausted: fall back to the bump region beyond it.
+        let cursor = self.next_free.max(self.window_end());
+        if (cursor as u64) >= limit || cursor >= self.empty_end {
             return Err(sel4_sys::seL4_NotEnoughMemory);
         }
-        let slot = self.next_free;
-        self.next_free = self.next_free.saturating_add(1);
-        Ok(slot)
+        self.next_free = cursor.saturating_add(1);
+        self.note_alloc();
+        Ok(cursor)
+    }
+
+    fn note_alloc(&mut self) {
+        self.allocated = self.allocated.saturating_add(1);
+        if self.allocated > self.high_water {
+            self.high_water = self.allocated;
+        }
     }
 
     /// Releases a slot previously returned by [`alloc_slot`], allowing it to be reused.
     pub fn release_slot(&mut self, slot: seL4_CPtr) {
+        if slot >= self.empty_start && slot < self.window_end() {
+            let index = (slot - self.empty_start) as usize;
+            let mask = 1u64 << (index % 64);
+            if self.bitmap[index / 64] & mask != 0 {
+                self.bitmap[index / 64] &= !mask;
+                self.summary |= 1u64 << (index / 64);
+                self.allocated = self.allocated.saturating_sub(1);
+            }
+            return;
+        }
         if slot + 1 == self.next_free {
             self.next_free = slot;
+            self.allocated = self.allocated.saturating_sub(1);
+        }
+    }
+
+    /// Occupancy snapshot for the observability surfaces.
+    #[must_use]
+    pub fn stats(&self) -> CSpaceStats {
+        CSpaceStats {
+            allocated: self.allocated,
+            high_water: self.high_water,
+            window: (self.empty_end - self.empty_start) as u32,
         }
     }
 
@@ -172,3 +276,50 @@ pub fn cap_rights_read_write_grant() -> sel4_sys::seL4_CapRights {
         sel4_sys::seL4_CapRights_All
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn test_cspace(start: seL4_CPtr, end: seL4_CPtr) -> CSpace {
+        CSpace {
+            root: 2,
+            bits: 16,
+            next_free: start,
+            empty_start: start,
+            empty_end: end,
+            summary: !0,
+            bitmap: [0; BITMAP_WORDS],
+            allocated: 0,
+            high_water: 0,
+        }
+    }
+
+    #[test]
+    fn alloc_reuses_freed_slots_in_order() {
+        let mut cs = test_cspace(0x100, 0x100 + 128);
+        let a = cs.alloc_slot().unwrap();
+        let b = cs.alloc_slot().unwrap();
+        let c = cs.alloc_slot().unwrap();
+        assert_eq!((a, b, c), (0x100, 0x101, 0x102));
+        cs.release_slot(b);
+        assert_eq!(cs.next_free_slot(), b);
+        assert_eq!(cs.alloc_slot().unwrap(), b);
+        assert_eq!(cs.alloc_slot().unwrap(), 0x103);
+        let stats = cs.stats();
+        assert_eq!(stats.allocated, 4);
+        assert_eq!(stats.high_water, 4);
+    }
+
+    #[test]
+    fn exhausting_window_falls_back_then_errors() {
+        let span = 8;
+        let mut cs = test_cspace(0x10, 0x10 + span);
+        for idx in 0..span {
+            assert_eq!(cs.alloc_slot().unwrap(), 0x10 + idx);
+        }
+        assert!(cs.alloc_slot().is_err());
+        cs.release_slot(0x12);
+        assert_eq!(cs.alloc_slot().unwrap(), 0x12);
+    }
+}
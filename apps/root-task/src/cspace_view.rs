@@ -9,3 +9,120 @@ use sel4_sys::seL4_CPtr;
 pub const fn slot_index_as_cptr(slot: seL4_CPtr) -> seL4_CPtr {
     slot
 }
+
+/// Capacity of the derivation cache (worker lifecycle chains are short).
+pub const DERIVATION_CACHE_SLOTS: usize = 64;
+
+/// One cached capability derivation: a path key resolved to its slot.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+struct CachedDerivation {
+    key: u64,
+    slot: seL4_CPtr,
+    generation: u32,
+}
+
+/// Cache of resolved capability derivation chains.
+///
+/// Worker lifecycle operations repeat identical derivation chains hundreds
+/// of times; resolving through the cache turns a repeat lookup into an
+/// array probe. Revocation bumps the generation (the lifecycle teardown
+/// hook calls [`DerivationCache::invalidate_all`]), instantly orphaning
+/// every cached entry without walking them.
+#[derive(Debug)]
+pub struct DerivationCache {
+    entries: [Option<CachedDerivation>; DERIVATION_CACHE_SLOTS],
+    generation: u32,
+    hits: u64,
+    misses: u64,
+}
+
+impl DerivationCache {
+    /// Create an empty cache.
+    #[must_use]
+    pub const fn new() -> Self {
+        Self {
+            entries: [None; DERIVATION_CACHE_SLOTS],
+            generation: 0,
+            hits: 0,
+            misses: 0,
+        }
+    }
+
+    fn index(key: u64) -> usize {
+        (key.wrapping_mul(0x9e37_79b9_7f4a_7c15) >> 48) as usize % DERIVATION_CACHE_SLOTS
+    }
+
+    /// Look up a derivation key, resolving and caching on miss.
+    pub fn resolve(
+        &mut self,
+        key: u64,
+        mut derive: impl FnMut() -> Option<seL4_CPtr>,
+    ) -> Option<seL4_CPtr> {
+        let index = Self::index(key);
+        if let Some(entry) = &self.entries[index] {
+            if entry.key == key && entry.generation == self.generation {
+                self.hits += 1;
+                return Some(entry.slot);
+            }
+        }
+        self.misses += 1;
+        let slot = derive()?;
+        self.entries[index] = Some(CachedDerivation {
+            key,
+            slot,
+            generation: self.generation,
+        });
+        Some(slot)
+    }
+
+    /// Invalidate every cached derivation (revocation hook).
+    pub fn invalidate_all(&mut self) {
+        self.generation = self.generation.wrapping_add(1);
+    }
+
+    /// `(hits, misses)` counters.
+    #[must_use]
+    pub fn stats(&self) -> (u64, u64) {
+        (self.hits, self.misses)
+    }
+}
+
+impl Default for DerivationCache {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn repeat_lookups_hit_until_revocation() {
+        let mut cache = DerivationCache::new();
+        let mut derivations = 0u32;
+        for _ in 0..10 {
+            let slot = cache
+                .resolve(0x1234, || {
+                    derivations += 1;
+                    Some(0x40)
+                })
+                .unwrap();
+            assert_eq!(slot, 0x40);
+        }
+        assert_eq!(derivations, 1);
+        assert_eq!(cache.stats(), (9, 1));
+
+        cache.invalidate_all();
+        cache
+            .resolve(0x1234, || {
+                derivations += 1;
+                Some(0x41)
+            })
+            .unwrap();
+        assert_eq!(derivations, 2, "revocation forces re-derivation");
+        // Failed derivations are not cached.
+        assert!(cache.resolve(0x9999, || None).is_none());
+        assert!(cache.resolve(0x9999, || Some(0x50)).is_some());
+    }
+}
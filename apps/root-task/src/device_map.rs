@@ -0,0 +1,78 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Compile-time device map generated from the kernel DTS.
+// Author: Lukas Bower
+
+//! Compile-time device map generated from `seL4/build/kernel/kernel.dts`.
+//!
+//! The DTS is fixed per kernel image, so device regions, sizes, and
+//! interrupt numbers are known at build time; build.rs parses them into
+//! the const table included below. Boot-time discovery reduces to a
+//! table lookup — no parsing, no heap — and drivers bind to regions by
+//! compatible string.
+
+/// One memory-mapped device region from the kernel DTS.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct DeviceRegion {
+    /// DTS node name (`virtio_mmio@a000000`).
+    pub name: &'static str,
+    /// First `compatible` string of the node.
+    pub compatible: &'static str,
+    /// Physical base address.
+    pub base: u64,
+    /// Region size in bytes.
+    pub size: u64,
+    /// Translated GIC interrupt number (SPI + 32 / PPI + 16), when the
+    /// node declares one.
+    pub irq: Option<u32>,
+}
+
+include!(concat!(env!("OUT_DIR"), "/device_map.rs"));
+
+/// All regions matching a compatible string, in base-address order.
+pub fn regions_by_compatible(compatible: &str) -> impl Iterator<Item = &'static DeviceRegion> + '_ {
+    DEVICE_REGIONS
+        .iter()
+        .filter(move |region| region.compatible == compatible)
+}
+
+/// First region matching a compatible string.
+#[must_use]
+pub fn find_by_compatible(compatible: &str) -> Option<&'static DeviceRegion> {
+    regions_by_compatible(compatible).next()
+}
+
+/// Region containing a physical address.
+#[must_use]
+pub fn find_by_address(paddr: u64) -> Option<&'static DeviceRegion> {
+    DEVICE_REGIONS
+        .iter()
+        .find(|region| paddr >= region.base && paddr - region.base < region.size)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn table_reflects_the_virt_dts() {
+        // The in-tree DTS is the qemu virt machine: virtio-mmio slots
+        // start at 0xa000000 with 0x200 stride and the PL011 sits at
+        // 0x9000000. An empty table means the DTS went missing.
+        assert!(!DEVICE_REGIONS.is_empty());
+
+        let virtio = find_by_compatible("virtio,mmio").expect("virtio slots");
+        assert_eq!(virtio.base, 0xa00_0000);
+        assert_eq!(virtio.size, 0x200);
+        assert!(virtio.irq.is_some());
+
+        let uart = find_by_compatible("arm,pl011").expect("pl011");
+        assert_eq!(uart.base, 0x900_0000);
+
+        // Regions are sorted and addresses resolve to their node.
+        assert!(DEVICE_REGIONS.windows(2).all(|w| w[0].base <= w[1].base));
+        let inside = find_by_address(virtio.base + 0x10).expect("inside virtio slot");
+        assert_eq!(inside.name, virtio.name);
+        assert!(find_by_address(0x1).is_none());
+    }
+}
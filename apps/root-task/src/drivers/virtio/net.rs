@@ -6423,6 +6423,7 @@ impl VirtioNet {
         );
         if status != 0 {
             NET_DIAG.record_rx_irq();
+            NET_DIAG.record_irq_window(u64::from(status.count_ones()));
             self.tx_stats.record_irq();
         }
         self.check_device_health();
@@ -7761,6 +7762,7 @@ impl VirtioNet {
     }
 
     fn note_tx_kick(&mut self) {
+        NET_DIAG.record_tx_batch(u64::from(self.tx_pending_since_kick));
         self.tx_pending_since_kick = 0;
         self.tx_bytes_since_kick = 0;
         self.tx_stats.record_kick();
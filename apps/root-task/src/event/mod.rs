@@ -172,6 +172,11 @@ const CONSOLE_PROMPT: &str = "cohesix> ";
 const QUEEN_CTL_PATH: &str = "/queen/ctl";
 #[cfg(feature = "net-console")]
 const NET_DIAG_HEARTBEAT_MS: u64 = 5_000;
+
+/// Upper bound on how long net polls may be skipped while the stack is idle,
+/// so a missed wake never stalls the console for more than one cap interval.
+#[cfg(feature = "net-console")]
+const NET_IDLE_POLL_CAP_MS: u64 = 250;
 #[cfg(feature = "net-console")]
 const NET_DIAG_RATE_LIMIT_MS: u64 = 1_000;
 #[cfg(feature = "net-console")]
@@ -990,6 +995,10 @@ where
     audit: &'a mut dyn AuditSink,
     metrics: PumpMetrics,
     now_ms: u64,
+    #[cfg(feature = "net-console")]
+    net_idle_until_ms: u64,
+    #[cfg(feature = "net-console")]
+    net_wake_pending: bool,
     session: Option<SessionRole>,
     session_role: Option<Role>,
     session_ticket: Option<String>,
@@ -1061,6 +1070,10 @@ where
             validator,
             audit,
             metrics: PumpMetrics::default(),
+            #[cfg(feature = "net-console")]
+            net_idle_until_ms: 0,
+            #[cfg(feature = "net-console")]
+            net_wake_pending: false,
             now_ms: 0,
             session: None,
             session_role: None,
@@ -1140,9 +1153,10 @@ where
 
     /// Execute a single cooperative polling cycle.
     pub fn poll(&mut self) {
-        self.serial.poll_io();
-        self.consume_serial();
-
+        // Priority order: timebase first so deadlines are current, then net
+        // (virtio RX must never sit behind a console flood — dropped frames
+        // track exactly those stalls), then console input, then the rest of
+        // the housekeeping. Serial output still flushes via poll_io below.
         #[cfg(feature = "kernel")]
         let timebase_now_ms = crate::hal::timebase().now_ms();
         #[cfg(not(feature = "kernel"))]
@@ -1164,18 +1178,36 @@ where
             self.now_ms = timebase_now_ms;
         }
 
+        #[cfg(feature = "net-console")]
+        let net_idle = self.now_ms < self.net_idle_until_ms && !self.net_wake_pending;
         #[cfg(feature = "net-console")]
         let net_poll = if let Some(net) = self.net.as_mut() {
-            let activity = net.poll(self.now_ms);
-            let telemetry = net.telemetry();
-            let conn_id = net.active_console_conn_id();
-            let mut buffered: HeaplessVec<ConsoleLine, { CONSOLE_QUEUE_DEPTH }> =
-                HeaplessVec::new();
-            net.drain_console_lines(self.now_ms, &mut |line| {
-                let _ = buffered.push(line);
-            });
-            let ingest_snapshot: IngestSnapshot = net.ingest_snapshot();
-            Some((activity, telemetry, buffered, conn_id, ingest_snapshot))
+            // Tickless idling: while the stack reported no scheduled work and
+            // no RX wake arrived, skip the poll entirely instead of burning a
+            // pass per pump iteration.
+            if net_idle {
+                None
+            } else {
+                self.net_wake_pending = false;
+                let activity = net.poll(self.now_ms);
+                if activity {
+                    self.net_idle_until_ms = 0;
+                } else if let Some(delay) = net.poll_delay_ms(self.now_ms) {
+                    self.net_idle_until_ms =
+                        self.now_ms.saturating_add(delay.min(NET_IDLE_POLL_CAP_MS));
+                } else {
+                    self.net_idle_until_ms = self.now_ms.saturating_add(NET_IDLE_POLL_CAP_MS);
+                }
+                let telemetry = net.telemetry();
+                let conn_id = net.active_console_conn_id();
+                let mut buffered: HeaplessVec<ConsoleLine, { CONSOLE_QUEUE_DEPTH }> =
+                    HeaplessVec::new();
+                net.drain_console_lines(self.now_ms, &mut |line| {
+                    let _ = buffered.push(line);
+                });
+                let ingest_snapshot: IngestSnapshot = net.ingest_snapshot();
+                Some((activity, telemetry, buffered, conn_id, ingest_snapshot))
+            }
         } else {
             None
         };
@@ -1202,6 +1234,11 @@ where
             self.drain_net_console_events();
         }
 
+        // Console input services after net so a console flood cannot starve
+        // virtio RX; serial output queued above still flushes here.
+        self.serial.poll_io();
+        self.consume_serial();
+
         self.ipc.dispatch(self.now_ms);
         #[cfg(feature = "kernel")]
         self.drain_bootstrap_ipc();
@@ -1388,6 +1425,7 @@ where
             let _ = net.send_console_line(
                 "[net-console] authenticate using AUTH <role> <token> to receive console output",
             );
+            self.net_idle_until_ms = 0;
         }
         debug_uart_str("[dbg] console: writing 'cohesix>' prompt\n");
         self.emit_prompt();
@@ -1484,7 +1522,11 @@ where
         #[cfg(feature = "net-console")]
         if self.last_input_source == ConsoleInputSource::Net {
             if let Some(net) = self.net.as_mut() {
-                return net.send_console_line(line);
+                let sent = net.send_console_line(line);
+                // Queued output must flush on the next pump pass even if the
+                // stack had parked itself idle.
+                self.net_idle_until_ms = 0;
+                return sent;
             }
         }
         false
@@ -1613,6 +1655,23 @@ where
             count.saturating_sub(ram_ut),
         );
         self.emit_console_line(line.as_str());
+        for stats in crate::alloc::slab_stats() {
+            let mut line = HeaplessString::<DEFAULT_LINE_CAPACITY>::new();
+            let _ = write!(
+                line,
+                "[mem] slab class={} cached={} live={} high_water={}",
+                stats.size, stats.cached, stats.live, stats.high_water,
+            );
+            self.emit_console_line(line.as_str());
+        }
+        let mut sites = HeaplessString::<512>::new();
+        if crate::alloc::write_site_report(&mut sites).is_ok() {
+            for line in sites.lines() {
+                let mut out = HeaplessString::<DEFAULT_LINE_CAPACITY>::new();
+                let _ = write!(out, "[mem] {line}");
+                self.emit_console_line(out.as_str());
+            }
+        }
         true
     }
 
@@ -3489,7 +3548,7 @@ where
                             lifecycle::state_label(state)
                         ),
                     );
-                    log_buffer::append_log_line(line.as_str());
+                    log_buffer::append_log_line_ctx(log_buffer::LogContext::Console, line.as_str());
                     self.audit.denied("attach denied by lifecycle");
                     self.metrics.denied_commands += 1;
                     let detail = format_message(format_args!(
@@ -3685,6 +3744,13 @@ where
     V: CapabilityValidator,
 {
     /// Access the attached networking poller (test support only).
+    /// Wake the net poll loop immediately (RX interrupt / notification path).
+    #[cfg(feature = "net-console")]
+    pub fn notify_net_rx(&mut self) {
+        self.net_wake_pending = true;
+        self.net_idle_until_ms = 0;
+    }
+
     pub fn network_mut(&mut self) -> Option<&mut (dyn NetPoller + 'a)> {
         self.net.as_deref_mut()
     }
@@ -103,6 +103,40 @@ pub fn try_call(ep: seL4_CPtr, info: seL4_MessageInfo) -> Result<seL4_MessageInf
     }
 }
 
+/// Message-register word for the short-message fast path.
+#[cfg(feature = "kernel")]
+pub type IpcWord = crate::sel4::seL4_Word;
+/// Message-register word for the short-message fast path (host mock).
+#[cfg(not(feature = "kernel"))]
+pub type IpcWord = usize;
+
+#[inline]
+/// Issues a short-message (≤ 4 word) call through the MR-direct fast
+/// binding: registers pass by value with no IPC-buffer traffic, so the
+/// hot request/response pairs skip the spill-and-reload that
+/// [`try_call`] pays. Returns the reply info and message registers.
+pub fn try_call_short(
+    ep: seL4_CPtr,
+    info: seL4_MessageInfo,
+    mrs: [IpcWord; 4],
+) -> Result<(seL4_MessageInfo, [IpcWord; 4]), seL4_Error> {
+    if !ep_is_valid(ep) {
+        log::warn!("[ipc] skipped: null endpoint.");
+        return Err(FAILED_LOOKUP_ERROR);
+    }
+
+    #[cfg(feature = "kernel")]
+    {
+        return Ok(sel4::call_mrs_unchecked(ep, info, mrs));
+    }
+
+    #[cfg(not(feature = "kernel"))]
+    {
+        let _ = ep;
+        Ok((info, mrs))
+    }
+}
+
 #[inline]
 /// Issues an seL4 signal when the endpoint is valid, otherwise reports a lookup failure.
 pub fn try_signal(ep: seL4_CPtr) -> Result<(), seL4_Error> {
@@ -1098,6 +1098,7 @@ impl BootStateGuard {
 
     fn record_phase(&mut self, phase: &'static str) {
         self.commit.telemetry.phase = phase;
+        crate::trace::bootstrap::record_phase_timestamp(phase);
     }
 
     fn record_substep(&mut self, substep: &'static str) {
@@ -2287,21 +2288,37 @@ fn bootstrap<P: Platform>(
         check_bootinfo(&mut boot_guard, "[mark] phase.RetypeCommit");
     }
     probe_canary("[probe] after.RetypeCommit");
-    if let Err(err) = bootstrap_notification(&mut cs, &mut notification_selection) {
-        let mut line = heapless::String::<160>::new();
-        let err_code = err as i32;
-        let err_name = error_name(err);
-        let _ = write!(
-            line,
-            "[boot] notification retype failed ut=0x{ut:03x} err={err} ({name})",
-            ut = notification_selection.cap,
-            err = err_code,
-            name = err_name
-        );
-        console.writeln_prefixed(line.as_str());
-    } else {
-        consumed_slots += 1;
-        retyped_objects += 1;
+    match bootstrap_notification(&mut cs, &mut notification_selection) {
+        Err(err) => {
+            let mut line = heapless::String::<160>::new();
+            let err_code = err as i32;
+            let err_name = error_name(err);
+            let _ = write!(
+                line,
+                "[boot] notification retype failed ut=0x{ut:03x} err={err} ({name})",
+                ut = notification_selection.cap,
+                err = err_code,
+                name = err_name
+            );
+            console.writeln_prefixed(line.as_str());
+        }
+        Ok(notification_slot) => {
+            consumed_slots += 1;
+            retyped_objects += 1;
+            // Signal delivery is the hottest syscall on the doorbell paths;
+            // surface whether the kernel build took the fastpath config so
+            // field units report it without gdb.
+            #[cfg(sel4_config_signal_fastpath)]
+            console.writeln_prefixed("[boot] kernel signal fastpath: enabled");
+            #[cfg(not(sel4_config_signal_fastpath))]
+            console.writeln_prefixed("[boot] kernel signal fastpath: disabled (slowpath)");
+            #[cfg(feature = "ipc-bench")]
+            crate::bench::run(notification_slot, &mut |line| {
+                console.writeln_prefixed(line);
+            });
+            #[cfg(not(feature = "ipc-bench"))]
+            let _ = notification_slot;
+        }
     }
 
     let mut watchdog = BootWatchdog::new();
@@ -35,6 +35,12 @@ pub mod observe;
 /// Compile-time profile surface exposed to kernels and tests.
 pub mod profile;
 pub mod serial;
+/// Adaptive scheduling-budget governor for worker tasks.
+pub mod budget_governor;
+/// Compile-time device map generated from the kernel DTS.
+pub mod device_map;
+/// Shared virtual timestamp page for syscall-free microsecond time.
+pub mod timepage;
 
 #[cfg(feature = "net-console")]
 mod net_consts;
@@ -45,6 +51,10 @@ pub(crate) mod drivers;
 #[cfg(feature = "net-console")]
 pub mod net;
 
+pub mod bench;
+pub mod counters;
+/// Shared-memory grant ring layout for the NineDoor bulk path.
+pub mod ninedoor_ring;
 pub mod hal;
 
 #[cfg(feature = "kernel")]
@@ -106,7 +116,7 @@ pub mod bootstrap;
 /// Endpoint bootstrap primitives used during kernel bring-up.
 pub mod boot;
 
-#[cfg(feature = "kernel")]
+#[cfg(any(feature = "kernel", test))]
 /// Runtime readiness flags shared between transports.
 pub mod readiness;
 
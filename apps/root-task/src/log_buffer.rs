@@ -8,17 +8,106 @@
 use core::sync::atomic::{AtomicBool, Ordering};
 
 use heapless::{Deque, String as HeaplessString, Vec as HeaplessVec};
+use portable_atomic::AtomicU64;
 use spin::Mutex;
 
 use crate::serial::DEFAULT_LINE_CAPACITY;
 
-const LOG_RING_CAPACITY: usize = 128;
+/// Capacity of each per-context ring; the merged view spans all contexts.
+const LOG_RING_CAPACITY: usize = 64;
 pub const LOG_SNAPSHOT_LINES: usize = 64;
 const USER_RING_CAPACITY: usize = 16;
 pub const LOG_USER_SNAPSHOT_LINES: usize = 16;
 
+/// Producer contexts writing into the queen log.
+///
+/// Each context owns its own ring, so the net, console, and NineDoor paths
+/// never serialize on a shared lock; lines carry a global sequence stamp and
+/// readers merge the rings in order.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum LogContext {
+    /// Net-console and TCP stack lines.
+    Net,
+    /// Root serial console lines.
+    Console,
+    /// NineDoor bridge lines.
+    NineDoor,
+    /// Everything else (bootstrap, audit, timers).
+    General,
+    /// Lines drained from the kernel's shared log ring.
+    Kernel,
+}
+
+const LOG_CONTEXTS: usize = 5;
+
+impl LogContext {
+    const fn index(self) -> usize {
+        match self {
+            Self::Net => 0,
+            Self::Console => 1,
+            Self::NineDoor => 2,
+            Self::General => 3,
+            Self::Kernel => 4,
+        }
+    }
+}
+
+/// Byte layout of the kernel's shared log ring (one page handed across via
+/// bootinfo once the kernel redirects its diagnostics away from the UART —
+/// BUILD_PLAN m28). The kernel appends UTF-8 bytes and publishes the write
+/// index in the first word; the root task keeps its own read cursor.
+pub const KERNEL_LOG_RING_HEADER_BYTES: usize = 8;
+
+/// Drain newly published bytes from a kernel log ring region into the
+/// kernel log context, advancing `cursor`. Returns the number of bytes
+/// consumed. Partial trailing lines stay in the ring until their newline is
+/// published.
+pub fn drain_kernel_log_region(region: &[u8], cursor: &mut u32) -> usize {
+    if region.len() <= KERNEL_LOG_RING_HEADER_BYTES {
+        return 0;
+    }
+    let write_idx = u32::from_le_bytes([region[0], region[1], region[2], region[3]]);
+    let data = &region[KERNEL_LOG_RING_HEADER_BYTES..];
+    let capacity = data.len() as u32;
+    if capacity == 0 || write_idx == *cursor {
+        return 0;
+    }
+    // The kernel never writes more than one ring of history; a cursor more
+    // than a full ring behind resynchronises to the oldest retained byte.
+    let behind = write_idx.wrapping_sub(*cursor);
+    if behind > capacity {
+        *cursor = write_idx.wrapping_sub(capacity);
+    }
+    let mut consumed = 0usize;
+    let mut line: HeaplessString<DEFAULT_LINE_CAPACITY> = HeaplessString::new();
+    let mut scan = *cursor;
+    let mut committed = *cursor;
+    while scan != write_idx {
+        let byte = data[(scan % capacity) as usize];
+        scan = scan.wrapping_add(1);
+        if byte == b'\n' {
+            append_log_line_ctx(LogContext::Kernel, line.as_str());
+            line.clear();
+            committed = scan;
+        } else if line.push(byte as char).is_err() {
+            // Oversized line: flush what fits and resume.
+            append_log_line_ctx(LogContext::Kernel, line.as_str());
+            line.clear();
+            committed = scan;
+        }
+        consumed += 1;
+    }
+    *cursor = committed;
+    consumed
+}
+
+struct SeqLine {
+    seq: u64,
+    line: HeaplessString<DEFAULT_LINE_CAPACITY>,
+}
+
 struct LogRing {
-    lines: Deque<HeaplessString<DEFAULT_LINE_CAPACITY>, LOG_RING_CAPACITY>,
+    lines: Deque<SeqLine, LOG_RING_CAPACITY>,
 }
 
 impl LogRing {
@@ -28,7 +117,7 @@ impl LogRing {
         }
     }
 
-    fn push_line(&mut self, line: &str) {
+    fn push_line(&mut self, seq: u64, line: &str) {
         if line.is_empty() {
             return;
         }
@@ -37,39 +126,7 @@ impl LogRing {
         if self.lines.is_full() {
             let _ = self.lines.pop_front();
         }
-        let _ = self.lines.push_back(entry);
-    }
-
-    fn append_bytes(&mut self, payload: &[u8]) {
-        let Ok(text) = core::str::from_utf8(payload) else {
-            return;
-        };
-        for line in text.lines() {
-            self.push_line(line);
-        }
-    }
-
-    fn snapshot<const LINE: usize, const LIMIT: usize>(
-        &self,
-    ) -> HeaplessVec<HeaplessString<LINE>, LIMIT> {
-        let mut out = HeaplessVec::new();
-        for line in self.lines.iter().rev() {
-            if out.is_full() {
-                break;
-            }
-            let mut entry: HeaplessString<LINE> = HeaplessString::new();
-            let _ = entry.push_str(line.as_str());
-            let _ = out.push(entry);
-        }
-        let slice = out.as_mut_slice();
-        let mut head = 0usize;
-        let mut tail = slice.len().saturating_sub(1);
-        while head < tail {
-            slice.swap(head, tail);
-            head = head.saturating_add(1);
-            tail = tail.saturating_sub(1);
-        }
-        out
+        let _ = self.lines.push_back(SeqLine { seq, line: entry });
     }
 }
 
@@ -120,7 +177,14 @@ impl UserRing {
     }
 }
 
-static LOG_RING: Mutex<LogRing> = Mutex::new(LogRing::new());
+static CONTEXT_RINGS: [Mutex<LogRing>; LOG_CONTEXTS] = [
+    Mutex::new(LogRing::new()),
+    Mutex::new(LogRing::new()),
+    Mutex::new(LogRing::new()),
+    Mutex::new(LogRing::new()),
+    Mutex::new(LogRing::new()),
+];
+static LOG_SEQ: AtomicU64 = AtomicU64::new(1);
 static USER_RING: Mutex<UserRing> = Mutex::new(UserRing::new());
 static LOG_CHANNEL_ACTIVE: AtomicBool = AtomicBool::new(false);
 
@@ -134,21 +198,81 @@ pub fn enable_log_channel() -> bool {
         .is_ok()
 }
 
+/// Append payload bytes line-by-line under the given producer context.
+pub fn append_log_bytes_ctx(context: LogContext, payload: &[u8]) {
+    let Ok(text) = core::str::from_utf8(payload) else {
+        return;
+    };
+    let mut ring = CONTEXT_RINGS[context.index()].lock();
+    for line in text.lines() {
+        let seq = LOG_SEQ.fetch_add(1, Ordering::Relaxed);
+        ring.push_line(seq, line);
+    }
+}
+
+/// Append a log line under the given producer context.
+pub fn append_log_line_ctx(context: LogContext, line: &str) {
+    let seq = LOG_SEQ.fetch_add(1, Ordering::Relaxed);
+    CONTEXT_RINGS[context.index()].lock().push_line(seq, line);
+}
+
 pub fn append_log_bytes(payload: &[u8]) {
-    LOG_RING.lock().append_bytes(payload);
+    append_log_bytes_ctx(LogContext::General, payload);
 }
 
 pub fn append_log_line(line: &str) {
-    LOG_RING.lock().push_line(line);
+    append_log_line_ctx(LogContext::General, line);
 }
 
 pub fn append_user_line(line: &str) {
     USER_RING.lock().push_line(line);
 }
 
+/// Visit the newest `limit` merged log lines in chronological order.
+///
+/// The per-context rings are each ordered by sequence stamp, so the merge is
+/// a k-way pick over their tails; each ring lock is held only while its lines
+/// are copied into the caller's visitor, never across contexts.
+pub fn snapshot_into<const LIMIT: usize>(visitor: &mut dyn FnMut(&str)) {
+    // Gather (seq, line) pairs newest-first, bounded by LIMIT.
+    let mut merged: HeaplessVec<(u64, HeaplessString<DEFAULT_LINE_CAPACITY>), LIMIT> =
+        HeaplessVec::new();
+    for ring in &CONTEXT_RINGS {
+        let guard = ring.lock();
+        for entry in guard.lines.iter().rev() {
+            if merged.is_full() {
+                // Replace the oldest retained entry when this one is newer.
+                if let Some((min_idx, _)) = merged
+                    .iter()
+                    .enumerate()
+                    .min_by_key(|(_, (seq, _))| *seq)
+                    .map(|(idx, entry)| (idx, entry.0))
+                {
+                    if merged[min_idx].0 < entry.seq {
+                        merged[min_idx] = (entry.seq, entry.line.clone());
+                        continue;
+                    }
+                }
+                break;
+            }
+            let _ = merged.push((entry.seq, entry.line.clone()));
+        }
+    }
+    merged.as_mut_slice().sort_unstable_by_key(|(seq, _)| *seq);
+    for (_, line) in merged.iter() {
+        visitor(line.as_str());
+    }
+}
+
 pub fn snapshot_lines<const LINE: usize, const LIMIT: usize>(
 ) -> HeaplessVec<HeaplessString<LINE>, LIMIT> {
-    LOG_RING.lock().snapshot::<LINE, LIMIT>()
+    let mut out: HeaplessVec<HeaplessString<LINE>, LIMIT> = HeaplessVec::new();
+    snapshot_into::<LIMIT>(&mut |line| {
+        let mut entry: HeaplessString<LINE> = HeaplessString::new();
+        let _ = entry.push_str(line);
+        let _ = out.push(entry);
+    });
+    out
 }
 
 pub fn snapshot_user_lines<const LINE: usize, const LIMIT: usize>(
@@ -18,6 +18,9 @@ use crate::serial::DEFAULT_LINE_CAPACITY;
 use cohesix_proto::{REASON_EXPECTED_TOKEN, REASON_INVALID_LENGTH, REASON_INVALID_TOKEN};
 use cohsh_core::wire::AckLine;
 
+/// Consecutive priority lines served before the log lane gets a slot.
+const CONTROL_FLUSH_BURST: u8 = 4;
+
 // Transport-level guard to prevent unauthenticated TCP sessions from issuing console verbs.
 // Application-layer ticket and role checks are enforced by the console/event pump.
 const AUTH_PREFIX: &str = "AUTH ";
@@ -82,6 +85,7 @@ pub struct TcpConsoleServer {
     auth_deadline_ms: Option<u64>,
     conn_id: Option<u64>,
     outbound_drops: u64,
+    control_streak: u8,
     preauth_drop_count: u64,
     preauth_drop_warned: bool,
     ingest_metrics: IngestMetrics,
@@ -209,6 +213,7 @@ impl TcpConsoleServer {
             auth_deadline_ms: None,
             conn_id: None,
             outbound_drops: 0,
+            control_streak: 0,
             preauth_drop_count: 0,
             preauth_drop_warned: false,
             ingest_metrics: IngestMetrics::default(),
@@ -271,6 +276,7 @@ impl TcpConsoleServer {
         self.auth_deadline_ms = None;
         self.conn_id = None;
         self.outbound_drops = 0;
+        self.control_streak = 0;
     }
 
     fn reset_preauth_buffers(&mut self) {
@@ -630,15 +636,32 @@ impl TcpConsoleServer {
     }
 
     /// Pop the next outbound console line, if any.
+    ///
+    /// Lanes are scheduled with a bounded control burst: up to
+    /// [`CONTROL_FLUSH_BURST`] priority lines drain consecutively, after
+    /// which one log-lane line is served even while priority output is
+    /// pending. Recovery-console lines keep their low latency while a
+    /// verbose tail can no longer be starved behind a flood of control
+    /// traffic (or vice versa: bulk output never delays control by more than
+    /// its scheduled slot).
     pub fn pop_outbound(&mut self) -> Option<HeaplessString<DEFAULT_LINE_CAPACITY>> {
         if let Some(line) = self.priority_outbound.front() {
             if Self::is_end_line(line.as_str()) && !self.outbound.is_empty() {
                 return self.outbound.pop_front();
             }
         }
-        self.priority_outbound
-            .pop_front()
-            .or_else(|| self.outbound.pop_front())
+        let control_pending = !self.priority_outbound.is_empty();
+        let log_pending = !self.outbound.is_empty();
+        if control_pending && log_pending && self.control_streak >= CONTROL_FLUSH_BURST {
+            self.control_streak = 0;
+            return self.outbound.pop_front();
+        }
+        if control_pending {
+            self.control_streak = self.control_streak.saturating_add(1);
+            return self.priority_outbound.pop_front();
+        }
+        self.control_streak = 0;
+        self.outbound.pop_front()
     }
 
     /// Requeue an outbound line at the front of the queue.
@@ -951,6 +974,40 @@ mod tests {
         assert_eq!(outbound.as_str(), "OK AUTH");
     }
 
+    #[test]
+    fn flush_scheduler_bounds_control_bursts() {
+        let mut server = TcpConsoleServer::new(TOKEN, 10_000);
+        server.begin_session(0, Some(7));
+        let payload = frame_line::<{ DEFAULT_LINE_CAPACITY + 8 }>(&alloc_format(TOKEN));
+        let _ = server.ingest(payload.as_slice(), 1);
+        while server.pop_outbound().is_some() {}
+
+        for idx in 0..8 {
+            let mut line = heapless::String::<64>::new();
+            let _ = core::fmt::write(&mut line, format_args!("OK PING seq={idx}"));
+            server.enqueue_outbound(line.as_str()).unwrap();
+            let mut log = heapless::String::<64>::new();
+            let _ = core::fmt::write(&mut log, format_args!("log line {idx}"));
+            server.enqueue_outbound(log.as_str()).unwrap();
+        }
+        // Within any CONTROL_FLUSH_BURST+1 window the log lane gets a slot.
+        let mut first_log_at = None;
+        for pos in 0..(CONTROL_FLUSH_BURST as usize + 1) {
+            let line = server.pop_outbound().expect("queued line");
+            if !line.starts_with("OK ") {
+                first_log_at = Some(pos);
+                break;
+            }
+        }
+        assert!(first_log_at.is_some(), "log lane starved by control burst");
+    }
+
+    fn alloc_format(token: &str) -> heapless::String<96> {
+        let mut line = heapless::String::new();
+        let _ = core::fmt::write(&mut line, format_args!("AUTH {token}"));
+        line
+    }
+
     #[test]
     fn auth_failure_rejects_bad_token() {
         let mut server = TcpConsoleServer::new(TOKEN, 10_000);
@@ -6,6 +6,7 @@
 //! Minimal, copyable diagnostics for the networking stack.
 //! Counters are intentionally monotonic and safe to snapshot without locks.
 
+use crate::counters::ShardedCounter;
 use crate::profile;
 use portable_atomic::{AtomicBool, AtomicU64, Ordering};
 
@@ -37,6 +38,10 @@ pub struct NetDiagSnapshot {
     pub outbound_frames: u64,
     pub outbound_bytes: u64,
     pub outbound_would_block: u64,
+    pub tx_batches: u64,
+    pub tx_batched_frames: u64,
+    pub irq_windows: u64,
+    pub irq_window_sources: u64,
 }
 
 /// Global diagnostics backing the NETDIAG line.
@@ -50,9 +55,9 @@ pub struct NetDiag {
     tx_kicks: AtomicU64,
     tx_used_seen: AtomicU64,
     tx_completions: AtomicU64,
-    poll_calls: AtomicU64,
-    rx_frames_into_smoltcp: AtomicU64,
-    tx_frames_from_smoltcp: AtomicU64,
+    poll_calls: ShardedCounter,
+    rx_frames_into_smoltcp: ShardedCounter,
+    tx_frames_from_smoltcp: ShardedCounter,
     listener_bound: AtomicU64,
     accept_attempts: AtomicU64,
     accept_success: AtomicU64,
@@ -66,6 +71,10 @@ pub struct NetDiag {
     outbound_frames: AtomicU64,
     outbound_bytes: AtomicU64,
     outbound_would_block: AtomicU64,
+    tx_batches: AtomicU64,
+    tx_batched_frames: AtomicU64,
+    irq_windows: AtomicU64,
+    irq_window_sources: AtomicU64,
     last_rx_used_change_ms: AtomicU64,
     stuck_warned: AtomicBool,
 }
@@ -82,9 +91,9 @@ impl NetDiag {
             tx_kicks: AtomicU64::new(0),
             tx_used_seen: AtomicU64::new(0),
             tx_completions: AtomicU64::new(0),
-            poll_calls: AtomicU64::new(0),
-            rx_frames_into_smoltcp: AtomicU64::new(0),
-            tx_frames_from_smoltcp: AtomicU64::new(0),
+            poll_calls: ShardedCounter::new(),
+            rx_frames_into_smoltcp: ShardedCounter::new(),
+            tx_frames_from_smoltcp: ShardedCounter::new(),
             listener_bound: AtomicU64::new(0),
             accept_attempts: AtomicU64::new(0),
             accept_success: AtomicU64::new(0),
@@ -98,6 +107,10 @@ impl NetDiag {
             outbound_frames: AtomicU64::new(0),
             outbound_bytes: AtomicU64::new(0),
             outbound_would_block: AtomicU64::new(0),
+            tx_batches: AtomicU64::new(0),
+            tx_batched_frames: AtomicU64::new(0),
+            irq_windows: AtomicU64::new(0),
+            irq_window_sources: AtomicU64::new(0),
             last_rx_used_change_ms: AtomicU64::new(0),
             stuck_warned: AtomicBool::new(false),
         }
@@ -115,9 +128,9 @@ impl NetDiag {
             tx_kicks: self.tx_kicks.load(Ordering::Relaxed),
             tx_used_seen: self.tx_used_seen.load(Ordering::Relaxed),
             tx_completions: self.tx_completions.load(Ordering::Relaxed),
-            poll_calls: self.poll_calls.load(Ordering::Relaxed),
-            rx_frames_into_smoltcp: self.rx_frames_into_smoltcp.load(Ordering::Relaxed),
-            tx_frames_from_smoltcp: self.tx_frames_from_smoltcp.load(Ordering::Relaxed),
+            poll_calls: self.poll_calls.sum(),
+            rx_frames_into_smoltcp: self.rx_frames_into_smoltcp.sum(),
+            tx_frames_from_smoltcp: self.tx_frames_from_smoltcp.sum(),
             listener_bound: self.listener_bound.load(Ordering::Relaxed),
             accept_attempts: self.accept_attempts.load(Ordering::Relaxed),
             accept_success: self.accept_success.load(Ordering::Relaxed),
@@ -131,6 +144,10 @@ impl NetDiag {
             outbound_frames: self.outbound_frames.load(Ordering::Relaxed),
             outbound_bytes: self.outbound_bytes.load(Ordering::Relaxed),
             outbound_would_block: self.outbound_would_block.load(Ordering::Relaxed),
+            tx_batches: self.tx_batches.load(Ordering::Relaxed),
+            tx_batched_frames: self.tx_batched_frames.load(Ordering::Relaxed),
+            irq_windows: self.irq_windows.load(Ordering::Relaxed),
+            irq_window_sources: self.irq_window_sources.load(Ordering::Relaxed),
         }
     }
 
@@ -167,6 +184,28 @@ impl NetDiag {
     }
 
     #[inline]
+    /// Record one coalesced TX doorbell posting `frames` frames.
+    pub fn record_tx_batch(&self, frames: u64) {
+        if frames == 0 {
+            return;
+        }
+        self.tx_batches.fetch_add(1, Ordering::Relaxed);
+        self.tx_batched_frames.fetch_add(frames, Ordering::Relaxed);
+    }
+
+    /// Record one interrupt-entry window that collapsed `sources`
+    /// pending causes (ISR bits today; accumulated vIRQ badge bits once
+    /// m28-virq-coalescing lands). sources/windows gives the coalescing
+    /// ratio the kernel window tuning steers by.
+    pub fn record_irq_window(&self, sources: u64) {
+        if sources == 0 {
+            return;
+        }
+        self.irq_windows.fetch_add(1, Ordering::Relaxed);
+        self.irq_window_sources
+            .fetch_add(sources, Ordering::Relaxed);
+    }
+
     pub fn record_tx_kick(&self) {
         let _ = self.tx_kicks.fetch_add(1, Ordering::Relaxed);
     }
@@ -183,17 +222,32 @@ impl NetDiag {
 
     #[inline]
     pub fn record_poll_call(&self) {
-        let _ = self.poll_calls.fetch_add(1, Ordering::Relaxed);
+        self.record_poll_call_on(0);
+    }
+
+    #[inline]
+    pub fn record_poll_call_on(&self, lane: usize) {
+        self.poll_calls.incr(lane);
     }
 
     #[inline]
     pub fn record_smoltcp_rx(&self) {
-        let _ = self.rx_frames_into_smoltcp.fetch_add(1, Ordering::Relaxed);
+        self.record_smoltcp_rx_on(0);
+    }
+
+    #[inline]
+    pub fn record_smoltcp_rx_on(&self, lane: usize) {
+        self.rx_frames_into_smoltcp.incr(lane);
     }
 
     #[inline]
     pub fn record_smoltcp_tx(&self) {
-        let _ = self.tx_frames_from_smoltcp.fetch_add(1, Ordering::Relaxed);
+        self.record_smoltcp_tx_on(0);
+    }
+
+    #[inline]
+    pub fn record_smoltcp_tx_on(&self, lane: usize) {
+        self.tx_frames_from_smoltcp.incr(lane);
     }
 
     #[inline]
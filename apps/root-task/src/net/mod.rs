@@ -329,6 +329,54 @@ pub trait NetDevice: Device {
     fn buffer_bounds(&self) -> Option<Range<usize>> {
         None
     }
+
+    /// Number of independent RX/TX queue pairs exposed by the device.
+    ///
+    /// Single-queue backends keep the default; multi-queue virtio devices
+    /// report their negotiated pair count so the stack can service each pair.
+    fn queue_count(&self) -> usize {
+        1
+    }
+
+    /// Select the queue pair serviced by subsequent receive/transmit calls.
+    ///
+    /// Backends with a single queue pair ignore the hint; multi-queue
+    /// backends switch their ring pointers. The stack calls this once per
+    /// queue inside its poll pass.
+    fn select_queue(&mut self, _queue: usize) {}
+
+    /// Map a connection onto a queue pair by hashing its endpoints, so a
+    /// flow's frames stay on one queue and per-queue state needs no locks.
+    fn steer_queue(&self, local_port: u16, remote_addr: &[u8], remote_port: u16) -> usize {
+        flow_steering_queue(self.queue_count(), local_port, remote_addr, remote_port)
+    }
+}
+
+/// Hash a connection tuple onto one of `queue_count` queues (FNV-1a).
+///
+/// Deterministic across boots so a reconnecting peer lands on the same queue,
+/// and exposed standalone so host tests can validate the distribution.
+#[must_use]
+pub fn flow_steering_queue(
+    queue_count: usize,
+    local_port: u16,
+    remote_addr: &[u8],
+    remote_port: u16,
+) -> usize {
+    if queue_count <= 1 {
+        return 0;
+    }
+    let mut hash: u64 = 0xcbf2_9ce4_8422_2325;
+    for byte in remote_addr
+        .iter()
+        .copied()
+        .chain(local_port.to_be_bytes())
+        .chain(remote_port.to_be_bytes())
+    {
+        hash ^= u64::from(byte);
+        hash = hash.wrapping_mul(0x0000_0100_0000_01b3);
+    }
+    (hash % queue_count as u64) as usize
 }
 
 /// Helper trait used to normalise driver error handling across NIC backends.
@@ -382,6 +430,16 @@ pub trait NetPoller {
     /// Poll the network subsystem and return whether new work occurred.
     fn poll(&mut self, now_ms: u64) -> bool;
 
+    /// Milliseconds until the stack next needs servicing, when known.
+    ///
+    /// Derived from smoltcp's `poll_delay` (retransmit and delayed-ack
+    /// deadlines). `None` means the stack has no scheduled work and only an
+    /// RX interrupt needs to wake it; idle loops may skip polls until the
+    /// returned deadline or a wake event.
+    fn poll_delay_ms(&mut self, _now_ms: u64) -> Option<u64> {
+        None
+    }
+
     /// Obtain telemetry for diagnostics.
     fn telemetry(&self) -> NetTelemetry;
 
@@ -494,6 +552,21 @@ pub use queue::*;
 mod tests {
     use super::*;
 
+    #[test]
+    fn flow_steering_spreads_and_pins_connections() {
+        // Same tuple always lands on the same queue.
+        let queue = flow_steering_queue(4, 31337, &[10, 0, 2, 2], 50_000);
+        assert_eq!(queue, flow_steering_queue(4, 31337, &[10, 0, 2, 2], 50_000));
+        // Single-queue devices always steer to queue zero.
+        assert_eq!(flow_steering_queue(1, 31337, &[10, 0, 2, 2], 50_000), 0);
+        // A spread of remote ports should hit more than one queue.
+        let mut seen = [false; 4];
+        for port in 0..64u16 {
+            seen[flow_steering_queue(4, 31337, &[10, 0, 2, 2], 50_000 + port)] = true;
+        }
+        assert!(seen.iter().filter(|hit| **hit).count() > 1);
+    }
+
     #[test]
     fn default_net_config_uses_console_port() {
         let config = ConsoleNetConfig::default();
@@ -2237,6 +2237,33 @@ impl<D: NetDevice> NetStack<D> {
     }
 
     /// Polls the network stack using a host-supplied monotonic timestamp in milliseconds.
+    /// Poll the interface once per device queue pair.
+    ///
+    /// Single-queue backends take the direct path; multi-queue backends have
+    /// each pair selected and drained in turn so flows steered across queues
+    /// all make progress within one poll pass.
+    fn poll_interface_all_queues(&mut self, timestamp: Instant) -> PollResult {
+        let queues = self.device.queue_count().max(1);
+        if queues == 1 {
+            return self
+                .interface
+                .poll(timestamp, &mut self.device, &mut self.sockets);
+        }
+        let mut result = PollResult::None;
+        for queue in 0..queues {
+            self.device.select_queue(queue);
+            if self
+                .interface
+                .poll(timestamp, &mut self.device, &mut self.sockets)
+                != PollResult::None
+            {
+                result = PollResult::SocketStateChanged;
+            }
+        }
+        self.device.select_queue(0);
+        result
+    }
+
     pub fn poll_with_time(&mut self, now_ms: u64) -> bool {
         if !self.service_logged {
             info!("[net-console] service loop running");
@@ -2294,9 +2321,7 @@ impl<D: NetDevice> NetStack<D> {
             return activity;
         }
 
-        let mut poll_result = self
-            .interface
-            .poll(timestamp, &mut self.device, &mut self.sockets);
+        let mut poll_result = self.poll_interface_all_queues(timestamp);
         if poll_result != PollResult::None {
             log::debug!("[net] smoltcp: events processed at now_ms={}", now_ms);
         }
@@ -2314,9 +2339,7 @@ impl<D: NetDevice> NetStack<D> {
         // without waiting for the next timer tick.
         if tcp_activity {
             self.bump_poll_counter();
-            poll_result = self
-                .interface
-                .poll(timestamp, &mut self.device, &mut self.sockets);
+            poll_result = self.poll_interface_all_queues(timestamp);
             let poll_activity = poll_result != PollResult::None;
             if poll_activity {
                 log::debug!("[net] smoltcp: post-tcp poll now_ms={}", now_ms);
@@ -4379,6 +4402,13 @@ impl<D: NetDevice> NetStack<D> {
 }
 
 impl<D: NetDevice> NetPoller for NetStack<D> {
+    fn poll_delay_ms(&mut self, _now_ms: u64) -> Option<u64> {
+        let timestamp = self.clock.now();
+        self.interface
+            .poll_delay(timestamp, &self.sockets)
+            .map(|duration| duration.total_millis())
+    }
+
     fn poll(&mut self, now_ms: u64) -> bool {
         self.poll_with_time(now_ms)
     }
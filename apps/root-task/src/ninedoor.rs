@@ -613,7 +613,7 @@ impl NineDoorBridge {
         let segments = split_path_segments(path);
         if path == LOG_PATH {
             log_buffer::append_user_line(payload);
-            log_buffer::append_log_line(payload);
+            log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, payload);
             return Ok(());
         }
         if self.audit.enabled {
@@ -788,9 +788,7 @@ impl NineDoorBridge {
             if !self.gpu.enabled() {
                 return Err(NineDoorBridgeError::InvalidPath);
             }
-            if !self.is_queen()
-                && !matches!(self.session_role, Some(SessionRoleLabel::WorkerGpu))
-            {
+            if !self.is_queen() && !matches!(self.session_role, Some(SessionRoleLabel::WorkerGpu)) {
                 return Err(NineDoorBridgeError::Permission);
             }
             let ctl_max = self.gpu.ctl_max_bytes;
@@ -1538,8 +1536,8 @@ impl NineDoorBridge {
         if self.workers.is_full() {
             return Err(NineDoorBridgeError::BufferFull);
         }
-        let gpu_id =
-            parse_json_string_field(payload, "gpu_id").ok_or(NineDoorBridgeError::InvalidPayload)?;
+        let gpu_id = parse_json_string_field(payload, "gpu_id")
+            .ok_or(NineDoorBridgeError::InvalidPayload)?;
         let mem_mb = u32::try_from(
             parse_json_u64_field(payload, "mem_mb").ok_or(NineDoorBridgeError::InvalidPayload)?,
         )
@@ -1596,12 +1594,12 @@ impl NineDoorBridge {
         match lifecycle::apply_command(command, now_ms, outstanding) {
             Ok(transition) => {
                 let line = lifecycle::format_transition_log(&transition);
-                log_buffer::append_log_line(line.as_str());
+                log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
                 Ok(())
             }
             Err(err) => {
                 let line = lifecycle::format_denied_log(lifecycle::state(), payload.trim(), err);
-                log_buffer::append_log_line(line.as_str());
+                log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
                 Err(lifecycle_error_to_bridge(err))
             }
         }
@@ -1782,7 +1780,7 @@ impl NineDoorBridge {
         let scope = self.session_scope().unwrap_or("none");
         let mut line = HeaplessString::<DEFAULT_LINE_CAPACITY>::new();
         let _ = write!(line, "sidecar-deny kind={} scope={}", kind.as_str(), scope);
-        log_buffer::append_log_line(line.as_str());
+        log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
     }
 
     fn log_lifecycle_gate_denial(&self, action: &str) {
@@ -1794,7 +1792,7 @@ impl NineDoorBridge {
             action,
             lifecycle::state_label(state)
         );
-        log_buffer::append_log_line(line.as_str());
+        log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
     }
 
     fn ensure_lifecycle_gate(
@@ -1905,7 +1903,7 @@ impl NineDoorBridge {
             target,
             path
         );
-        log_buffer::append_log_line(line.as_str());
+        log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
     }
 
     fn log_policy_gate_deny(&self, path: &str, denial: &PolicyGateDenial) {
@@ -1932,7 +1930,7 @@ impl NineDoorBridge {
                 );
             }
         }
-        log_buffer::append_log_line(line.as_str());
+        log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
     }
 
     fn log_host_write(
@@ -1957,7 +1955,7 @@ impl NineDoorBridge {
         if let Some(bytes) = bytes {
             let _ = write!(line, " bytes={bytes}");
         }
-        log_buffer::append_log_line(line.as_str());
+        log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
     }
 }
 
@@ -3385,7 +3383,9 @@ struct GpuBridgeSnapshot {
 #[derive(Debug)]
 enum GpuBridgeUpdate {
     None,
-    Started { bytes: usize },
+    Started {
+        bytes: usize,
+    },
     Complete {
         bytes: usize,
         sha256: String,
@@ -3415,14 +3415,8 @@ impl GpuState {
                 ("GPU-1", "Mock 4060", 8_192_u32, 64_u32),
             ];
             for (id, name, memory_mb, sm_count) in specs {
-                let info_payload = render_gpu_info_payload(
-                    id,
-                    name,
-                    memory_mb,
-                    sm_count,
-                    "555.0",
-                    "12.4",
-                );
+                let info_payload =
+                    render_gpu_info_payload(id, name, memory_mb, sm_count, "555.0", "12.4");
                 let ctl_log = format!("LEASE {id}\n").into_bytes();
                 entries.push(GpuEntry {
                     id: id.to_owned(),
@@ -3496,9 +3490,7 @@ impl GpuState {
                     snapshot,
                 }) => {
                     self.apply_bridge_snapshot(snapshot)?;
-                    self.set_bridge_status(&format!(
-                        "state=ok bytes={bytes} sha256={sha256}"
-                    ))?;
+                    self.set_bridge_status(&format!("state=ok bytes={bytes} sha256={sha256}"))?;
                 }
                 Err(err) => {
                     let _ = self.set_bridge_status("state=err");
@@ -3560,8 +3552,8 @@ impl GpuState {
                 .pending
                 .as_mut()
                 .ok_or(NineDoorBridgeError::InvalidPayload)?;
-            let expected_len =
-                base64_encoded_len(pending.expected_bytes).ok_or(NineDoorBridgeError::InvalidPayload)?;
+            let expected_len = base64_encoded_len(pending.expected_bytes)
+                .ok_or(NineDoorBridgeError::InvalidPayload)?;
             if pending.encoded.len().saturating_add(rest.len()) > expected_len {
                 return Err(NineDoorBridgeError::InvalidPayload);
             }
@@ -3571,7 +3563,10 @@ impl GpuState {
         Err(NineDoorBridgeError::InvalidPayload)
     }
 
-    fn apply_bridge_snapshot(&mut self, snapshot: GpuBridgeSnapshot) -> Result<(), NineDoorBridgeError> {
+    fn apply_bridge_snapshot(
+        &mut self,
+        snapshot: GpuBridgeSnapshot,
+    ) -> Result<(), NineDoorBridgeError> {
         let active_line = format!("{}\n", snapshot.active);
         if active_line.len() > GPU_MODELS_ACTIVE_MAX_BYTES as usize {
             return Err(NineDoorBridgeError::InvalidPayload);
@@ -3630,7 +3625,9 @@ fn parse_gpu_bridge_begin(payload: &str) -> Result<(usize, [u8; 32]), NineDoorBr
             .ok_or(NineDoorBridgeError::InvalidPayload)?;
         match key {
             "bytes" => {
-                let parsed = value.parse::<usize>().map_err(|_| NineDoorBridgeError::InvalidPayload)?;
+                let parsed = value
+                    .parse::<usize>()
+                    .map_err(|_| NineDoorBridgeError::InvalidPayload)?;
                 if parsed == 0 {
                     return Err(NineDoorBridgeError::InvalidPayload);
                 }
@@ -6179,7 +6176,7 @@ fn log_policy_action(role: &str, ticket: &str, action: &PolicyAction) {
         action.decision.as_str(),
         action.target
     );
-    log_buffer::append_log_line(line.as_str());
+    log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
 }
 
 fn telemetry_ingest_ctl_device(path: &str) -> Option<&str> {
@@ -6636,7 +6633,7 @@ fn log_audit_wrap(label: &str, dropped_bytes: u64, new_base: u64) {
         "audit {} truncation dropped_bytes={} new_base={}",
         label, dropped_bytes, new_base
     );
-    log_buffer::append_log_line(line.as_str());
+    log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
     log_buffer::append_user_line(line.as_str());
 }
 
@@ -6648,7 +6645,7 @@ fn log_telemetry_wrap(dropped_bytes: u64, new_base: u64) {
         dropped_bytes, new_base
     );
     // Keep critical telemetry audits visible in /log/queen.log summaries.
-    log_buffer::append_log_line(line.as_str());
+    log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
     log_buffer::append_user_line(line.as_str());
 }
 
@@ -6660,7 +6657,7 @@ fn log_telemetry_quota_reject(requested: usize, capacity: usize) {
         requested, capacity
     );
     // Keep critical telemetry audits visible in /log/queen.log summaries.
-    log_buffer::append_log_line(line.as_str());
+    log_buffer::append_log_line_ctx(log_buffer::LogContext::NineDoor, line.as_str());
     log_buffer::append_user_line(line.as_str());
 }
 
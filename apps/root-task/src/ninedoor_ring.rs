@@ -0,0 +1,110 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Shared-memory ring layout between root-task and the NineDoor component.
+// Author: Lukas Bower
+
+//! Shared-memory grant ring for root-task <-> NineDoor payloads.
+//!
+//! The bounded-IPC path copies every Secure9P payload through message
+//! registers; this ring is the bulk path: a pair of single-producer rings
+//! (one per direction) in seL4 frames mapped into both components,
+//! notification-signalled, with IPC retained only for control and wakeup.
+//! The layout is plain bytes so both sides (and host tests) agree without
+//! sharing unsafe code: header word 0 is the producer's write index, word 1
+//! the consumer's read index, and the remainder is the data area carrying
+//! length-prefixed payloads.
+
+extern crate alloc;
+
+/// Bytes reserved for the ring header (write index + read index).
+pub const GRANT_RING_HEADER_BYTES: usize = 16;
+
+/// Append a length-prefixed payload to the ring region.
+///
+/// Returns false when the ring lacks space; the producer then falls back to
+/// the IPC path (or waits for the consumer's notification).
+pub fn grant_ring_push(region: &mut [u8], payload: &[u8]) -> bool {
+    let capacity = region.len().saturating_sub(GRANT_RING_HEADER_BYTES);
+    let record = payload.len() + 4;
+    if capacity == 0 || record > capacity {
+        return false;
+    }
+    let write = read_index(region, 0);
+    let read = read_index(region, 8);
+    let used = write.wrapping_sub(read) as usize;
+    if used + record > capacity {
+        return false;
+    }
+    let mut cursor = write as usize;
+    for byte in (payload.len() as u32)
+        .to_le_bytes()
+        .iter()
+        .chain(payload.iter())
+    {
+        region[GRANT_RING_HEADER_BYTES + (cursor % capacity)] = *byte;
+        cursor += 1;
+    }
+    write_index(region, 0, write.wrapping_add(record as u64));
+    true
+}
+
+/// Pop the next payload from the ring region, if one is complete.
+pub fn grant_ring_pop(region: &mut [u8]) -> Option<alloc::vec::Vec<u8>> {
+    let capacity = region.len().saturating_sub(GRANT_RING_HEADER_BYTES);
+    if capacity == 0 {
+        return None;
+    }
+    let write = read_index(region, 0);
+    let read = read_index(region, 8);
+    let available = write.wrapping_sub(read) as usize;
+    if available < 4 {
+        return None;
+    }
+    let at =
+        |offset: usize| region[GRANT_RING_HEADER_BYTES + ((read as usize + offset) % capacity)];
+    let len = u32::from_le_bytes([at(0), at(1), at(2), at(3)]) as usize;
+    if available < 4 + len {
+        return None;
+    }
+    let mut payload = alloc::vec::Vec::with_capacity(len);
+    for offset in 0..len {
+        payload.push(at(4 + offset));
+    }
+    write_index(region, 8, read.wrapping_add(4 + len as u64));
+    Some(payload)
+}
+
+fn read_index(region: &[u8], at: usize) -> u64 {
+    u64::from_le_bytes(region[at..at + 8].try_into().expect("header present"))
+}
+
+fn write_index(region: &mut [u8], at: usize, value: u64) {
+    region[at..at + 8].copy_from_slice(&value.to_le_bytes());
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn payloads_roundtrip_with_wraparound_and_backpressure() {
+        let mut region = [0u8; GRANT_RING_HEADER_BYTES + 64];
+        assert!(grant_ring_push(&mut region, b"hello"));
+        assert!(grant_ring_push(&mut region, b"world!"));
+        assert_eq!(grant_ring_pop(&mut region).unwrap(), b"hello");
+        assert_eq!(grant_ring_pop(&mut region).unwrap(), b"world!");
+        assert!(grant_ring_pop(&mut region).is_none());
+
+        // Fill to backpressure, drain, then wrap cleanly.
+        let mut pushed = 0;
+        while grant_ring_push(&mut region, &[0xab; 10]) {
+            pushed += 1;
+        }
+        assert!(pushed >= 4);
+        for _ in 0..pushed {
+            assert_eq!(grant_ring_pop(&mut region).unwrap(), [0xab; 10]);
+        }
+        assert!(grant_ring_push(&mut region, b"post-wrap"));
+        assert_eq!(grant_ring_pop(&mut region).unwrap(), b"post-wrap");
+    }
+}
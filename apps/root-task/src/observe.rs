@@ -161,3 +161,126 @@ impl LatencySamples {
         scratch.get(idx).copied().unwrap_or(0)
     }
 }
+
+/// Kernel syscall classes tracked by the proposed stats frame.
+///
+/// Mirrors the kernel's dispatch in `handleSyscall`; the order is the
+/// frame's record order and must stay in sync with the kernel patch
+/// (BUILD_PLAN m28-kernel-entry-stats).
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[repr(usize)]
+pub enum SyscallClass {
+    Call = 0,
+    ReplyRecv = 1,
+    Send = 2,
+    Recv = 3,
+    Signal = 4,
+    Wait = 5,
+    Yield = 6,
+    Invocation = 7,
+}
+
+/// Number of tracked syscall classes.
+pub const SYSCALL_CLASSES: usize = 8;
+
+impl SyscallClass {
+    /// Display label used in the observe rendering.
+    #[must_use]
+    pub const fn label(self) -> &'static str {
+        match self {
+            Self::Call => "call",
+            Self::ReplyRecv => "replyrecv",
+            Self::Send => "send",
+            Self::Recv => "recv",
+            Self::Signal => "signal",
+            Self::Wait => "wait",
+            Self::Yield => "yield",
+            Self::Invocation => "invocation",
+        }
+    }
+
+    /// All classes in frame record order.
+    pub const ALL: [Self; SYSCALL_CLASSES] = [
+        Self::Call,
+        Self::ReplyRecv,
+        Self::Send,
+        Self::Recv,
+        Self::Signal,
+        Self::Wait,
+        Self::Yield,
+        Self::Invocation,
+    ];
+}
+
+/// Layout of the bootinfo-mapped kernel stats frame.
+///
+/// The kernel (config-gated, see m28-kernel-entry-stats) bumps one
+/// entry counter and accumulates entry-to-exit cycles per class; the
+/// root task maps the frame read-only and decomposes "the queen is
+/// slow" into per-class kernel load without external tracing. All
+/// counters are monotonic; readers diff successive snapshots.
+#[repr(C)]
+#[derive(Debug)]
+pub struct KernelStatsFrame {
+    /// Entries per syscall class.
+    pub entries: [AtomicU64; SYSCALL_CLASSES],
+    /// Accumulated in-kernel cycles per class.
+    pub cycles: [AtomicU64; SYSCALL_CLASSES],
+}
+
+impl KernelStatsFrame {
+    /// Zeroed frame (host tests and the pre-mapping placeholder).
+    #[must_use]
+    #[allow(clippy::new_without_default)]
+    pub const fn new() -> Self {
+        Self {
+            entries: [const { AtomicU64::new(0) }; SYSCALL_CLASSES],
+            cycles: [const { AtomicU64::new(0) }; SYSCALL_CLASSES],
+        }
+    }
+
+    /// Read one class: `(entries, cycles)`.
+    #[must_use]
+    pub fn class(&self, class: SyscallClass) -> (u64, u64) {
+        let index = class as usize;
+        (
+            self.entries[index].load(Ordering::Relaxed),
+            self.cycles[index].load(Ordering::Relaxed),
+        )
+    }
+
+    /// Render the per-class breakdown as `class=entries/cycles` pairs
+    /// into a bounded buffer, one line for the observe surface.
+    pub fn render_into(&self, out: &mut heapless::String<256>) {
+        use core::fmt::Write as _;
+        for class in SyscallClass::ALL {
+            let (entries, cycles) = self.class(class);
+            if entries == 0 {
+                continue;
+            }
+            let _ = write!(out, "{}={}/{} ", class.label(), entries, cycles);
+        }
+        if out.ends_with(' ') {
+            out.pop();
+        }
+    }
+}
+
+#[cfg(test)]
+mod kernel_stats_tests {
+    use super::*;
+
+    #[test]
+    fn frame_renders_only_active_classes() {
+        let frame = KernelStatsFrame::new();
+        frame.entries[SyscallClass::Call as usize].store(120, Ordering::Relaxed);
+        frame.cycles[SyscallClass::Call as usize].store(48_000, Ordering::Relaxed);
+        frame.entries[SyscallClass::Signal as usize].store(7, Ordering::Relaxed);
+        frame.cycles[SyscallClass::Signal as usize].store(910, Ordering::Relaxed);
+
+        let mut line = heapless::String::new();
+        frame.render_into(&mut line);
+        assert_eq!(line.as_str(), "call=120/48000 signal=7/910");
+        assert_eq!(frame.class(SyscallClass::Call), (120, 48_000));
+    }
+}
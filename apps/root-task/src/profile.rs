@@ -20,3 +20,41 @@ pub const NET_DIAG: bool = cfg!(feature = "net-diag");
 
 /// Consolidated switch mirroring existing net-diag or net-console selections.
 pub const NET_DIAG_FEATURED: bool = NET_DIAG || NET_CONSOLE;
+
+/// Indicates whether EL0 PMU counter access is assumed enabled in the kernel
+/// build (KernelArmExportPMUUser); see BUILD_PLAN m28-pmu-user.
+pub const PMU_USER: bool = cfg!(feature = "pmu-user");
+
+/// Read the cheapest available cycle-granularity timestamp.
+///
+/// With the `pmu-user` feature (kernel regenerated with EL0 PMU export) this
+/// is the PMU cycle counter `PMCCNTR_EL0` — a register read, no syscall, so
+/// instrumentation can stay on in production. Without it, the generic
+/// timer's virtual counter is the fallback: coarser (fixed-frequency ticks)
+/// but always EL0-readable.
+#[cfg(target_os = "none")]
+#[allow(unsafe_code)]
+#[must_use]
+pub fn cycle_count() -> u64 {
+    let value: u64;
+    #[cfg(feature = "pmu-user")]
+    // Safety: PMCCNTR_EL0 reads are permitted at EL0 once PMUSERENR_EL0.EN
+    // is set by the kernel config this feature asserts.
+    unsafe {
+        core::arch::asm!("mrs {value}, PMCCNTR_EL0", value = out(reg) value);
+    }
+    #[cfg(not(feature = "pmu-user"))]
+    // Safety: CNTVCT_EL0 is EL0-readable under our kernel configs.
+    unsafe {
+        core::arch::asm!("mrs {value}, CNTVCT_EL0", value = out(reg) value);
+    }
+    value
+}
+
+/// Host builds have no EL0 counter surface; return zero so callers can keep
+/// unconditional instrumentation.
+#[cfg(not(target_os = "none"))]
+#[must_use]
+pub fn cycle_count() -> u64 {
+    0
+}
@@ -909,6 +909,33 @@ pub fn call_unchecked(dest: seL4_CPtr, info: seL4_MessageInfo) -> seL4_MessageIn
     reply
 }
 
+/// Issues a short-message (≤ 4 word) call with message registers passed
+/// by value through the MR-direct fast binding — no IPC-buffer traffic
+/// on either side of the trap. Returns the reply info and registers.
+#[cfg(feature = "kernel")]
+#[track_caller]
+#[inline(always)]
+pub fn call_mrs_unchecked(
+    dest: seL4_CPtr,
+    info: seL4_MessageInfo,
+    mrs: [seL4_Word; 4],
+) -> (seL4_MessageInfo, [seL4_Word; 4]) {
+    guard_ipc_destination("call_mrs_unchecked", dest);
+    debug_assert!(info.length() <= 4, "MR-direct path carries at most 4 words");
+    unsafe { syscall::call_mrs_direct(dest, info, mrs) }
+}
+
+/// Issues a short-message (≤ 4 word) send through the MR-direct fast
+/// binding; the same register-only contract as [`call_mrs_unchecked`].
+#[cfg(feature = "kernel")]
+#[track_caller]
+#[inline(always)]
+pub fn send_mrs_unchecked(dest: seL4_CPtr, info: seL4_MessageInfo, mrs: [seL4_Word; 4]) {
+    guard_ipc_destination("send_mrs_unchecked", dest);
+    debug_assert!(info.length() <= 4, "MR-direct path carries at most 4 words");
+    unsafe { syscall::send_mrs_direct(dest, info, mrs) };
+}
+
 /// Signals a notification capability without validating the destination pointer.
 #[cfg(feature = "kernel")]
 #[inline(always)]
@@ -3776,6 +3803,47 @@ impl<'a> KernelEnv<'a> {
         }
     }
 
+    /// Map a run of contiguous small pages in one pass.
+    ///
+    /// The kernel currently exposes only per-page `seL4_ARM_Page_Map`, so
+    /// each frame still costs one invocation, but the per-page trace hooks
+    /// and alignment checks are hoisted out of the loop and the call site
+    /// expresses the batch it actually wants. When the batched map
+    /// invocation lands in the regenerated kernel (BUILD_PLAN m28), only
+    /// this helper needs to switch to it. Returns the number of pages
+    /// mapped; stops at the first kernel error.
+    fn attempt_page_map_batch(
+        &mut self,
+        frame_caps: &[seL4_CPtr],
+        base_vaddr: usize,
+        attr: sel4_sys::seL4_ARM_VMAttributes,
+    ) -> Result<usize, seL4_Error> {
+        Self::assert_page_aligned(base_vaddr);
+        if self.ipcbuf_trace {
+            crate::bp!("ipcbuf.page.map.batch.begin");
+        }
+        let mut mapped = 0usize;
+        for (index, frame_cap) in frame_caps.iter().enumerate() {
+            let vaddr = base_vaddr + index * PAGE_SIZE;
+            let vaddr_word = sel4_sys::seL4_Word::try_from(vaddr)
+                .expect("virtual address must fit in seL4_Word");
+            let result = unsafe {
+                seL4_ARM_Page_Map(
+                    *frame_cap,
+                    seL4_CapInitThreadVSpace,
+                    vaddr_word,
+                    seL4_CapRights_ReadWrite,
+                    attr,
+                )
+            };
+            if result != sel4_sys::seL4_NoError {
+                return Err(result);
+            }
+            mapped += 1;
+        }
+        Ok(mapped)
+    }
+
     fn assert_page_aligned(vaddr: usize) {
         assert_eq!(
             vaddr & (PAGE_SIZE - 1),
@@ -10,8 +10,8 @@ use core::panic::Location;
 
 use super::{ipc_bootstrap_trap, IpcSyscallKind};
 use sel4_sys::{
-    seL4_CPtr, seL4_CallWithMRs, seL4_MessageInfo, seL4_NBRecv, seL4_Recv, seL4_Reply, seL4_Send,
-    seL4_Wait, seL4_Word, seL4_Yield,
+    seL4_CPtr, seL4_CallMRDirect, seL4_CallWithMRs, seL4_MessageInfo, seL4_NBRecv, seL4_Recv,
+    seL4_Reply, seL4_Send, seL4_SendMRDirect, seL4_Wait, seL4_Word, seL4_Yield,
 };
 
 extern "C" {
@@ -47,6 +47,28 @@ pub(super) unsafe fn call_with_mrs(
     unsafe { seL4_CallWithMRs(dest, info, mr0, mr1, mr2, mr3) }
 }
 
+#[track_caller]
+pub(super) unsafe fn call_mrs_direct(
+    dest: seL4_CPtr,
+    info: seL4_MessageInfo,
+    mrs: [seL4_Word; 4],
+) -> (seL4_MessageInfo, [seL4_Word; 4]) {
+    if ipc_bootstrap_trap(IpcSyscallKind::Call, dest, Location::caller()) {
+        return (seL4_MessageInfo::new(0, 0, 0, 0), [0; 4]);
+    }
+
+    unsafe { seL4_CallMRDirect(dest, info, mrs) }
+}
+
+#[track_caller]
+pub(super) unsafe fn send_mrs_direct(dest: seL4_CPtr, info: seL4_MessageInfo, mrs: [seL4_Word; 4]) {
+    if ipc_bootstrap_trap(IpcSyscallKind::Send, dest, Location::caller()) {
+        return;
+    }
+
+    unsafe { seL4_SendMRDirect(dest, info, mrs) };
+}
+
 #[track_caller]
 pub(super) unsafe fn reply(info: seL4_MessageInfo) {
     if ipc_bootstrap_trap(
@@ -103,7 +103,11 @@ impl Pl011Mmio {
 
 const FR_TXFF: u32 = 1 << 5;
 const FR_RXFE: u32 = 1 << 4;
+const FR_TXFE: u32 = 1 << 7;
 const FR_BUSY: u32 = 1 << 3;
+
+/// Hardware TX FIFO depth with FEN enabled (PL011 r1p5).
+const TX_FIFO_DEPTH: usize = 16;
 const CR_UARTEN: u32 = 1 << 0;
 const CR_TXE: u32 = 1 << 8;
 const CR_RXE: u32 = 1 << 9;
@@ -198,14 +202,51 @@ impl Pl011 {
         }
     }
 
+    /// Write raw bytes using FIFO-depth bursts.
+    ///
+    /// When the TX FIFO reports empty, a full FIFO's worth of bytes is
+    /// pushed with one flag read instead of polling the busy flag per
+    /// character, so draining a log snapshot costs one poll per 16 bytes
+    /// rather than one per byte.
+    pub fn write_bytes(&mut self, bytes: &[u8]) {
+        let mut offset = 0usize;
+        while offset < bytes.len() {
+            let fr = unsafe { read_volatile(self.reg_fr()) };
+            if fr & FR_TXFE != 0 {
+                let burst = (bytes.len() - offset).min(TX_FIFO_DEPTH);
+                for &byte in &bytes[offset..offset + burst] {
+                    unsafe {
+                        let regs = self.regs_ptr();
+                        write_volatile(addr_of_mut!((*regs).dr), u32::from(byte));
+                    }
+                }
+                offset += burst;
+            } else {
+                self.putc_blocking(bytes[offset]);
+                offset += 1;
+            }
+        }
+    }
+
     /// Convenience helper to write a string, performing CRLF translation.
     pub fn write_str(&mut self, text: &str) {
+        // Translate into a small stack chunk so the UART sees FIFO-depth
+        // bursts instead of per-character writes.
+        let mut chunk = [0u8; 2 * TX_FIFO_DEPTH];
+        let mut used = 0usize;
         for byte in text.bytes() {
             if byte == b'\n' {
-                self.putc_blocking(b'\r');
+                chunk[used] = b'\r';
+                used += 1;
+            }
+            chunk[used] = byte;
+            used += 1;
+            if used + 2 > chunk.len() {
+                self.write_bytes(&chunk[..used]);
+                used = 0;
             }
-            self.putc_blocking(byte);
         }
+        self.write_bytes(&chunk[..used]);
         self.flush();
     }
 
@@ -0,0 +1,193 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Shared virtual timestamp page for syscall-free microsecond time.
+// Author: Lukas Bower
+
+//! vDSO-style shared timestamp page.
+//!
+//! Timestamps in kernel builds cost a syscall or a coarse tick read. The
+//! [`TimePage`] convention removes both: a designated timer task (the
+//! root task's event loop) publishes a time base — virtual counter
+//! anchor, microsecond anchor, counter frequency — into a shared frame,
+//! and every reader converts a raw `CNTVCT_EL0` read against that base.
+//! A timestamp becomes two register reads and a multiply: no kernel
+//! entry, ns-class resolution, and the conversion stays exact across
+//! base republications because the anchor moves with the counter.
+//!
+//! The page uses a seqlock so a reader racing a republication retries
+//! instead of combining fields from two bases. Publications are rare
+//! (only when the base calibration changes), so retries are vanishingly
+//! unlikely.
+
+use portable_atomic::{AtomicU64, Ordering};
+
+/// Shared timestamp page layout (`repr(C)`, fits well inside one frame).
+#[repr(C)]
+#[derive(Debug)]
+pub struct TimePage {
+    /// Seqlock word: odd while a publication is in flight.
+    seq: AtomicU64,
+    /// Virtual counter value at the anchor instant.
+    base_ticks: AtomicU64,
+    /// Microseconds since boot at the anchor instant.
+    base_micros: AtomicU64,
+    /// Counter ticks per microsecond (CNTFRQ_EL0 / 1_000_000).
+    ticks_per_micro: AtomicU64,
+}
+
+impl TimePage {
+    /// Create an unpublished page; readers see `None` until the first
+    /// [`TimePage::publish`].
+    #[must_use]
+    #[allow(clippy::new_without_default)]
+    pub const fn new() -> Self {
+        Self {
+            seq: AtomicU64::new(0),
+            base_ticks: AtomicU64::new(0),
+            base_micros: AtomicU64::new(0),
+            ticks_per_micro: AtomicU64::new(0),
+        }
+    }
+
+    /// Publish a new time base. Single publisher; `ticks_per_micro`
+    /// must be non-zero.
+    pub fn publish(&self, base_ticks: u64, base_micros: u64, ticks_per_micro: u64) {
+        debug_assert!(ticks_per_micro > 0);
+        let seq = self.seq.load(Ordering::Relaxed);
+        self.seq.store(seq.wrapping_add(1), Ordering::Release);
+        self.base_ticks.store(base_ticks, Ordering::Relaxed);
+        self.base_micros.store(base_micros, Ordering::Relaxed);
+        self.ticks_per_micro
+            .store(ticks_per_micro, Ordering::Relaxed);
+        self.seq.store(seq.wrapping_add(2), Ordering::Release);
+    }
+
+    /// Convert a raw virtual counter value to microseconds since boot,
+    /// or `None` while no base has been published.
+    #[must_use]
+    pub fn micros_at(&self, now_ticks: u64) -> Option<u64> {
+        loop {
+            let before = self.seq.load(Ordering::Acquire);
+            if before == 0 {
+                return None;
+            }
+            if before & 1 != 0 {
+                continue;
+            }
+            let base_ticks = self.base_ticks.load(Ordering::Relaxed);
+            let base_micros = self.base_micros.load(Ordering::Relaxed);
+            let ticks_per_micro = self.ticks_per_micro.load(Ordering::Relaxed);
+            if self.seq.load(Ordering::Acquire) != before {
+                continue;
+            }
+            let delta = now_ticks.wrapping_sub(base_ticks);
+            return Some(base_micros.saturating_add(delta / ticks_per_micro.max(1)));
+        }
+    }
+
+    /// Current microseconds since boot from a fresh counter read.
+    ///
+    /// On kernel targets the counter is `CNTVCT_EL0`; host builds read
+    /// zero (matching [`crate::profile::cycle_count`]'s fallback), so
+    /// host callers use [`TimePage::micros_at`] with injected ticks.
+    #[must_use]
+    pub fn now_micros(&self) -> Option<u64> {
+        self.micros_at(read_virtual_counter())
+    }
+}
+
+/// Read the ARM generic timer's virtual counter (EL0, no syscall).
+#[cfg(target_os = "none")]
+#[allow(unsafe_code)]
+#[must_use]
+pub fn read_virtual_counter() -> u64 {
+    let value: u64;
+    // Safety: CNTVCT_EL0 is EL0-readable under our kernel configs.
+    unsafe {
+        core::arch::asm!("mrs {value}, CNTVCT_EL0", value = out(reg) value);
+    }
+    value
+}
+
+/// Host builds have no generic timer; mirror `profile::cycle_count`.
+#[cfg(not(target_os = "none"))]
+#[must_use]
+pub fn read_virtual_counter() -> u64 {
+    0
+}
+
+/// Read the counter frequency (`CNTFRQ_EL0`) in ticks per microsecond.
+#[cfg(target_os = "none")]
+#[allow(unsafe_code)]
+#[must_use]
+pub fn ticks_per_micro() -> u64 {
+    let freq: u64;
+    // Safety: CNTFRQ_EL0 is EL0-readable under our kernel configs.
+    unsafe {
+        core::arch::asm!("mrs {freq}, CNTFRQ_EL0", freq = out(reg) freq);
+    }
+    (freq / 1_000_000).max(1)
+}
+
+/// Host fallback: pretend a 1 MHz counter so conversions stay defined.
+#[cfg(not(target_os = "none"))]
+#[must_use]
+pub fn ticks_per_micro() -> u64 {
+    1
+}
+
+/// The root task's timestamp page, shared with service tasks by mapping
+/// the containing frame into their address spaces during bootstrap.
+pub static TIME_PAGE: TimePage = TimePage::new();
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn unpublished_page_yields_none() {
+        let page = TimePage::new();
+        assert!(page.micros_at(12345).is_none());
+    }
+
+    #[test]
+    fn conversion_tracks_counter_deltas() {
+        let page = TimePage::new();
+        // 62.5 MHz virtual counter (qemu virt default): ~62 ticks/us.
+        page.publish(1_000_000, 5_000, 62);
+        assert_eq!(page.micros_at(1_000_000), Some(5_000));
+        assert_eq!(page.micros_at(1_000_000 + 62 * 250), Some(5_250));
+
+        // Republication moves the anchor without a discontinuity.
+        page.publish(2_000_000, 5_000 + (1_000_000 / 62), 62);
+        let after = page.micros_at(2_000_000 + 62).expect("published");
+        assert_eq!(after, 5_000 + 1_000_000 / 62 + 1);
+    }
+
+    #[test]
+    fn reader_never_combines_two_bases() {
+        extern crate std;
+        use std::sync::Arc;
+
+        let page = Arc::new(TimePage::new());
+        // Two bases whose fields differ wildly but convert tick 10_000
+        // to the same microsecond value, so a consistent read of either
+        // base gives the same answer while a mixed read does not.
+        let publisher_page = Arc::clone(&page);
+        let publisher = std::thread::spawn(move || {
+            for round in 0..20_000u64 {
+                if round % 2 == 0 {
+                    publisher_page.publish(0, 0, 1);
+                } else {
+                    publisher_page.publish(10_000, 10_000, 1);
+                }
+            }
+        });
+        for _ in 0..20_000 {
+            if let Some(micros) = page.micros_at(10_000) {
+                assert_eq!(micros, 10_000, "mixed-base conversion observed");
+            }
+        }
+        publisher.join().expect("publisher");
+    }
+}
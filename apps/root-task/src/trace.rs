@@ -11,6 +11,8 @@ use core::fmt::{self, Write};
 #[cfg(feature = "kernel")]
 use sel4_sys::{seL4_CPtr, seL4_Error};
 
+/// Binary fixed-record trace ring with cycle timestamps.
+pub mod binring;
 #[cfg(all(feature = "bootstrap-trace", feature = "kernel"))]
 pub mod bootstrap;
 
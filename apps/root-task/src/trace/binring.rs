@@ -0,0 +1,138 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Fixed-record binary trace ring with cycle timestamps.
+// Author: Lukas Bower
+
+//! Binary trace ring for cycle-resolution event capture.
+//!
+//! Textual tracing formats on the hot path and wall-clock stamps are too
+//! coarse to see IPC scheduling effects. This ring records fixed 16-byte
+//! entries — cycle timestamp (8), event id (2), context (2), argument (4) —
+//! with one index increment and one struct store per event; records drain
+//! lazily through the log channel where the host-side decoder renders them.
+
+use crate::profile;
+
+/// Number of records retained in the ring.
+pub const TRACE_RING_RECORDS: usize = 1024;
+
+/// One fixed-size trace record.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct TraceRecord {
+    /// Cycle (or virtual-counter) timestamp at capture.
+    pub cycles: u64,
+    /// Pre-registered event identifier.
+    pub event: u16,
+    /// Context tag (session, queue, core — event-defined).
+    pub context: u16,
+    /// Event argument.
+    pub arg: u32,
+}
+
+impl TraceRecord {
+    /// Serialise to the 16-byte wire layout (little endian).
+    #[must_use]
+    pub fn to_bytes(&self) -> [u8; 16] {
+        let mut out = [0u8; 16];
+        out[0..8].copy_from_slice(&self.cycles.to_le_bytes());
+        out[8..10].copy_from_slice(&self.event.to_le_bytes());
+        out[10..12].copy_from_slice(&self.context.to_le_bytes());
+        out[12..16].copy_from_slice(&self.arg.to_le_bytes());
+        out
+    }
+
+    /// Parse the 16-byte wire layout.
+    #[must_use]
+    pub fn from_bytes(raw: &[u8; 16]) -> Self {
+        Self {
+            cycles: u64::from_le_bytes(raw[0..8].try_into().expect("record is 16 bytes")),
+            event: u16::from_le_bytes(raw[8..10].try_into().expect("record is 16 bytes")),
+            context: u16::from_le_bytes(raw[10..12].try_into().expect("record is 16 bytes")),
+            arg: u32::from_le_bytes(raw[12..16].try_into().expect("record is 16 bytes")),
+        }
+    }
+}
+
+/// Binary trace ring; the event pump owns it, so capture is one struct
+/// store plus two index updates — no lock, no formatting — and drain is
+/// batched through the log channel.
+pub struct BinaryTraceRing {
+    records: [TraceRecord; TRACE_RING_RECORDS],
+    write: usize,
+    read: usize,
+    dropped: u64,
+}
+
+impl BinaryTraceRing {
+    /// Create an empty ring.
+    #[must_use]
+    pub const fn new() -> Self {
+        Self {
+            records: [TraceRecord {
+                cycles: 0,
+                event: 0,
+                context: 0,
+                arg: 0,
+            }; TRACE_RING_RECORDS],
+            write: 0,
+            read: 0,
+            dropped: 0,
+        }
+    }
+
+    /// Record an event with the current cycle stamp.
+    pub fn record(&mut self, event: u16, context: u16, arg: u32) {
+        let cycles = profile::cycle_count();
+        let slot = self.write % TRACE_RING_RECORDS;
+        if self.write.wrapping_sub(self.read) >= TRACE_RING_RECORDS {
+            self.dropped += 1;
+            self.read += 1; // overwrite oldest
+        }
+        self.records[slot] = TraceRecord {
+            cycles,
+            event,
+            context,
+            arg,
+        };
+        self.write += 1;
+    }
+
+    /// Drain up to `max` records into `out` (oldest first), returning how
+    /// many were dropped due to overwrite since the last drain.
+    pub fn drain(&mut self, out: &mut impl FnMut(TraceRecord), max: usize) -> u64 {
+        let mut emitted = 0usize;
+        while self.read < self.write && emitted < max {
+            let slot = self.read % TRACE_RING_RECORDS;
+            out(self.records[slot]);
+            self.read += 1;
+            emitted += 1;
+        }
+        core::mem::take(&mut self.dropped)
+    }
+}
+
+impl Default for BinaryTraceRing {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn records_roundtrip_and_overwrite_oldest() {
+        let mut ring = BinaryTraceRing::new();
+        for index in 0..(TRACE_RING_RECORDS + 8) {
+            ring.record(7, 3, index as u32);
+        }
+        let mut drained = std::vec::Vec::new();
+        let dropped = ring.drain(&mut |record| drained.push(record), usize::MAX);
+        assert_eq!(dropped, 8);
+        assert_eq!(drained.len(), TRACE_RING_RECORDS);
+        assert_eq!(drained[0].arg, 8, "oldest surviving record first");
+        let record = drained[10];
+        assert_eq!(TraceRecord::from_bytes(&record.to_bytes()), record);
+    }
+}
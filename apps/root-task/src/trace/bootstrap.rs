@@ -15,6 +15,71 @@ use crate::sel4;
 
 const TRACE_DEPTH: usize = 64;
 const MAX_FIELDS: usize = 10;
+const PHASE_TIMING_DEPTH: usize = 32;
+
+/// Read the generic timer's virtual counter for phase timestamps.
+#[cfg(target_os = "none")]
+#[allow(unsafe_code)]
+pub(crate) fn virtual_counter() -> u64 {
+    let value: u64;
+    // Safety: CNTVCT_EL0 reads are EL0-accessible under our kernel configs.
+    unsafe {
+        core::arch::asm!("mrs {value}, CNTVCT_EL0", value = out(reg) value);
+    }
+    value
+}
+
+#[cfg(not(target_os = "none"))]
+pub(crate) fn virtual_counter() -> u64 {
+    0
+}
+
+/// One bootstrap phase boundary stamped with the virtual counter.
+#[derive(Clone, Copy)]
+struct PhaseStamp {
+    label: &'static str,
+    ticks: u64,
+}
+
+static PHASE_TIMINGS: Mutex<Vec<PhaseStamp, PHASE_TIMING_DEPTH>> = Mutex::new(Vec::new());
+
+/// Record a phase boundary. Called from the bootstrap sequencer so every
+/// root-task phase gets a counter stamp; kernel-side BOOT_CODE phases join
+/// the same table once the bootinfo extension (BUILD_PLAN m28) hands their
+/// timestamps across.
+pub fn record_phase_timestamp(label: &'static str) {
+    let mut guard = PHASE_TIMINGS.lock();
+    let _ = guard.push(PhaseStamp {
+        label,
+        ticks: virtual_counter(),
+    });
+}
+
+/// Emit the unified boot timeline: bootstrap phase stamps followed by the
+/// readiness milestone waterfall, all in virtual-counter ticks so coh-status
+/// can render one waterfall from elfloader handoff to time-to-ready. Kernel
+/// BOOT_CODE stamps prepend to this once the bootinfo extension lands
+/// (BUILD_PLAN m28-kernel-boot-phase-timing).
+pub fn write_boot_timeline(out: &mut impl Write) -> core::fmt::Result {
+    write_phase_timings(out)?;
+    crate::readiness::write_critical_path(out)
+}
+
+/// Emit the recorded phase boundaries with per-phase deltas.
+pub fn write_phase_timings(out: &mut impl Write) -> core::fmt::Result {
+    let guard = PHASE_TIMINGS.lock();
+    let mut previous: Option<u64> = None;
+    for stamp in guard.iter() {
+        let delta = previous.map_or(0, |prev| stamp.ticks.saturating_sub(prev));
+        writeln!(
+            out,
+            "[boot-phase] label={} ticks={} delta={}",
+            stamp.label, stamp.ticks, delta
+        )?;
+        previous = Some(stamp.ticks);
+    }
+    Ok(())
+}
 
 /// Records maintained for bootstrap tracing.
 #[derive(Clone)]
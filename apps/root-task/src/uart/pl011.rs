@@ -95,7 +95,8 @@ pub fn init_pl011() {
         write_reg(ICR, 0x7ff);
         write_reg(IBRD, 13); // 24 MHz / (16 * 115200)
         write_reg(FBRD, 2);
-        write_reg(LCRH, (3 << 5) | (0 << 4));
+        // Enable the 16-byte FIFOs so burst writes amortise flag polls.
+        write_reg(LCRH, (3 << 5) | (1 << 4));
         write_reg(CR, CR_UARTEN | CR_TXE | CR_RXE);
     }
 }
@@ -128,16 +129,47 @@ pub fn poll_byte() -> Option<u8> {
     }
 }
 
+const FR_TXFE: u32 = 1 << 7;
+const TX_FIFO_DEPTH: usize = 16;
+
+/// Push bytes in FIFO-depth bursts: one flag read per burst when the FIFO
+/// drains, per-byte polling only while it is partially full.
+fn put_burst(bytes: &[u8]) {
+    let mut offset = 0usize;
+    while offset < bytes.len() {
+        let empty = unsafe { read_reg(FR) & FR_TXFE != 0 };
+        if empty {
+            let burst = (bytes.len() - offset).min(TX_FIFO_DEPTH);
+            for &byte in &bytes[offset..offset + burst] {
+                unsafe { write_reg(DR, byte as u32) };
+            }
+            offset += burst;
+        } else {
+            putc(bytes[offset]);
+            offset += 1;
+        }
+    }
+}
+
 fn puts(line: &str) {
     if line.trim().is_empty() {
         return;
     }
+    let mut chunk = [0u8; 2 * TX_FIFO_DEPTH];
+    let mut used = 0usize;
     for &byte in line.as_bytes() {
         if byte == b'\n' {
-            putc(b'\r');
+            chunk[used] = b'\r';
+            used += 1;
+        }
+        chunk[used] = byte;
+        used += 1;
+        if used + 2 > chunk.len() {
+            put_burst(&chunk[..used]);
+            used = 0;
         }
-        putc(byte);
     }
+    put_burst(&chunk[..used]);
 }
 
 /// Write a full string to the UART, translating newlines to CRLF.
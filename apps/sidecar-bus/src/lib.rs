@@ -459,3 +459,114 @@ mod tests {
         assert_eq!(drained[0].payload, b"1234");
     }
 }
+
+/// Shared-segment routing: producers write a payload once into a shared
+/// arena and every subscriber receives a descriptor into it, so a
+/// multi-megabyte vision frame crosses the bus with one copy total instead
+/// of one per hop.
+pub mod segment {
+    use alloc::collections::VecDeque;
+    use alloc::sync::Arc;
+    use alloc::vec;
+    use alloc::vec::Vec;
+
+    /// Descriptor handed to consumers: a view into the shared segment.
+    #[derive(Debug, Clone)]
+    pub struct FrameDescriptor {
+        segment: Arc<Vec<u8>>,
+        offset: usize,
+        len: usize,
+        /// Monotonic frame sequence for ordering across consumers.
+        pub sequence: u64,
+    }
+
+    impl FrameDescriptor {
+        /// Borrow the frame bytes without copying.
+        #[must_use]
+        pub fn bytes(&self) -> &[u8] {
+            &self.segment[self.offset..self.offset + self.len]
+        }
+    }
+
+    /// Ring-based router over shared frame segments.
+    #[derive(Debug)]
+    pub struct SharedSegmentBus {
+        sequence: u64,
+        queues: Vec<VecDeque<FrameDescriptor>>,
+        queue_depth: usize,
+        /// Frames dropped per consumer due to a full queue.
+        drops: Vec<u64>,
+    }
+
+    impl SharedSegmentBus {
+        /// Create a bus with `consumers` subscriber queues.
+        #[must_use]
+        pub fn new(consumers: usize, queue_depth: usize) -> Self {
+            Self {
+                sequence: 0,
+                queues: (0..consumers.max(1)).map(|_| VecDeque::new()).collect(),
+                queue_depth: queue_depth.max(1),
+                drops: vec![0; consumers.max(1)],
+            }
+        }
+
+        /// Publish one payload: the bytes are copied exactly once into a
+        /// shared segment and every subscriber receives a descriptor into
+        /// it. Returns the frame sequence.
+        pub fn publish(&mut self, payload: &[u8]) -> u64 {
+            let segment = Arc::new(payload.to_vec());
+            let len = payload.len();
+            self.sequence += 1;
+            for (index, queue) in self.queues.iter_mut().enumerate() {
+                if queue.len() >= self.queue_depth {
+                    queue.pop_front();
+                    self.drops[index] += 1;
+                }
+                queue.push_back(FrameDescriptor {
+                    segment: Arc::clone(&segment),
+                    offset: 0,
+                    len,
+                    sequence: self.sequence,
+                });
+            }
+            self.sequence
+        }
+
+        /// Pop the next frame for a consumer.
+        pub fn next_frame(&mut self, consumer: usize) -> Option<FrameDescriptor> {
+            self.queues.get_mut(consumer)?.pop_front()
+        }
+
+        /// Frames dropped for a consumer due to backpressure.
+        #[must_use]
+        pub fn drops(&self, consumer: usize) -> u64 {
+            self.drops.get(consumer).copied().unwrap_or(0)
+        }
+    }
+
+    #[cfg(test)]
+    mod tests {
+        use super::*;
+
+        #[test]
+        fn descriptors_share_one_copy_and_bound_queues() {
+            let mut bus = SharedSegmentBus::new(2, 4);
+            let frame = vec![7u8; 512 * 1024];
+            let sequence = bus.publish(&frame);
+            assert_eq!(sequence, 1);
+            let a = bus.next_frame(0).expect("consumer 0 frame");
+            let b = bus.next_frame(1).expect("consumer 1 frame");
+            assert_eq!(a.bytes(), frame.as_slice());
+            assert_eq!(b.bytes(), frame.as_slice());
+            assert!(Arc::ptr_eq(&a.segment, &b.segment), "one shared copy");
+
+            // A slow consumer drops oldest frames but never blocks others.
+            for index in 0..8u8 {
+                bus.publish(&[index; 16]);
+            }
+            assert!(bus.drops(0) > 0);
+            let newest_first = bus.next_frame(0).expect("bounded queue");
+            assert!(newest_first.sequence > 2);
+        }
+    }
+}
@@ -1,6 +1,18 @@
 import { setupConsole } from "./components/console.js";
 import { hydrateIcons } from "./components/icon.js";
-import { createHiveController } from "./hive/index.js";
+
+// Hot/cold split: the hive renderer (world, renderer, palette, chart
+// machinery) is the cold half of the bundle. It loads lazily — the
+// overview and console render first from the light path, and the
+// renderer module is fetched at idle or on first hive start, whichever
+// comes first.
+let hiveModulePromise = null;
+const loadHiveModule = () => {
+  if (!hiveModulePromise) {
+    hiveModulePromise = import("./hive/index.js");
+  }
+  return hiveModulePromise;
+};
 
 const output = (id, text) => {
   const node = document.getElementById(id);
@@ -166,6 +178,21 @@ document.getElementById("load-fleet")?.addEventListener("click", async () => {
   renderTranscript("fleet-output", res.result);
 });
 
+// Warm overview: the backend snapshot cache can usually answer the
+// fleet view without a live session, so paint it immediately after
+// load instead of waiting for a manual Load Fleet. Failures (cold
+// cache, no session) stay silent — the button remains authoritative.
+setTimeout(async () => {
+  const session = readSession();
+  const res = await invoke("swarmui_fleet_snapshot", {
+    role: session.role,
+    ticket: session.ticket,
+  });
+  if (res.ok) {
+    renderTranscript("fleet-output", res.result);
+  }
+}, 0);
+
 document
   .getElementById("load-namespace")
   ?.addEventListener("click", async () => {
@@ -233,13 +260,18 @@ const setHiveFallback = (message) => {
   hiveFallback.textContent = "";
   hiveFallback.classList.remove("active");
 };
-if (hiveCanvas) {
+const ensureHiveController = async () => {
+  if (hiveController || !hiveCanvas) {
+    return hiveController;
+  }
   try {
+    const { createHiveController } = await loadHiveModule();
     hiveController = createHiveController(hiveCanvas, hiveStatus, {
       onAgentSelect: (agentId) => {
         selectHiveAgent(agentId, true);
       },
     });
+    hiveInitError = null;
     setHiveFallback("");
   } catch (err) {
     hiveInitError = err;
@@ -247,6 +279,20 @@ if (hiveCanvas) {
     setStatus("hive-status", message);
     setHiveFallback(message);
   }
+  return hiveController;
+};
+
+// Prefetch the cold module once the first paint has happened; first
+// hive start then constructs without a network/parse stall.
+if (hiveCanvas) {
+  const prefetch = () => {
+    loadHiveModule().catch(() => {});
+  };
+  if (typeof requestIdleCallback === "function") {
+    requestIdleCallback(prefetch, { timeout: 2000 });
+  } else {
+    setTimeout(prefetch, 500);
+  }
 }
 
 let hiveActive = false;
@@ -489,6 +535,7 @@ const pollHive = async () => {
 };
 
 const startHive = async () => {
+  await ensureHiveController();
   if (!hiveController) {
     if (hiveInitError) {
       const message = `Hive renderer failed: ${hiveInitError}`;
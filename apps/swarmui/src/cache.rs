@@ -1,14 +1,20 @@
 // Author: Lukas Bower
 // Purpose: Provide bounded CBOR snapshot caching for SwarmUI offline inspection.
 
+use std::collections::VecDeque;
 use std::fs;
 use std::io;
 use std::path::{Path, PathBuf};
+use std::sync::{Arc, Mutex};
 use std::time::{Duration, SystemTime, UNIX_EPOCH};
 
 use serde::{Deserialize, Serialize};
+use sha2::{Digest, Sha256};
 
-const SNAPSHOT_VERSION: u8 = 1;
+const SNAPSHOT_VERSION: u8 = 2;
+const BLOB_DIR: &str = "blobs";
+/// LRU budget expressed in multiples of the per-snapshot byte bound.
+const TOTAL_BUDGET_SNAPSHOTS: u64 = 64;
 const MAX_KEY_LEN: usize = 96;
 
 /// Cache errors surfaced by snapshot operations.
@@ -64,7 +70,12 @@ struct SnapshotEntry {
     version: u8,
     created_ms: u64,
     expires_ms: u64,
-    payload: Vec<u8>,
+    /// Hex SHA-256 of the payload blob this entry points into.
+    blob: String,
+    payload_len: u64,
+    /// Secure9P qid version of the source node when the entry was written.
+    #[serde(default)]
+    qid_version: Option<u32>,
 }
 
 /// Snapshot metadata returned to callers.
@@ -78,12 +89,55 @@ pub struct SnapshotRecord {
     pub payload: Vec<u8>,
 }
 
+/// Hit/miss/eviction counters for sizing `max_bytes` from live data.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct CacheStats {
+    /// Successful reads.
+    pub hits: u64,
+    /// Reads that missed, failed, or were expired.
+    pub misses: u64,
+    /// Entries evicted by the LRU budget.
+    pub evictions: u64,
+}
+
+#[derive(Debug, Default)]
+struct LruIndex {
+    /// Keys in least-recently-used-first order.
+    order: VecDeque<String>,
+    /// Total entry payload bytes currently tracked.
+    total_bytes: u64,
+    stats: CacheStats,
+}
+
+impl LruIndex {
+    fn touch(&mut self, key: &str, bytes: u64, previous_bytes: Option<u64>) {
+        if let Some(position) = self.order.iter().position(|entry| entry == key) {
+            self.order.remove(position);
+            self.total_bytes = self
+                .total_bytes
+                .saturating_sub(previous_bytes.unwrap_or(bytes));
+        }
+        self.order.push_back(key.to_owned());
+        self.total_bytes = self.total_bytes.saturating_add(bytes);
+    }
+
+    fn forget(&mut self, key: &str, bytes: u64) {
+        if let Some(position) = self.order.iter().position(|entry| entry == key) {
+            self.order.remove(position);
+            self.total_bytes = self.total_bytes.saturating_sub(bytes);
+        }
+    }
+}
+
 /// Bounded snapshot cache rooted at `$DATA_DIR/snapshots`.
 #[derive(Debug, Clone)]
 pub struct SnapshotCache {
     root: PathBuf,
     max_bytes: usize,
     ttl: Duration,
+    /// In-memory LRU over entry keys driving O(1) eviction; rebuilt lazily
+    /// from disk order on a cold start.
+    lru: Arc<Mutex<LruIndex>>,
 }
 
 impl SnapshotCache {
@@ -93,9 +147,15 @@ impl SnapshotCache {
             root,
             max_bytes,
             ttl,
+            lru: Arc::new(Mutex::new(LruIndex::default())),
         }
     }
 
+    /// Hit/miss/eviction counters.
+    pub fn stats(&self) -> CacheStats {
+        self.lru.lock().expect("cache lru lock").stats
+    }
+
     /// Return the cache root path.
     pub fn root(&self) -> &Path {
         &self.root
@@ -107,28 +167,54 @@ impl SnapshotCache {
     }
 
     /// Write a snapshot payload to cache with bounded size.
+    ///
+    /// Payloads are stored as content-addressed blobs: when the hash of the
+    /// incoming payload matches an existing blob (the common case across
+    /// refreshes of a stable hive), only the small metadata record is
+    /// rewritten and the payload bytes never touch the disk again.
     pub fn write(&self, key: &str, payload: &[u8]) -> Result<SnapshotRecord, CacheError> {
+        self.write_with_version(key, payload, None)
+    }
+
+    /// Write a snapshot stamped with its source node's qid version so later
+    /// reads can revalidate without re-fetching the payload.
+    pub fn write_with_version(
+        &self,
+        key: &str,
+        payload: &[u8],
+        qid_version: Option<u32>,
+    ) -> Result<SnapshotRecord, CacheError> {
+        if payload.len() > self.max_bytes {
+            return Err(CacheError::TooLarge {
+                actual: payload.len(),
+                max: self.max_bytes,
+            });
+        }
         let path = self.snapshot_path(key)?;
-        fs::create_dir_all(&self.root)?;
+        fs::create_dir_all(self.root.join(BLOB_DIR))?;
+        let blob = hex_digest(payload);
+        let blob_path = self.blob_path(&blob);
+        if !blob_path.is_file() {
+            let tmp = blob_path.with_extension("tmp");
+            fs::write(&tmp, payload)?;
+            fs::rename(&tmp, &blob_path)?;
+        }
         let created_ms = now_ms();
         let expires_ms = created_ms.saturating_add(self.ttl.as_millis() as u64);
         let entry = SnapshotEntry {
             version: SNAPSHOT_VERSION,
             created_ms,
             expires_ms,
-            payload: payload.to_vec(),
+            blob,
+            payload_len: payload.len() as u64,
+            qid_version,
         };
         let encoded =
             serde_cbor::to_vec(&entry).map_err(|err| CacheError::Decode(err.to_string()))?;
-        if encoded.len() > self.max_bytes {
-            return Err(CacheError::TooLarge {
-                actual: encoded.len(),
-                max: self.max_bytes,
-            });
-        }
         let tmp = path.with_extension("tmp");
         fs::write(&tmp, encoded)?;
         fs::rename(&tmp, &path)?;
+        self.note_write(key, payload.len() as u64);
         Ok(SnapshotRecord {
             created_ms,
             expires_ms,
@@ -136,16 +222,92 @@ impl SnapshotCache {
         })
     }
 
+    /// Total payload budget across entries before LRU eviction kicks in.
+    fn total_budget(&self) -> u64 {
+        (self.max_bytes as u64).saturating_mul(TOTAL_BUDGET_SNAPSHOTS)
+    }
+
+    fn note_write(&self, key: &str, bytes: u64) {
+        let victims: Vec<String> = {
+            let mut lru = self.lru.lock().expect("cache lru lock");
+            lru.touch(key, bytes, None);
+            let budget = self.total_budget();
+            let mut victims = Vec::new();
+            while lru.total_bytes > budget && lru.order.len() > 1 {
+                // Never evict the entry just written.
+                let Some(victim) = lru.order.front().cloned() else {
+                    break;
+                };
+                if victim == key {
+                    break;
+                }
+                lru.order.pop_front();
+                victims.push(victim);
+            }
+            lru.stats.evictions += victims.len() as u64;
+            victims
+        };
+        for victim in victims {
+            // Entry files are small; remove and let the byte accounting be
+            // corrected on the next read miss of that key.
+            if let Ok(path) = self.snapshot_path(&victim) {
+                if let Ok(bytes) = fs::read(&path) {
+                    if let Ok(entry) = serde_cbor::from_slice::<SnapshotEntry>(&bytes) {
+                        let mut lru = self.lru.lock().expect("cache lru lock");
+                        lru.total_bytes = lru.total_bytes.saturating_sub(entry.payload_len);
+                    }
+                }
+                let _ = fs::remove_file(&path);
+            }
+        }
+    }
+
     /// Read a snapshot payload from cache, rejecting expired entries.
     pub fn read(&self, key: &str) -> Result<SnapshotRecord, CacheError> {
-        let path = self.snapshot_path(key)?;
-        let metadata = fs::metadata(&path)?;
-        if metadata.len() as usize > self.max_bytes {
-            return Err(CacheError::TooLarge {
-                actual: metadata.len() as usize,
-                max: self.max_bytes,
-            });
+        self.read_inner(key, None)
+    }
+
+    /// Read a snapshot, serving past TTL expiry when the source node's
+    /// current qid version still matches the stored stamp.
+    ///
+    /// Secure9P bumps qid versions on every write, so a matching version
+    /// proves the cached bytes are still current: the TTL stops forcing
+    /// re-fetches of identical payloads and only a real content change (or
+    /// a cache written without a stamp) pays the transfer.
+    pub fn read_revalidated(
+        &self,
+        key: &str,
+        current_version: u32,
+    ) -> Result<SnapshotRecord, CacheError> {
+        self.read_inner(key, Some(current_version))
+    }
+
+    fn read_inner(
+        &self,
+        key: &str,
+        revalidate_version: Option<u32>,
+    ) -> Result<SnapshotRecord, CacheError> {
+        let outcome = self.read_entry(key, revalidate_version);
+        let mut lru = self.lru.lock().expect("cache lru lock");
+        match &outcome {
+            Ok(record) => {
+                lru.stats.hits += 1;
+                let bytes = record.payload.len() as u64;
+                lru.touch(key, bytes, Some(bytes));
+            }
+            Err(_) => {
+                lru.stats.misses += 1;
+            }
         }
+        outcome
+    }
+
+    fn read_entry(
+        &self,
+        key: &str,
+        revalidate_version: Option<u32>,
+    ) -> Result<SnapshotRecord, CacheError> {
+        let path = self.snapshot_path(key)?;
         let bytes = fs::read(&path)?;
         let entry: SnapshotEntry =
             serde_cbor::from_slice(&bytes).map_err(|err| CacheError::Decode(err.to_string()))?;
@@ -154,13 +316,33 @@ impl SnapshotCache {
         }
         let now = now_ms();
         if now > entry.expires_ms {
-            let _ = fs::remove_file(&path);
-            return Err(CacheError::Expired);
+            let revalidated = matches!(
+                (revalidate_version, entry.qid_version),
+                (Some(current), Some(stored)) if current == stored
+            );
+            if !revalidated {
+                let _ = fs::remove_file(&path);
+                self.lru
+                    .lock()
+                    .expect("cache lru lock")
+                    .forget(key, entry.payload_len);
+                return Err(CacheError::Expired);
+            }
+        }
+        if entry.payload_len as usize > self.max_bytes {
+            return Err(CacheError::TooLarge {
+                actual: entry.payload_len as usize,
+                max: self.max_bytes,
+            });
+        }
+        let payload = fs::read(self.blob_path(&entry.blob))?;
+        if payload.len() as u64 != entry.payload_len || hex_digest(&payload) != entry.blob {
+            return Err(CacheError::Decode("blob does not match entry".to_owned()));
         }
         Ok(SnapshotRecord {
             created_ms: entry.created_ms,
             expires_ms: entry.expires_ms,
-            payload: entry.payload,
+            payload,
         })
     }
 
@@ -168,6 +350,22 @@ impl SnapshotCache {
         let key = sanitize_key(key)?;
         Ok(self.root.join(format!("{key}.cbor")))
     }
+
+    fn blob_path(&self, blob: &str) -> PathBuf {
+        self.root.join(BLOB_DIR).join(format!("{blob}.bin"))
+    }
+}
+
+fn hex_digest(payload: &[u8]) -> String {
+    let mut hasher = Sha256::new();
+    hasher.update(payload);
+    let digest = hasher.finalize();
+    let mut out = String::with_capacity(64);
+    for byte in digest {
+        use std::fmt::Write as _;
+        let _ = write!(out, "{byte:02x}");
+    }
+    out
 }
 
 fn sanitize_key(key: &str) -> Result<String, CacheError> {
@@ -4,7 +4,8 @@
 
 #![allow(dead_code)]
 
-pub const MANIFEST_SHA256: &str = "3a20adc55c8f975e20e8ef031422f8a09b4a7b8e524dd052bf69296ddf7ff1af";
+pub const MANIFEST_SHA256: &str =
+    "3a20adc55c8f975e20e8ef031422f8a09b4a7b8e524dd052bf69296ddf7ff1af";
 pub const SECURE9P_MSIZE: u32 = 8192;
 pub const SECURE9P_WALK_DEPTH: u8 = 8;
 pub const SWARMUI_TICKET_SCOPE: &str = "per-ticket";
@@ -25,10 +26,4 @@ pub const SWARMUI_TRACE_MAX_BYTES: u32 = 1048576;
 pub const SWARMUI_TELEMETRY_ROOT: &str = "/worker";
 pub const SWARMUI_PROC_INGEST_ROOT: &str = "/proc/ingest";
 pub const SWARMUI_WORKER_ROOT: &str = "/worker";
-pub const SWARMUI_NAMESPACE_ROOTS: &[&str] = &[
-    "/proc",
-    "/queen",
-    "/worker",
-    "/log",
-    "/gpu",
-];
+pub const SWARMUI_NAMESPACE_ROOTS: &[&str] = &["/proc", "/queen", "/worker", "/log", "/gpu"];
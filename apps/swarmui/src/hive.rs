@@ -133,6 +133,90 @@ pub struct SwarmUiHivePressureCounters {
     pub policy: u64,
 }
 
+/// Delta between two hive snapshots, shipped to the frontend instead of the
+/// whole model so refresh cost tracks the change rate rather than hive size.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct SwarmUiHiveDelta {
+    /// Agents added or whose descriptor changed since the previous snapshot.
+    pub upserted_agents: Vec<SwarmUiHiveAgent>,
+    /// Agent ids no longer present.
+    pub removed_agents: Vec<String>,
+    /// Events with sequence numbers beyond the previous snapshot.
+    pub new_events: Vec<SwarmUiHiveEvent>,
+}
+
+impl SwarmUiHiveDelta {
+    /// True when nothing changed and the frontend can skip the refresh.
+    pub fn is_empty(&self) -> bool {
+        self.upserted_agents.is_empty()
+            && self.removed_agents.is_empty()
+            && self.new_events.is_empty()
+    }
+}
+
+/// Persistent hive model computing per-entity deltas between snapshots.
+#[derive(Debug, Default)]
+pub struct SwarmUiHiveModel {
+    agents: std::collections::BTreeMap<String, SwarmUiHiveAgent>,
+    last_seq: u64,
+}
+
+impl SwarmUiHiveModel {
+    /// Create an empty model.
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Fold a snapshot into the model and return the delta against the
+    /// previously applied state. The first application reports everything
+    /// as upserted, which the frontend treats as the initial render.
+    pub fn apply(&mut self, snapshot: &SwarmUiHiveSnapshot) -> SwarmUiHiveDelta {
+        let mut upserted_agents = Vec::new();
+        let mut seen = std::collections::BTreeSet::new();
+        for agent in &snapshot.agents {
+            seen.insert(agent.id.clone());
+            let changed = match self.agents.get(&agent.id) {
+                Some(existing) => {
+                    existing.role != agent.role || existing.namespace != agent.namespace
+                }
+                None => true,
+            };
+            if changed {
+                self.agents.insert(agent.id.clone(), agent.clone());
+                upserted_agents.push(agent.clone());
+            }
+        }
+        let removed_agents: Vec<String> = self
+            .agents
+            .keys()
+            .filter(|id| !seen.contains(*id))
+            .cloned()
+            .collect();
+        for id in &removed_agents {
+            self.agents.remove(id);
+        }
+        let new_events: Vec<SwarmUiHiveEvent> = snapshot
+            .events
+            .iter()
+            .filter(|event| event.seq > self.last_seq)
+            .cloned()
+            .collect();
+        if let Some(max_seq) = new_events.iter().map(|event| event.seq).max() {
+            self.last_seq = max_seq;
+        }
+        SwarmUiHiveDelta {
+            upserted_agents,
+            removed_agents,
+            new_events,
+        }
+    }
+
+    /// Number of agents currently tracked.
+    pub fn agent_count(&self) -> usize {
+        self.agents.len()
+    }
+}
+
 /// Serialized snapshot used for replay and offline inspection.
 #[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct SwarmUiHiveSnapshot {
@@ -358,15 +442,13 @@ impl HiveSessionState {
                     let fid = client
                         .open(&path, OpenMode::read_only())
                         .map_err(|err| SwarmUiError::Transport(err.to_string()))?;
-                    self.cursors
-                        .entry(worker_id.clone())
-                        .or_insert_with(|| {
-                            HiveTelemetryCursor::new(
-                                &worker_id,
-                                fid,
-                                TailPoller::new(self.tail_policy, None),
-                            )
-                        })
+                    self.cursors.entry(worker_id.clone()).or_insert_with(|| {
+                        HiveTelemetryCursor::new(
+                            &worker_id,
+                            fid,
+                            TailPoller::new(self.tail_policy, None),
+                        )
+                    })
                 }
             };
             cursor.fill_pending(client, msize, budget, now_ms)?;
@@ -377,10 +459,7 @@ impl HiveSessionState {
                 .buffers
                 .remove(&worker_id)
                 .unwrap_or_else(|| BoundedLineBuffer::new(detail_lines, per_worker, line_cap));
-            let role = self
-                .roles
-                .get(&worker_id)
-                .map(|value| value.as_str());
+            let role = self.roles.get(&worker_id).map(|value| value.as_str());
             let consumed = cursor.drain_events(
                 worker_root,
                 &mut self.seq,
@@ -688,10 +767,7 @@ impl ConsoleHiveSessionState {
                 .buffers
                 .remove(&worker_id)
                 .unwrap_or_else(|| BoundedLineBuffer::new(detail_lines, per_worker, line_cap));
-            let role = self
-                .roles
-                .get(&worker_id)
-                .map(|value| value.as_str());
+            let role = self.roles.get(&worker_id).map(|value| value.as_str());
             for line in lines {
                 if budget == 0 {
                     break;
@@ -867,3 +943,149 @@ fn now_ms() -> u64 {
         .unwrap_or_default()
         .as_millis() as u64
 }
+
+/// Number of neighbours warmed around the focused worker.
+pub const PREFETCH_NEIGHBOURS: usize = 4;
+
+/// Compute the speculative warm set for a focused worker.
+///
+/// Browsing moves to list neighbours and same-shard siblings far more often
+/// than random rows, so the warm set is the focused worker's immediate list
+/// neighbours (both directions) topped up with other members of its shard.
+/// The caller warms the `SnapshotCache` for these ids over the idle
+/// transport so opening the next detail panel is served from cache.
+pub fn prefetch_targets(
+    ordered_ids: &[String],
+    focused: &str,
+    shard_of: impl Fn(&str) -> u8,
+) -> Vec<String> {
+    let Some(position) = ordered_ids.iter().position(|id| id == focused) else {
+        return Vec::new();
+    };
+    let mut targets = Vec::with_capacity(PREFETCH_NEIGHBOURS);
+    // Immediate list neighbours first: scrolling momentum dominates.
+    if let Some(next) = ordered_ids.get(position + 1) {
+        push_target(&mut targets, focused, next);
+    }
+    if position > 0 {
+        push_target(&mut targets, focused, &ordered_ids[position - 1]);
+    }
+    // Top up with same-shard siblings (cheap to serve together).
+    let shard = shard_of(focused);
+    for id in ordered_ids {
+        if targets.len() >= PREFETCH_NEIGHBOURS {
+            break;
+        }
+        if shard_of(id) == shard {
+            push_target(&mut targets, focused, id);
+        }
+    }
+    targets
+}
+
+/// Add a warm-set candidate unless it is the focused worker, already
+/// queued, or the set is full.
+fn push_target(targets: &mut Vec<String>, focused: &str, id: &String) {
+    if id != focused && !targets.contains(id) && targets.len() < PREFETCH_NEIGHBOURS {
+        targets.push(id.clone());
+    }
+}
+
+/// Milliseconds per frontend animation frame (60 Hz).
+pub const FRAME_INTERVAL_MS: u64 = 16;
+
+/// Coalesces burst deltas into frame-aligned deliveries.
+///
+/// Telemetry bursts can produce many deltas between frontend frames; the
+/// coalescer merges them so each animation-frame poll hands the webview one
+/// payload carrying all pending diffs, keeping the frontend event loop off
+/// per-update serialization. Agents upserted multiple times collapse to
+/// their newest descriptor; events concatenate in sequence order.
+#[derive(Debug, Default)]
+pub struct FrameCoalescer {
+    pending: Option<SwarmUiHiveDelta>,
+    last_frame_ms: u64,
+}
+
+impl FrameCoalescer {
+    /// Create an empty coalescer.
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Merge a delta into the pending frame payload.
+    pub fn push(&mut self, delta: SwarmUiHiveDelta) {
+        if delta.is_empty() {
+            return;
+        }
+        let pending = self.pending.get_or_insert_with(|| SwarmUiHiveDelta {
+            upserted_agents: Vec::new(),
+            removed_agents: Vec::new(),
+            new_events: Vec::new(),
+        });
+        for agent in delta.upserted_agents {
+            pending.removed_agents.retain(|id| *id != agent.id);
+            match pending
+                .upserted_agents
+                .iter_mut()
+                .find(|existing| existing.id == agent.id)
+            {
+                Some(existing) => *existing = agent,
+                None => pending.upserted_agents.push(agent),
+            }
+        }
+        for removed in delta.removed_agents {
+            pending.upserted_agents.retain(|agent| agent.id != removed);
+            if !pending.removed_agents.contains(&removed) {
+                pending.removed_agents.push(removed);
+            }
+        }
+        pending.new_events.extend(delta.new_events);
+    }
+
+    /// Take the pending payload when a frame boundary has passed; `None`
+    /// when it is not yet time or nothing is pending.
+    pub fn take_frame(&mut self, now_ms: u64) -> Option<SwarmUiHiveDelta> {
+        if self.pending.is_none() || now_ms.saturating_sub(self.last_frame_ms) < FRAME_INTERVAL_MS {
+            return None;
+        }
+        self.last_frame_ms = now_ms;
+        self.pending.take()
+    }
+}
+
+#[cfg(test)]
+mod prefetch_tests {
+    use super::*;
+
+    fn ids(raw: &[&str]) -> Vec<String> {
+        raw.iter().map(|id| (*id).to_owned()).collect()
+    }
+
+    #[test]
+    fn warm_set_orders_neighbours_before_shard_siblings() {
+        let ordered = ids(&["w0", "w1", "w2", "w3", "w4", "w5", "w6"]);
+        // Immediate neighbours of w2 lead (next before previous), then
+        // the focused worker's shard tops the set up in listing order.
+        let shard_of = |id: &str| u8::from(matches!(id, "w2" | "w5" | "w6"));
+        let targets = prefetch_targets(&ordered, "w2", shard_of);
+        assert_eq!(targets, ids(&["w3", "w1", "w5", "w6"]));
+
+        // A neighbour that is also a shard sibling is not queued twice,
+        // and the set never exceeds PREFETCH_NEIGHBOURS.
+        let shard_of = |id: &str| u8::from(matches!(id, "w2" | "w3" | "w4" | "w5" | "w6"));
+        let targets = prefetch_targets(&ordered, "w2", shard_of);
+        assert_eq!(targets, ids(&["w3", "w1", "w4", "w5"]));
+        assert_eq!(targets.len(), PREFETCH_NEIGHBOURS);
+
+        // At the list head only the forward neighbour exists; a shard
+        // with no other members adds nothing and the set stays short.
+        let targets = prefetch_targets(&ordered, "w0", |id| u8::from(id == "w0"));
+        assert_eq!(targets, ids(&["w1"]));
+
+        // Focused worker absent from the listing: nothing to warm.
+        assert!(prefetch_targets(&ordered, "missing", |_| 0).is_empty());
+        // The focused worker itself is never queued.
+        assert!(!prefetch_targets(&ordered, "w2", |_| 0).contains(&"w2".to_owned()));
+    }
+}
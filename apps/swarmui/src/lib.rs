@@ -13,12 +13,15 @@ mod transport;
 
 pub use cache::{CacheError, SnapshotCache, SnapshotRecord};
 pub use hive::{
-    SwarmUiHiveAgent, SwarmUiHiveBatch, SwarmUiHiveBootstrap, SwarmUiHiveConfig, SwarmUiHiveEvent,
-    SwarmUiHiveDetail, SwarmUiHiveEventKind, SwarmUiHiveOverlay, SwarmUiHivePressureCounters,
-    SwarmUiHiveRootStatus,
+    SwarmUiHiveAgent, SwarmUiHiveBatch, SwarmUiHiveBootstrap, SwarmUiHiveConfig, SwarmUiHiveDelta,
+    SwarmUiHiveDetail, SwarmUiHiveEvent, SwarmUiHiveEventKind, SwarmUiHiveModel,
+    SwarmUiHiveOverlay, SwarmUiHivePressureCounters, SwarmUiHiveRootStatus,
     SwarmUiHiveSessionSummary, SwarmUiHiveSnapshot,
 };
-pub use transport::{TcpTransport, TcpTransportError, TcpTransportFactory, TraceTransportFactory};
+pub use transport::{
+    poll_targets_concurrently, PollOutcome, TcpTransport, TcpTransportError, TcpTransportFactory,
+    TraceTransportFactory,
+};
 
 use std::collections::{HashMap, HashSet, VecDeque};
 use std::path::PathBuf;
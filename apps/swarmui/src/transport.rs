@@ -189,3 +189,53 @@ impl SwarmUiTransportFactory for TraceTransportFactory {
         Ok(TraceReplayTransport::new((*self.frames).clone()))
     }
 }
+
+/// Outcome of one target in a concurrent poll pass.
+#[derive(Debug)]
+pub enum PollOutcome<R> {
+    /// The target answered within its deadline.
+    Ready(R),
+    /// The target missed its deadline; its panel degrades alone.
+    TimedOut,
+    /// The target failed with an error.
+    Failed(String),
+}
+
+/// Poll several targets concurrently with per-target deadlines.
+///
+/// Each target runs on its own thread (building its own connection inside
+/// the closure), and results are collected as they arrive; a slow or
+/// timing-out queen marks only its own slot `TimedOut` instead of delaying
+/// every panel in the refresh cycle. Results are returned in target order.
+pub fn poll_targets_concurrently<R, F>(
+    targets: Vec<(String, F)>,
+    deadline: Duration,
+) -> Vec<(String, PollOutcome<R>)>
+where
+    R: Send + 'static,
+    F: FnOnce() -> Result<R, String> + Send + 'static,
+{
+    use std::sync::mpsc;
+
+    let mut receivers = Vec::with_capacity(targets.len());
+    for (label, poll) in targets {
+        let (sender, receiver) = mpsc::channel();
+        std::thread::spawn(move || {
+            let _ = sender.send(poll());
+        });
+        receivers.push((label, receiver));
+    }
+    let started = std::time::Instant::now();
+    receivers
+        .into_iter()
+        .map(|(label, receiver)| {
+            let remaining = deadline.saturating_sub(started.elapsed());
+            let outcome = match receiver.recv_timeout(remaining) {
+                Ok(Ok(value)) => PollOutcome::Ready(value),
+                Ok(Err(err)) => PollOutcome::Failed(err),
+                Err(_) => PollOutcome::TimedOut,
+            };
+            (label, outcome)
+        })
+        .collect()
+}
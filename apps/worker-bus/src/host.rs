@@ -139,3 +139,122 @@ mod tests {
         assert_eq!(worker.session(), SessionId::from_raw(4));
     }
 }
+
+/// Default delivery window before a subscriber queue flushes.
+pub const DELIVERY_WINDOW_FRAMES: usize = 16;
+/// Byte budget per flushed batch (stays inside one Twrite).
+pub const DELIVERY_WINDOW_BYTES: usize = 7 * 1024;
+
+/// One flushed batch: the subscriber path and its framed payload.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct DeliveryBatch {
+    /// Subscriber telemetry path receiving the batch.
+    pub path: String,
+    /// Length-prefixed frames packed into one write payload.
+    pub payload: Vec<u8>,
+    /// Frames carried by the batch.
+    pub frames: usize,
+}
+
+/// Per-subscriber delivery queues flushed as framed batches.
+///
+/// One namespace write per message serialized bursty producers behind a
+/// round trip per frame; queues now accumulate per subscriber and flush a
+/// single length-prefixed batch per window (count, bytes, or explicit
+/// flush), one Twrite instead of N.
+#[derive(Debug, Default)]
+pub struct DeliveryBatcher {
+    queues: std::collections::BTreeMap<String, (Vec<u8>, usize)>,
+}
+
+impl DeliveryBatcher {
+    /// Create an empty batcher.
+    #[must_use]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Queue one message for a subscriber; returns the subscriber's batch
+    /// when its window filled and must flush now.
+    pub fn push(&mut self, subscriber: &str, message: &[u8]) -> Option<DeliveryBatch> {
+        let entry = self
+            .queues
+            .entry(subscriber.to_owned())
+            .or_insert_with(|| (Vec::new(), 0));
+        entry
+            .0
+            .extend_from_slice(&(message.len() as u32).to_le_bytes());
+        entry.0.extend_from_slice(message);
+        entry.1 += 1;
+        if entry.1 >= DELIVERY_WINDOW_FRAMES || entry.0.len() >= DELIVERY_WINDOW_BYTES {
+            return self.take(subscriber);
+        }
+        None
+    }
+
+    /// Flush one subscriber's pending batch.
+    pub fn take(&mut self, subscriber: &str) -> Option<DeliveryBatch> {
+        let (payload, frames) = self.queues.remove(subscriber)?;
+        (frames > 0).then_some(DeliveryBatch {
+            path: subscriber.to_owned(),
+            payload,
+            frames,
+        })
+    }
+
+    /// Flush every pending batch (window timer expiry).
+    pub fn flush_all(&mut self) -> Vec<DeliveryBatch> {
+        let subscribers: Vec<String> = self.queues.keys().cloned().collect();
+        subscribers
+            .into_iter()
+            .filter_map(|subscriber| self.take(&subscriber))
+            .collect()
+    }
+}
+
+/// Split a framed batch payload back into messages (subscriber side).
+pub fn split_delivery_batch(payload: &[u8]) -> Result<Vec<Vec<u8>>> {
+    let mut messages = Vec::new();
+    let mut cursor = 0usize;
+    while cursor < payload.len() {
+        let len_raw = payload
+            .get(cursor..cursor + 4)
+            .ok_or_else(|| anyhow!("truncated batch frame header"))?;
+        let len = u32::from_le_bytes(len_raw.try_into().expect("length is 4 bytes")) as usize;
+        cursor += 4;
+        let body = payload
+            .get(cursor..cursor + len)
+            .ok_or_else(|| anyhow!("truncated batch frame body"))?;
+        messages.push(body.to_vec());
+        cursor += len;
+    }
+    Ok(messages)
+}
+
+#[cfg(test)]
+mod delivery_tests {
+    use super::*;
+
+    #[test]
+    fn windows_flush_on_count_and_roundtrip() {
+        let mut batcher = DeliveryBatcher::new();
+        let mut flushed = None;
+        for index in 0..DELIVERY_WINDOW_FRAMES {
+            let message = format!("completion {index}");
+            flushed = batcher.push("/bus/vision/telemetry", message.as_bytes());
+        }
+        let batch = flushed.expect("window flushes at the frame limit");
+        assert_eq!(batch.frames, DELIVERY_WINDOW_FRAMES);
+        let messages = split_delivery_batch(&batch.payload).expect("split");
+        assert_eq!(messages.len(), DELIVERY_WINDOW_FRAMES);
+        assert_eq!(messages[3], b"completion 3");
+
+        // Partial windows flush on demand; empty flushes vanish.
+        batcher.push("/bus/vision/telemetry", b"tail");
+        let rest = batcher.flush_all();
+        assert_eq!(rest.len(), 1);
+        assert_eq!(rest[0].frames, 1);
+        assert!(batcher.flush_all().is_empty());
+        assert!(split_delivery_batch(&[1, 0]).is_err());
+    }
+}
@@ -378,3 +378,466 @@ mod tests {
         assert!(descriptor.validate().is_err());
     }
 }
+
+/// Maximum jobs in flight before `pump` stops submitting.
+pub const JOB_QUEUE_WINDOW: usize = 4;
+
+/// Completion record surfaced through the status file.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct JobCompletion {
+    /// Identifier of the completed job.
+    pub job: JobId,
+    /// Raw status line reported by the bridge.
+    pub status: String,
+}
+
+/// Asynchronous job queue overlapping staging with execution.
+///
+/// Jobs are staged locally, `pump` releases up to the window into flight
+/// (the caller writes the returned descriptors to the ctl file), and
+/// completions arrive out-of-band from the status file via
+/// `record_completion`. Staging job k+1 therefore overlaps execution of
+/// job k instead of waiting on each round trip.
+#[derive(Debug, Default)]
+pub struct JobQueue {
+    staged: std::collections::VecDeque<JobDescriptor>,
+    in_flight: Vec<JobDescriptor>,
+    completions: std::collections::VecDeque<JobCompletion>,
+}
+
+impl JobQueue {
+    /// Create an empty queue.
+    #[must_use]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Stage a descriptor for submission.
+    pub fn submit(&mut self, descriptor: JobDescriptor) {
+        self.staged.push_back(descriptor);
+    }
+
+    /// Release staged jobs into flight up to the window, returning the
+    /// descriptors the caller must write to the control file.
+    pub fn pump(&mut self) -> Vec<JobDescriptor> {
+        let mut released = Vec::new();
+        while self.in_flight.len() < JOB_QUEUE_WINDOW {
+            let Some(descriptor) = self.staged.pop_front() else {
+                break;
+            };
+            self.in_flight.push(descriptor.clone());
+            released.push(descriptor);
+        }
+        released
+    }
+
+    /// Record an out-of-band completion from the status file. Unknown job
+    /// ids are ignored (stale status lines after a reconnect).
+    pub fn record_completion(&mut self, job: &JobId, status: impl Into<String>) {
+        let Some(position) = self
+            .in_flight
+            .iter()
+            .position(|descriptor| descriptor.job == *job)
+        else {
+            return;
+        };
+        self.in_flight.swap_remove(position);
+        self.completions.push_back(JobCompletion {
+            job: job.clone(),
+            status: status.into(),
+        });
+    }
+
+    /// Next completed job, in completion order.
+    pub fn next_completion(&mut self) -> Option<JobCompletion> {
+        self.completions.pop_front()
+    }
+
+    /// Number of jobs currently executing.
+    #[must_use]
+    pub fn in_flight(&self) -> usize {
+        self.in_flight.len()
+    }
+
+    /// Number of jobs staged but not yet submitted.
+    #[must_use]
+    pub fn staged(&self) -> usize {
+        self.staged.len()
+    }
+}
+
+#[cfg(test)]
+mod job_queue_tests {
+    use super::*;
+
+    fn worker() -> GpuWorker {
+        let lease = GpuLease::new("GPU-0", 1024, 1, 60, 1, "worker-1").unwrap();
+        GpuWorker::new(SessionId::from_raw(1), lease)
+    }
+
+    #[test]
+    fn queue_overlaps_staging_with_flight_window() {
+        let worker = worker();
+        let mut queue = JobQueue::new();
+        for _ in 0..6 {
+            queue.submit(worker.vector_add(&[1.0], &[2.0]).unwrap());
+        }
+        let first = queue.pump();
+        assert_eq!(first.len(), JOB_QUEUE_WINDOW);
+        assert_eq!(queue.staged(), 2);
+        assert!(queue.pump().is_empty(), "window is full");
+
+        queue.record_completion(&first[0].job, "OK");
+        queue.record_completion(&first[1].job, "OK");
+        let refill = queue.pump();
+        assert_eq!(refill.len(), 2);
+        assert_eq!(queue.next_completion().unwrap().job, first[0].job);
+        assert_eq!(queue.next_completion().unwrap().job, first[1].job);
+        assert!(queue.next_completion().is_none());
+        // Stale ids are ignored.
+        queue.record_completion(&JobId::random(), "OK");
+        assert!(queue.next_completion().is_none());
+    }
+}
+
+/// One shard of a split matmul: the rows it owns and its descriptor.
+#[derive(Debug, Clone)]
+pub struct MatmulShard {
+    /// GPU lease executing this shard.
+    pub gpu_id: String,
+    /// Row range `[start, end)` of the output owned by the shard.
+    pub rows: core::ops::Range<usize>,
+    /// Job descriptor for the shard's row slice.
+    pub descriptor: JobDescriptor,
+}
+
+/// Scheduler splitting a sharded matmul across multiple GPU leases.
+///
+/// Rows are partitioned as evenly as the lease count allows, each shard
+/// becomes an independent job (so they run concurrently through the job
+/// queue), and `reassemble` stitches per-shard row blocks back into the
+/// full result in row order.
+#[derive(Debug)]
+pub struct ShardScheduler {
+    workers: Vec<GpuWorker>,
+}
+
+impl ShardScheduler {
+    /// Build a scheduler over one worker per available lease.
+    pub fn new(session: SessionId, leases: Vec<GpuLease>, sharding: ShardingSpec) -> Result<Self> {
+        if leases.is_empty() {
+            return Err(anyhow!("shard scheduler needs at least one lease"));
+        }
+        Ok(Self {
+            workers: leases
+                .into_iter()
+                .map(|lease| GpuWorker::new_with_sharding(session, lease, sharding))
+                .collect(),
+        })
+    }
+
+    /// Split a matmul into per-lease shard jobs over row ranges of `a`.
+    pub fn plan_matmul(
+        &self,
+        a: &[f32],
+        b: &[f32],
+        dims: (usize, usize, usize),
+    ) -> Result<Vec<MatmulShard>> {
+        let (m, k, n) = dims;
+        if a.len() != m * k || b.len() != k * n {
+            return Err(anyhow!("matrix operand dimensions do not match"));
+        }
+        let shards = self.workers.len().min(m.max(1));
+        let base = m / shards;
+        let remainder = m % shards;
+        let mut plan = Vec::with_capacity(shards);
+        let mut row = 0usize;
+        for (index, worker) in self.workers.iter().take(shards).enumerate() {
+            let rows = base + usize::from(index < remainder);
+            let range = row..row + rows;
+            let slice = &a[range.start * k..range.end * k];
+            let descriptor = worker.matmul(slice, b, (rows, k, n))?;
+            plan.push(MatmulShard {
+                gpu_id: worker.lease().gpu_id.clone(),
+                rows: range.clone(),
+                descriptor,
+            });
+            row = range.end;
+        }
+        Ok(plan)
+    }
+
+    /// Reassemble per-shard row blocks (in any completion order) into the
+    /// full `m x n` result.
+    pub fn reassemble(
+        plan: &[MatmulShard],
+        mut shard_outputs: std::collections::BTreeMap<String, Vec<f32>>,
+        n: usize,
+    ) -> Result<Vec<f32>> {
+        let total_rows = plan.iter().map(|shard| shard.rows.len()).sum::<usize>();
+        let mut out = vec![0.0f32; total_rows * n];
+        for shard in plan {
+            let block = shard_outputs
+                .remove(shard.descriptor.job.as_str())
+                .ok_or_else(|| anyhow!("missing output for job {}", shard.descriptor.job))?;
+            if block.len() != shard.rows.len() * n {
+                return Err(anyhow!(
+                    "shard {} returned {} values, expected {}",
+                    shard.descriptor.job,
+                    block.len(),
+                    shard.rows.len() * n
+                ));
+            }
+            out[shard.rows.start * n..shard.rows.end * n].copy_from_slice(&block);
+        }
+        Ok(out)
+    }
+}
+
+#[cfg(test)]
+mod shard_scheduler_tests {
+    use super::*;
+
+    #[test]
+    fn matmul_shards_partition_rows_and_reassemble() {
+        let leases: Vec<GpuLease> = (0..3)
+            .map(|idx| GpuLease::new(format!("GPU-{idx}"), 1024, 1, 60, 1, "worker-1").unwrap())
+            .collect();
+        let scheduler =
+            ShardScheduler::new(SessionId::from_raw(1), leases, ShardingSpec::default()).unwrap();
+        let (m, k, n) = (7usize, 2usize, 2usize);
+        let a: Vec<f32> = (0..m * k).map(|v| v as f32).collect();
+        let b: Vec<f32> = (0..k * n).map(|v| v as f32).collect();
+        let plan = scheduler.plan_matmul(&a, &b, (m, k, n)).unwrap();
+        assert_eq!(plan.len(), 3);
+        assert_eq!(
+            plan.iter()
+                .map(|shard| shard.rows.len())
+                .collect::<Vec<_>>(),
+            vec![3, 2, 2]
+        );
+        assert_eq!(plan[0].rows, 0..3);
+        assert_eq!(plan[2].rows, 5..7);
+
+        // Simulate completions arriving out of order.
+        let mut outputs = std::collections::BTreeMap::new();
+        for shard in plan.iter().rev() {
+            let block: Vec<f32> = (shard.rows.start * n..shard.rows.end * n)
+                .map(|v| v as f32)
+                .collect();
+            outputs.insert(shard.descriptor.job.as_str().to_owned(), block);
+        }
+        let out = ShardScheduler::reassemble(&plan, outputs, n).unwrap();
+        let expected: Vec<f32> = (0..m * n).map(|v| v as f32).collect();
+        assert_eq!(out, expected);
+    }
+}
+
+/// Reasons a job is refused by the admitted-lease fast path.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum LeaseDenied {
+    /// The lease TTL expired; a full ticket re-validation is required.
+    Expired,
+    /// The admitted operation budget is exhausted.
+    OpsExhausted,
+}
+
+/// Precomputed capability check for an admitted lease.
+///
+/// The full ticket parse/verify runs once at admission (and again only on
+/// lease renewal); the per-job path consults this token — a deadline compare
+/// and an op-counter decrement, O(1) — instead of re-parsing claims on every
+/// submission.
+#[derive(Debug, Clone)]
+pub struct AdmittedLease {
+    gpu_id: String,
+    deadline_ms: Option<u64>,
+    ops_remaining: Option<u64>,
+}
+
+impl AdmittedLease {
+    /// Admit a lease against validated ticket claims.
+    pub fn admit(lease: &GpuLease, ticket: &TicketClaims, now_ms: u64) -> Self {
+        Self {
+            gpu_id: lease.gpu_id.clone(),
+            deadline_ms: ticket
+                .budget
+                .ttl_s()
+                .map(|ttl| now_ms.saturating_add(ttl.saturating_mul(1000))),
+            ops_remaining: ticket.budget.ops(),
+        }
+    }
+
+    /// GPU this admission covers.
+    #[must_use]
+    pub fn gpu_id(&self) -> &str {
+        &self.gpu_id
+    }
+
+    /// O(1) per-job check: consume one operation within the admitted window.
+    pub fn check_and_consume(&mut self, now_ms: u64) -> Result<(), LeaseDenied> {
+        if self.deadline_ms.is_some_and(|deadline| now_ms >= deadline) {
+            return Err(LeaseDenied::Expired);
+        }
+        if let Some(remaining) = &mut self.ops_remaining {
+            if *remaining == 0 {
+                return Err(LeaseDenied::OpsExhausted);
+            }
+            *remaining -= 1;
+        }
+        Ok(())
+    }
+}
+
+impl GpuWorker {
+    /// Admit this worker's lease, producing the per-job fast-path token.
+    #[must_use]
+    pub fn admit(&self, now_ms: u64) -> AdmittedLease {
+        AdmittedLease::admit(&self.lease, &self.ticket, now_ms)
+    }
+}
+
+#[cfg(test)]
+mod admitted_lease_tests {
+    use super::*;
+
+    #[test]
+    fn fast_path_enforces_budget_without_reparsing() {
+        let lease = GpuLease::new("GPU-0", 1024, 1, 60, 1, "worker-1").unwrap();
+        let worker = GpuWorker::new(SessionId::from_raw(1), lease);
+        let mut admitted = worker.admit(1_000);
+        let ops = worker.ticket().budget.ops().unwrap();
+        for _ in 0..ops {
+            admitted.check_and_consume(1_001).unwrap();
+        }
+        assert_eq!(
+            admitted.check_and_consume(1_001),
+            Err(LeaseDenied::OpsExhausted)
+        );
+        // A fresh admission past the TTL deadline expires in O(1).
+        let mut admitted = worker.admit(1_000);
+        let ttl_ms = worker.ticket().budget.ttl_s().unwrap() * 1000;
+        assert_eq!(
+            admitted.check_and_consume(1_000 + ttl_ms),
+            Err(LeaseDenied::Expired)
+        );
+    }
+}
+
+/// Slab handle for a registered job: index plus generation so a recycled
+/// slot can never be confused with the job that previously owned it.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct JobHandle {
+    index: u32,
+    generation: u32,
+}
+
+#[derive(Debug)]
+struct JobSlot {
+    generation: u32,
+    entry: Option<JobDescriptor>,
+}
+
+/// Slab-allocated job registry with O(1) handle lookup.
+///
+/// The hot status path works entirely in integer handles — no string
+/// allocation or hashing per poll; the operator-facing string id stays on
+/// the descriptor and is only rendered at the namespace edge.
+#[derive(Debug, Default)]
+pub struct JobRegistry {
+    slots: Vec<JobSlot>,
+    free: Vec<u32>,
+    live: usize,
+}
+
+impl JobRegistry {
+    /// Create an empty registry.
+    #[must_use]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Register a job, returning its handle.
+    pub fn insert(&mut self, descriptor: JobDescriptor) -> JobHandle {
+        self.live += 1;
+        if let Some(index) = self.free.pop() {
+            let slot = &mut self.slots[index as usize];
+            slot.entry = Some(descriptor);
+            return JobHandle {
+                index,
+                generation: slot.generation,
+            };
+        }
+        let index = self.slots.len() as u32;
+        self.slots.push(JobSlot {
+            generation: 0,
+            entry: Some(descriptor),
+        });
+        JobHandle {
+            index,
+            generation: 0,
+        }
+    }
+
+    /// O(1) lookup; `None` for stale or never-issued handles.
+    #[must_use]
+    pub fn get(&self, handle: JobHandle) -> Option<&JobDescriptor> {
+        let slot = self.slots.get(handle.index as usize)?;
+        (slot.generation == handle.generation)
+            .then_some(slot.entry.as_ref())
+            .flatten()
+    }
+
+    /// Remove a job, recycling its slot under a new generation.
+    pub fn remove(&mut self, handle: JobHandle) -> Option<JobDescriptor> {
+        let slot = self.slots.get_mut(handle.index as usize)?;
+        if slot.generation != handle.generation {
+            return None;
+        }
+        let entry = slot.entry.take()?;
+        slot.generation = slot.generation.wrapping_add(1);
+        self.free.push(handle.index);
+        self.live -= 1;
+        Some(entry)
+    }
+
+    /// Operator-facing string id, rendered only at the namespace edge.
+    #[must_use]
+    pub fn operator_id(&self, handle: JobHandle) -> Option<&str> {
+        self.get(handle).map(|descriptor| descriptor.job.as_str())
+    }
+
+    /// Number of live jobs.
+    #[must_use]
+    pub fn live(&self) -> usize {
+        self.live
+    }
+}
+
+#[cfg(test)]
+mod job_registry_tests {
+    use super::*;
+
+    #[test]
+    fn handles_are_o1_and_generation_safe() {
+        let lease = GpuLease::new("GPU-0", 1024, 1, 60, 1, "worker-1").unwrap();
+        let worker = GpuWorker::new(SessionId::from_raw(1), lease);
+        let mut registry = JobRegistry::new();
+        let a = registry.insert(worker.vector_add(&[1.0], &[2.0]).unwrap());
+        let b = registry.insert(worker.vector_add(&[3.0], &[4.0]).unwrap());
+        assert_eq!(registry.live(), 2);
+        assert!(registry.operator_id(a).unwrap().starts_with("job-"));
+
+        let removed = registry.remove(a).unwrap();
+        assert!(registry.get(a).is_none(), "stale handle must miss");
+        assert!(registry.remove(a).is_none());
+
+        // The slot recycles under a new generation; the old handle stays dead.
+        let c = registry.insert(removed);
+        assert_eq!(c.index, a.index);
+        assert_ne!(c.generation, a.generation);
+        assert!(registry.get(a).is_none());
+        assert!(registry.get(c).is_some());
+        assert!(registry.get(b).is_some());
+    }
+}
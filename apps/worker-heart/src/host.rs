@@ -57,6 +57,79 @@ impl HeartbeatWorker {
     pub fn emit(&self, tick: u64) -> Result<String> {
         Ok(format!("heartbeat {tick}"))
     }
+
+    /// Encode one heartbeat as a fixed-size binary record.
+    #[must_use]
+    pub fn emit_binary(&self, tick: u64) -> [u8; HEARTBEAT_RECORD_BYTES] {
+        let mut record = [0u8; HEARTBEAT_RECORD_BYTES];
+        record[0..2].copy_from_slice(HEARTBEAT_MAGIC);
+        record[2] = HEARTBEAT_VERSION;
+        record[8..16].copy_from_slice(&tick.to_le_bytes());
+        record[16..24].copy_from_slice(&unix_time_ms().to_le_bytes());
+        record
+    }
+
+    /// Coalesce several ticks into one payload for a single Twrite.
+    ///
+    /// At 1 Hz per worker the queen pays one small message per worker per
+    /// second; batching a few ticks (when the latency budget allows) divides
+    /// that load by the batch size while the fixed record layout keeps the
+    /// freshness parse allocation-free.
+    #[must_use]
+    pub fn emit_batch(&self, ticks: &[u64]) -> Vec<u8> {
+        let mut payload = Vec::with_capacity(ticks.len() * HEARTBEAT_RECORD_BYTES);
+        for &tick in ticks {
+            payload.extend_from_slice(&self.emit_binary(tick));
+        }
+        payload
+    }
+}
+
+/// Magic prefix for binary heartbeat records.
+pub const HEARTBEAT_MAGIC: &[u8; 2] = b"HB";
+/// Binary heartbeat format version.
+pub const HEARTBEAT_VERSION: u8 = 1;
+/// Fixed record size: magic(2) version(1) pad(5) tick(8) stamp_ms(8).
+pub const HEARTBEAT_RECORD_BYTES: usize = 24;
+
+/// One decoded heartbeat record.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct HeartbeatRecord {
+    /// Monotonic tick counter from the worker.
+    pub tick: u64,
+    /// Worker wall-clock stamp in Unix milliseconds.
+    pub stamp_ms: u64,
+}
+
+/// Decode a coalesced heartbeat batch, rejecting foreign or torn payloads.
+pub fn decode_heartbeat_batch(payload: &[u8]) -> Result<Vec<HeartbeatRecord>> {
+    if payload.len() % HEARTBEAT_RECORD_BYTES != 0 {
+        anyhow::bail!(
+            "heartbeat batch length {} is not record aligned",
+            payload.len()
+        );
+    }
+    let mut records = Vec::with_capacity(payload.len() / HEARTBEAT_RECORD_BYTES);
+    for chunk in payload.chunks_exact(HEARTBEAT_RECORD_BYTES) {
+        if &chunk[0..2] != HEARTBEAT_MAGIC {
+            anyhow::bail!("heartbeat record has bad magic");
+        }
+        if chunk[2] != HEARTBEAT_VERSION {
+            anyhow::bail!("unsupported heartbeat version {}", chunk[2]);
+        }
+        records.push(HeartbeatRecord {
+            tick: u64::from_le_bytes(chunk[8..16].try_into().expect("record aligned")),
+            stamp_ms: u64::from_le_bytes(chunk[16..24].try_into().expect("record aligned")),
+        });
+    }
+    Ok(records)
+}
+
+/// Queen-side freshness check: the newest record in a coalesced batch.
+pub fn latest_heartbeat(payload: &[u8]) -> Result<Option<HeartbeatRecord>> {
+    Ok(decode_heartbeat_batch(payload)?
+        .into_iter()
+        .max_by_key(|record| record.tick))
 }
 
 fn unix_time_ms() -> u64 {
@@ -70,6 +143,23 @@ fn unix_time_ms() -> u64 {
 mod tests {
     use super::*;
 
+    #[test]
+    fn binary_batches_roundtrip_and_report_freshness() {
+        let worker = HeartbeatWorker::new(SessionId::from_raw(1));
+        let payload = worker.emit_batch(&[5, 6, 7]);
+        assert_eq!(payload.len(), 3 * HEARTBEAT_RECORD_BYTES);
+        let records = decode_heartbeat_batch(&payload).unwrap();
+        assert_eq!(records.len(), 3);
+        assert_eq!(records[2].tick, 7);
+        let latest = latest_heartbeat(&payload).unwrap().unwrap();
+        assert_eq!(latest.tick, 7);
+        assert!(latest.stamp_ms > 0);
+        assert!(decode_heartbeat_batch(&payload[..HEARTBEAT_RECORD_BYTES - 1]).is_err());
+        let mut bad = payload.clone();
+        bad[0] = b'X';
+        assert!(decode_heartbeat_batch(&bad).is_err());
+    }
+
     #[test]
     fn heartbeat_payload_includes_tick() {
         let worker = HeartbeatWorker::new(SessionId::from_raw(7));
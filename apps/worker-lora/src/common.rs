@@ -37,6 +37,8 @@ pub enum TamperReason {
     PayloadOversize,
     /// Duty-cycle budget exceeded.
     DutyCycleExceeded,
+    /// Frame failed structural validation.
+    MalformedFrame,
 }
 
 /// Tamper log entry captured on denial.
@@ -128,3 +130,147 @@ impl DutyCycleGuard {
         Ok(())
     }
 }
+
+/// Encoding label advertised for packed step telemetry.
+pub const PACKED_STEPS_ENCODING: &str = "lora-packed-fp16/v1";
+/// Magic prefix for packed step records.
+pub const PACKED_STEPS_MAGIC: &[u8; 2] = b"LP";
+/// Packed record format version.
+pub const PACKED_STEPS_VERSION: u8 = 1;
+
+/// Convert an `f32` to IEEE 754 half precision with round-to-nearest-even.
+#[must_use]
+pub fn f32_to_f16_bits(value: f32) -> u16 {
+    let bits = value.to_bits();
+    let sign = ((bits >> 16) & 0x8000) as u16;
+    let exponent = ((bits >> 23) & 0xff) as i32;
+    let mantissa = bits & 0x007f_ffff;
+    if exponent == 0xff {
+        // Infinity / NaN: preserve the class, keep a mantissa bit for NaN.
+        let nan_bit = if mantissa != 0 { 0x0200 } else { 0 };
+        return sign | 0x7c00 | nan_bit;
+    }
+    let unbiased = exponent - 127;
+    if unbiased > 15 {
+        return sign | 0x7c00; // overflow → infinity
+    }
+    if unbiased >= -14 {
+        // Normal half: round mantissa from 23 to 10 bits.
+        let half = ((unbiased + 15) as u16) << 10 | (mantissa >> 13) as u16;
+        let round = mantissa & 0x1fff;
+        let tie = (round == 0x1000) && (half & 1 == 0);
+        if round > 0x1000 || (round == 0x1000 && !tie) {
+            return sign | half.wrapping_add(1);
+        }
+        return sign | half;
+    }
+    if unbiased >= -24 {
+        // Subnormal half.
+        let shift = (-1 - unbiased) as u32 + 9;
+        let full = mantissa | 0x0080_0000;
+        let half = (full >> (shift + 1)) as u16;
+        let round = full & ((1 << (shift + 1)) - 1);
+        if round > (1 << shift) || (round == (1 << shift) && half & 1 == 1) {
+            return sign | half.wrapping_add(1);
+        }
+        return sign | half;
+    }
+    sign // underflow → signed zero
+}
+
+/// Convert IEEE 754 half-precision bits back to `f32`.
+#[must_use]
+pub fn f16_bits_to_f32(bits: u16) -> f32 {
+    let sign = u32::from(bits & 0x8000) << 16;
+    let exponent = (bits >> 10) & 0x1f;
+    let mantissa = u32::from(bits & 0x03ff);
+    let out = match exponent {
+        0 => {
+            if mantissa == 0 {
+                sign
+            } else {
+                // Subnormal half → normalised f32.
+                let shift = mantissa.leading_zeros() - 21;
+                let mantissa = (mantissa << (shift + 1)) & 0x03ff;
+                let exponent = (113 - shift - 1) << 23;
+                sign | exponent | (mantissa << 13)
+            }
+        }
+        0x1f => sign | 0x7f80_0000 | (mantissa << 13),
+        _ => sign | ((u32::from(exponent) + 112) << 23) | (mantissa << 13),
+    };
+    f32::from_bits(out)
+}
+
+/// Pack a run of step metrics as half-precision halves.
+///
+/// Layout: magic `LP`, version, pad, count (u16 LE), then one u16 half per
+/// value — roughly an 8x byte cut against the decimal-text lines for loss
+/// curves, which tolerate half precision comfortably.
+#[must_use]
+pub fn pack_steps(values: &[f32]) -> Vec<u8> {
+    let count = values.len().min(u16::MAX as usize);
+    let mut out = Vec::with_capacity(6 + count * 2);
+    out.extend_from_slice(PACKED_STEPS_MAGIC);
+    out.push(PACKED_STEPS_VERSION);
+    out.push(0);
+    out.extend_from_slice(&(count as u16).to_le_bytes());
+    for value in &values[..count] {
+        out.extend_from_slice(&f32_to_f16_bits(*value).to_le_bytes());
+    }
+    out
+}
+
+/// Unpack a record produced by [`pack_steps`].
+pub fn unpack_steps(payload: &[u8]) -> Result<Vec<f32>, TamperReason> {
+    if payload.len() < 6
+        || &payload[0..2] != PACKED_STEPS_MAGIC
+        || payload[2] != PACKED_STEPS_VERSION
+    {
+        return Err(TamperReason::MalformedFrame);
+    }
+    let count = usize::from(u16::from_le_bytes([payload[4], payload[5]]));
+    let body = &payload[6..];
+    if body.len() != count * 2 {
+        return Err(TamperReason::MalformedFrame);
+    }
+    Ok(body
+        .chunks_exact(2)
+        .map(|pair| f16_bits_to_f32(u16::from_le_bytes([pair[0], pair[1]])))
+        .collect())
+}
+
+#[cfg(test)]
+mod packed_steps_tests {
+    use super::*;
+
+    #[test]
+    fn halves_roundtrip_with_loss_curve_tolerance() {
+        let steps: Vec<f32> = (0..64)
+            .map(|idx| 2.5_f32 * (-0.05 * idx as f32).exp())
+            .collect();
+        let packed = pack_steps(&steps);
+        // ~8x smaller than the decimal text encoding of the same values.
+        let text_len: usize = steps.iter().map(|v| format!("{v:.9}\n").len()).sum();
+        assert!(packed.len() * 4 < text_len);
+        let restored = unpack_steps(&packed).unwrap();
+        assert_eq!(restored.len(), steps.len());
+        for (orig, round) in steps.iter().zip(&restored) {
+            assert!((orig - round).abs() <= orig.abs() * 0.001 + 1e-4);
+        }
+    }
+
+    #[test]
+    fn special_values_and_malformed_frames() {
+        let specials = [0.0_f32, -0.0, f32::INFINITY, f32::NEG_INFINITY, 65504.0];
+        let restored = unpack_steps(&pack_steps(&specials)).unwrap();
+        assert_eq!(restored[0].to_bits(), 0.0_f32.to_bits());
+        assert_eq!(restored[1].to_bits(), (-0.0_f32).to_bits());
+        assert_eq!(restored[2], f32::INFINITY);
+        assert_eq!(restored[3], f32::NEG_INFINITY);
+        assert_eq!(restored[4], 65504.0);
+        assert!(f16_bits_to_f32(f32_to_f16_bits(f32::NAN)).is_nan());
+        assert!(unpack_steps(b"XX").is_err());
+        assert!(unpack_steps(&pack_steps(&specials)[..7]).is_err());
+    }
+}
@@ -2,10 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 // Purpose: Defines the uefi-elfloader-shim library and public module surface.
 // Author: Lukas Bower
-#![doc = r"Helper crate that anchors documentation for the UEFI elfloader packaging.\n\n\
-This crate intentionally exposes no runtime APIs. It exists so the Cargo\nworkspace can track the shim that documents how the seL4 elfloader is\nrebuilt as a UEFI application and bundled into the Cohesix ESP image."]
+#![doc = r"Helper crate anchoring the UEFI elfloader packaging contract.
+
+Besides documenting how the seL4 elfloader is rebuilt as a UEFI application
+and bundled into the Cohesix ESP image, it defines the warm-boot
+measurement record both sides of the boot chain share."]
 #![no_std]
 
+pub mod warm_boot;
+
+pub use warm_boot::{WarmBootDecision, WarmBootRecord, WARM_BOOT_RECORD_BYTES};
+
 /// Marker type ensuring the crate is not considered empty by lint
 /// configurations that flag packages without public items.
 #[allow(dead_code)]
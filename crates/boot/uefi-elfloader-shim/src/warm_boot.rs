@@ -0,0 +1,159 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Define the sealed warm-boot payload measurement record.
+// Author: Lukas Bower
+
+//! Warm-boot measurement protocol shared by the UEFI shim and elfloader.
+//!
+//! On a controlled reboot the shim seals a measurement of the in-RAM boot
+//! payload into a well-known record. On the next boot it re-reads the
+//! record: when the seal is intact and the stored digest matches the
+//! payload manifest's expected digest, the re-hash and re-copy of an
+//! unchanged image are skipped, taking controlled restart from seconds to
+//! sub-second. Any mismatch, torn write, or power-loss boot falls back to
+//! the full cold-boot verification path.
+
+/// Magic tag marking a sealed warm-boot record ("C9WB" + version nibble).
+pub const WARM_BOOT_MAGIC: u32 = 0x4339_5742;
+
+/// Protocol version understood by this shim build.
+pub const WARM_BOOT_VERSION: u16 = 1;
+
+/// Size of the serialized record in bytes.
+pub const WARM_BOOT_RECORD_BYTES: usize = 56;
+
+/// Outcome of validating a warm-boot record against the expected payload.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum WarmBootDecision {
+    /// Record is sealed and matches: skip re-hash and re-copy.
+    SkipVerification,
+    /// No record or an unsealed/torn record: cold-boot verification.
+    ColdBoot,
+    /// Record is intact but the payload changed: cold boot and reseal.
+    PayloadChanged,
+}
+
+/// Sealed measurement of the in-RAM boot payload.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct WarmBootRecord {
+    /// Payload length in bytes at seal time.
+    pub payload_len: u64,
+    /// Digest of the payload (SHA-256) at seal time.
+    pub digest: [u8; 32],
+    /// Monotonic controlled-reboot counter.
+    pub boot_count: u32,
+}
+
+impl WarmBootRecord {
+    /// Serialize the record with its seal into `out`.
+    ///
+    /// Layout: magic(4) version(2) reserved(2) payload_len(8) digest(32)
+    /// boot_count(4) checksum(4), all little endian. The checksum seals the
+    /// record against torn writes; it is not a security boundary — the
+    /// digest comparison against the signed manifest is.
+    pub fn seal_into(&self, out: &mut [u8; WARM_BOOT_RECORD_BYTES]) {
+        out[0..4].copy_from_slice(&WARM_BOOT_MAGIC.to_le_bytes());
+        out[4..6].copy_from_slice(&WARM_BOOT_VERSION.to_le_bytes());
+        out[6..8].copy_from_slice(&[0u8; 2]);
+        out[8..16].copy_from_slice(&self.payload_len.to_le_bytes());
+        out[16..48].copy_from_slice(&self.digest);
+        out[48..52].copy_from_slice(&self.boot_count.to_le_bytes());
+        let checksum = fnv1a32(&out[..52]);
+        out[52..56].copy_from_slice(&checksum.to_le_bytes());
+    }
+
+    /// Parse a sealed record, returning `None` for missing, foreign,
+    /// newer-versioned, or torn records.
+    #[must_use]
+    pub fn unseal(raw: &[u8; WARM_BOOT_RECORD_BYTES]) -> Option<Self> {
+        let magic = u32::from_le_bytes([raw[0], raw[1], raw[2], raw[3]]);
+        if magic != WARM_BOOT_MAGIC {
+            return None;
+        }
+        let version = u16::from_le_bytes([raw[4], raw[5]]);
+        if version != WARM_BOOT_VERSION {
+            return None;
+        }
+        let stored = u32::from_le_bytes([raw[52], raw[53], raw[54], raw[55]]);
+        if stored != fnv1a32(&raw[..52]) {
+            return None;
+        }
+        let mut digest = [0u8; 32];
+        digest.copy_from_slice(&raw[16..48]);
+        Some(Self {
+            payload_len: u64::from_le_bytes(raw[8..16].try_into().ok()?),
+            digest,
+            boot_count: u32::from_le_bytes(raw[48..52].try_into().ok()?),
+        })
+    }
+
+    /// Decide the boot path for this record against the expected payload.
+    #[must_use]
+    pub fn decide(
+        record: Option<&Self>,
+        expected_len: u64,
+        expected_digest: &[u8; 32],
+    ) -> WarmBootDecision {
+        match record {
+            None => WarmBootDecision::ColdBoot,
+            Some(sealed)
+                if sealed.payload_len == expected_len && &sealed.digest == expected_digest =>
+            {
+                WarmBootDecision::SkipVerification
+            }
+            Some(_) => WarmBootDecision::PayloadChanged,
+        }
+    }
+}
+
+fn fnv1a32(bytes: &[u8]) -> u32 {
+    let mut hash: u32 = 0x811c_9dc5;
+    for &byte in bytes {
+        hash ^= u32::from(byte);
+        hash = hash.wrapping_mul(0x0100_0193);
+    }
+    hash
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn record() -> WarmBootRecord {
+        WarmBootRecord {
+            payload_len: 3_145_728,
+            digest: [0xa5; 32],
+            boot_count: 7,
+        }
+    }
+
+    #[test]
+    fn seal_roundtrip_and_decision() {
+        let mut raw = [0u8; WARM_BOOT_RECORD_BYTES];
+        record().seal_into(&mut raw);
+        let sealed = WarmBootRecord::unseal(&raw).expect("intact seal");
+        assert_eq!(sealed, record());
+        assert_eq!(
+            WarmBootRecord::decide(Some(&sealed), 3_145_728, &[0xa5; 32]),
+            WarmBootDecision::SkipVerification
+        );
+        assert_eq!(
+            WarmBootRecord::decide(Some(&sealed), 3_145_728, &[0x5a; 32]),
+            WarmBootDecision::PayloadChanged
+        );
+        assert_eq!(
+            WarmBootRecord::decide(None, 3_145_728, &[0xa5; 32]),
+            WarmBootDecision::ColdBoot
+        );
+    }
+
+    #[test]
+    fn torn_records_fall_back_to_cold_boot() {
+        let mut raw = [0u8; WARM_BOOT_RECORD_BYTES];
+        record().seal_into(&mut raw);
+        raw[20] ^= 0xff;
+        assert!(WarmBootRecord::unseal(&raw).is_none());
+        let blank = [0u8; WARM_BOOT_RECORD_BYTES];
+        assert!(WarmBootRecord::unseal(&blank).is_none());
+    }
+}
@@ -0,0 +1,118 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Content-defined chunk boundary selection for CAS payloads.
+// Author: Lukas Bower
+
+//! FastCDC-style content-defined chunking.
+//!
+//! Boundaries are picked where a rolling gear hash matches a mask, so an
+//! insertion early in a payload only shifts the chunks it touches —
+//! consecutive LoRA checkpoints that overlap byte-wise dedup chunk-for-chunk
+//! across versions. The gear table is derived deterministically so every
+//! component chunks identically.
+
+use alloc::vec::Vec;
+use core::ops::Range;
+
+/// Minimum chunk size in bytes.
+pub const MIN_CHUNK_BYTES: usize = 16 * 1024;
+/// Target average chunk size in bytes (mask with 18 bits ≈ 256 KiB).
+pub const AVG_CHUNK_BYTES: usize = 256 * 1024;
+/// Maximum chunk size in bytes.
+pub const MAX_CHUNK_BYTES: usize = 1024 * 1024;
+
+const BOUNDARY_MASK: u64 = (1 << 18) - 1;
+
+/// Deterministic gear table (splitmix64 over the byte value).
+fn gear(byte: u8) -> u64 {
+    let mut x = u64::from(byte).wrapping_add(0x9e37_79b9_7f4a_7c15);
+    x = (x ^ (x >> 30)).wrapping_mul(0xbf58_476d_1ce4_e5b9);
+    x = (x ^ (x >> 27)).wrapping_mul(0x94d0_49bb_1331_11eb);
+    x ^ (x >> 31)
+}
+
+/// Split `data` into content-defined chunk ranges.
+///
+/// Every byte belongs to exactly one range; ranges respect the min/avg/max
+/// bounds with the final chunk allowed below the minimum.
+#[must_use]
+pub fn chunk_ranges(data: &[u8]) -> Vec<Range<usize>> {
+    let mut ranges = Vec::new();
+    let mut start = 0usize;
+    while start < data.len() {
+        let remaining = data.len() - start;
+        if remaining <= MIN_CHUNK_BYTES {
+            ranges.push(start..data.len());
+            break;
+        }
+        let limit = remaining.min(MAX_CHUNK_BYTES);
+        let mut hash = 0u64;
+        let mut cut = limit;
+        for (index, &byte) in data[start..start + limit].iter().enumerate() {
+            hash = (hash << 1).wrapping_add(gear(byte));
+            if index >= MIN_CHUNK_BYTES && hash & BOUNDARY_MASK == 0 {
+                cut = index + 1;
+                break;
+            }
+        }
+        ranges.push(start..start + cut);
+        start += cut;
+    }
+    ranges
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use alloc::vec;
+
+    fn pseudo_random(len: usize, seed: u64) -> Vec<u8> {
+        let mut state = seed;
+        (0..len)
+            .map(|_| {
+                state = state
+                    .wrapping_mul(6364136223846793005)
+                    .wrapping_add(1442695040888963407);
+                (state >> 56) as u8
+            })
+            .collect()
+    }
+
+    #[test]
+    fn chunks_cover_payload_within_bounds() {
+        let data = pseudo_random(4 * MAX_CHUNK_BYTES, 7);
+        let ranges = chunk_ranges(&data);
+        assert!(ranges.len() >= 4);
+        let mut cursor = 0usize;
+        for (idx, range) in ranges.iter().enumerate() {
+            assert_eq!(range.start, cursor);
+            cursor = range.end;
+            if idx + 1 != ranges.len() {
+                assert!(range.len() >= MIN_CHUNK_BYTES);
+            }
+            assert!(range.len() <= MAX_CHUNK_BYTES);
+        }
+        assert_eq!(cursor, data.len());
+    }
+
+    #[test]
+    fn insertions_only_shift_local_chunks() {
+        let base = pseudo_random(8 * AVG_CHUNK_BYTES, 42);
+        let mut edited = base.clone();
+        // 2% edit near the front.
+        edited.splice(1000..1000, vec![0xEE; base.len() / 50]);
+        let base_ranges = chunk_ranges(&base);
+        let edited_ranges = chunk_ranges(&edited);
+        let base_chunks: alloc::collections::BTreeSet<&[u8]> =
+            base_ranges.iter().map(|r| &base[r.clone()]).collect();
+        let shared = edited_ranges
+            .iter()
+            .filter(|r| base_chunks.contains(&edited[(*r).clone()]))
+            .count();
+        assert!(
+            shared * 2 > edited_ranges.len(),
+            "expected most chunks unchanged: {shared}/{}",
+            edited_ranges.len()
+        );
+    }
+}
@@ -0,0 +1,217 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Plan and apply chunk-level deltas between CAS manifests.
+// Author: Lukas Bower
+
+//! Chunk-level delta planning and application.
+//!
+//! Given a base and a target manifest, the plan lists for every target chunk
+//! whether it can be reused from the base (matched by digest) or must be
+//! fetched, so updating a mostly-overlapping model on a bandwidth-starved
+//! worker transfers only the changed chunks. Application assembles the
+//! target payload from the base payload plus the fetched chunks and verifies
+//! it chunk-by-chunk through the streaming verifier.
+
+use alloc::collections::BTreeMap;
+use alloc::vec::Vec;
+
+use crate::stream::{StreamVerifyError, StreamingVerifier};
+use crate::CasManifest;
+
+/// One target chunk's provenance in a delta plan.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum ChunkSource {
+    /// Reuse the base chunk at this index (identical digest).
+    Base {
+        /// Chunk index within the base manifest.
+        index: usize,
+    },
+    /// Fetch the chunk from the distribution point.
+    Fetch,
+}
+
+/// Delta plan: one entry per target chunk, in target order.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct DeltaPlan {
+    /// Per-target-chunk provenance.
+    pub sources: Vec<ChunkSource>,
+    /// Bytes satisfied from the base payload.
+    pub reused_bytes: u64,
+    /// Bytes that must be transferred.
+    pub fetch_bytes: u64,
+}
+
+fn chunk_len(manifest: &CasManifest, index: usize) -> u64 {
+    match &manifest.chunk_lens {
+        Some(lens) => lens.get(index).map(|len| u64::from(*len)).unwrap_or(0),
+        None => {
+            let chunk = u64::from(manifest.chunk_bytes);
+            let start = index as u64 * chunk;
+            chunk.min(manifest.payload_bytes.saturating_sub(start))
+        }
+    }
+}
+
+fn chunk_range(manifest: &CasManifest, index: usize) -> (u64, u64) {
+    match &manifest.chunk_lens {
+        Some(lens) => {
+            let start: u64 = lens[..index].iter().map(|len| u64::from(*len)).sum();
+            (start, u64::from(lens[index]))
+        }
+        None => {
+            let chunk = u64::from(manifest.chunk_bytes);
+            let start = index as u64 * chunk;
+            (start, chunk.min(manifest.payload_bytes.saturating_sub(start)))
+        }
+    }
+}
+
+/// Plan the minimal chunk patch set taking `base` to `target`.
+#[must_use]
+pub fn plan_delta(base: &CasManifest, target: &CasManifest) -> DeltaPlan {
+    let mut base_index: BTreeMap<&[u8; 32], usize> = BTreeMap::new();
+    for (index, digest) in base.chunks.iter().enumerate() {
+        base_index.entry(digest).or_insert(index);
+    }
+    let mut sources = Vec::with_capacity(target.chunks.len());
+    let mut reused_bytes = 0u64;
+    let mut fetch_bytes = 0u64;
+    for (index, digest) in target.chunks.iter().enumerate() {
+        let len = chunk_len(target, index);
+        // A digest match only counts as reusable when the lengths agree
+        // (they always do for equal digests unless a manifest lies; the
+        // streaming verifier catches that on apply).
+        match base_index.get(digest) {
+            Some(base_idx) if chunk_len(base, *base_idx) == len => {
+                reused_bytes += len;
+                sources.push(ChunkSource::Base { index: *base_idx });
+            }
+            _ => {
+                fetch_bytes += len;
+                sources.push(ChunkSource::Fetch);
+            }
+        }
+    }
+    DeltaPlan {
+        sources,
+        reused_bytes,
+        fetch_bytes,
+    }
+}
+
+/// Errors raised while applying a delta plan.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum DeltaApplyError {
+    /// A fetched chunk required by the plan was missing.
+    MissingChunk {
+        /// Target chunk index without a fetched payload.
+        index: usize,
+    },
+    /// The base payload was shorter than a reused chunk range.
+    BaseOutOfRange,
+    /// Verification failed while assembling.
+    Verify(StreamVerifyError),
+}
+
+/// Assemble and verify the target payload from the base payload plus the
+/// fetched chunks (keyed by target chunk index).
+pub fn apply_delta(
+    plan: &DeltaPlan,
+    base: &CasManifest,
+    target: &CasManifest,
+    base_payload: &[u8],
+    fetched: &BTreeMap<usize, Vec<u8>>,
+) -> Result<Vec<u8>, DeltaApplyError> {
+    let mut out = Vec::with_capacity(target.payload_bytes as usize);
+    let mut verifier = StreamingVerifier::new(target);
+    for (index, source) in plan.sources.iter().enumerate() {
+        let chunk: &[u8] = match source {
+            ChunkSource::Base { index: base_idx } => {
+                let (start, len) = chunk_range(base, *base_idx);
+                base_payload
+                    .get(start as usize..(start + len) as usize)
+                    .ok_or(DeltaApplyError::BaseOutOfRange)?
+            }
+            ChunkSource::Fetch => fetched
+                .get(&index)
+                .map(Vec::as_slice)
+                .ok_or(DeltaApplyError::MissingChunk { index })?,
+        };
+        verifier.push_chunk(chunk).map_err(DeltaApplyError::Verify)?;
+        out.extend_from_slice(chunk);
+    }
+    verifier.finish().map_err(DeltaApplyError::Verify)?;
+    Ok(out)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::CAS_MANIFEST_SCHEMA;
+    use alloc::borrow::ToOwned;
+    use sha2::{Digest, Sha256};
+
+    fn manifest_for(payload: &[u8], chunk_bytes: u32, epoch: &str) -> CasManifest {
+        let chunks: Vec<[u8; 32]> = payload
+            .chunks(chunk_bytes as usize)
+            .map(|chunk| {
+                let mut out = [0u8; 32];
+                out.copy_from_slice(&Sha256::digest(chunk));
+                out
+            })
+            .collect();
+        let mut payload_sha256 = [0u8; 32];
+        payload_sha256.copy_from_slice(&Sha256::digest(payload));
+        CasManifest {
+            schema: CAS_MANIFEST_SCHEMA.to_owned(),
+            epoch: epoch.to_owned(),
+            chunk_bytes,
+            payload_bytes: payload.len() as u64,
+            payload_sha256,
+            chunks,
+            chunk_lens: None,
+            delta: None,
+            signature: None,
+        }
+    }
+
+    #[test]
+    fn overlapping_versions_fetch_only_changed_chunks() {
+        let base_payload: Vec<u8> = (0..32_768u32).map(|i| (i % 199) as u8).collect();
+        let mut target_payload = base_payload.clone();
+        // Touch one 4 KiB chunk in the middle.
+        target_payload[10_000] ^= 0x55;
+        let base = manifest_for(&base_payload, 4096, "epoch-1");
+        let target = manifest_for(&target_payload, 4096, "epoch-2");
+
+        let plan = plan_delta(&base, &target);
+        let fetches: Vec<usize> = plan
+            .sources
+            .iter()
+            .enumerate()
+            .filter(|(_, source)| matches!(source, ChunkSource::Fetch))
+            .map(|(index, _)| index)
+            .collect();
+        assert_eq!(fetches, alloc::vec![2]);
+        assert_eq!(plan.fetch_bytes, 4096);
+        assert_eq!(plan.reused_bytes, base_payload.len() as u64 - 4096);
+
+        let mut fetched = BTreeMap::new();
+        fetched.insert(2usize, target_payload[8192..12288].to_vec());
+        let assembled =
+            apply_delta(&plan, &base, &target, &base_payload, &fetched).expect("apply");
+        assert_eq!(assembled, target_payload);
+
+        // Missing fetches and corrupt chunks are both refused.
+        assert_eq!(
+            apply_delta(&plan, &base, &target, &base_payload, &BTreeMap::new()),
+            Err(DeltaApplyError::MissingChunk { index: 2 })
+        );
+        let mut corrupt = BTreeMap::new();
+        corrupt.insert(2usize, alloc::vec![0u8; 4096]);
+        assert!(matches!(
+            apply_delta(&plan, &base, &target, &base_payload, &corrupt),
+            Err(DeltaApplyError::Verify(StreamVerifyError::ChunkMismatch { index: 2 }))
+        ));
+    }
+}
@@ -12,6 +12,19 @@ use core::fmt;
 /// CAS manifest schema identifier.
 pub const CAS_MANIFEST_SCHEMA: &str = "cohesix-cas/manifest-v1";
 
+/// CAS manifest schema identifier for content-defined chunking (v2 adds
+/// per-chunk lengths so variable-size chunks can be reassembled).
+pub const CAS_MANIFEST_SCHEMA_V2: &str = "cohesix-cas/manifest-v2";
+
+/// Content-defined chunking over raw payload bytes.
+pub mod cdc;
+
+/// Chunk-at-a-time streaming verification.
+pub mod stream;
+
+/// Chunk-level delta planning and application.
+pub mod delta;
+
 /// CAS manifest representation used across Cohesix components.
 #[derive(Clone, Debug, PartialEq, Eq)]
 pub struct CasManifest {
@@ -27,6 +40,9 @@ pub struct CasManifest {
     pub payload_sha256: [u8; 32],
     /// SHA-256 chunk digests for the payload represented by this manifest.
     pub chunks: Vec<[u8; 32]>,
+    /// Per-chunk byte lengths for content-defined (v2) manifests; `None`
+    /// for fixed-size (v1) manifests where every chunk is `chunk_bytes`.
+    pub chunk_lens: Option<Vec<u32>>,
     /// Optional delta metadata.
     pub delta: Option<CasDelta>,
     /// Optional Ed25519 signature (64 bytes).
@@ -91,7 +107,8 @@ fn encode_manifest(
     signature: Option<&[u8; 64]>,
 ) -> Result<Vec<u8>, CasManifestError> {
     let mut encoder = Encoder::new();
-    encoder.array_len(8)?;
+    let field_count = if manifest.chunk_lens.is_some() { 9 } else { 8 };
+    encoder.array_len(field_count)?;
     encoder.text(&manifest.schema)?;
     encoder.text(&manifest.epoch)?;
     encoder.unsigned(manifest.chunk_bytes as u64)?;
@@ -113,19 +130,27 @@ fn encode_manifest(
     } else {
         encoder.null();
     }
+    if let Some(lens) = &manifest.chunk_lens {
+        encoder.array_len(lens.len())?;
+        for len in lens {
+            encoder.unsigned(u64::from(*len))?;
+        }
+    }
     Ok(encoder.finish())
 }
 
 fn decode_manifest(bytes: &[u8]) -> Result<CasManifest, CasManifestError> {
     let mut decoder = Decoder::new(bytes);
     let len = decoder.array_len()?;
-    if len != 8 {
+    if len != 8 && len != 9 {
         return Err(CasManifestError::InvalidField("manifest array length"));
     }
     let schema = decoder.text()?;
-    if schema != CAS_MANIFEST_SCHEMA {
-        return Err(CasManifestError::InvalidSchema);
-    }
+    let expects_lens = match (schema.as_str(), len) {
+        (self::CAS_MANIFEST_SCHEMA, 8) => false,
+        (self::CAS_MANIFEST_SCHEMA_V2, 9) => true,
+        _ => return Err(CasManifestError::InvalidSchema),
+    };
     let epoch = decoder.text()?;
     let chunk_bytes = decoder.unsigned()? as u32;
     let payload_bytes = decoder.unsigned()?;
@@ -162,6 +187,19 @@ fn decode_manifest(bytes: &[u8]) -> Result<CasManifest, CasManifestError> {
         CborType::Bytes => Some(decoder.bytes_fixed_64()?),
         _ => return Err(CasManifestError::InvalidField("signature field type")),
     };
+    let chunk_lens = if expects_lens {
+        let len_count = decoder.array_len()?;
+        if len_count != chunks.len() {
+            return Err(CasManifestError::InvalidField("chunk length count"));
+        }
+        let mut lens = Vec::new();
+        for _ in 0..len_count {
+            lens.push(decoder.unsigned()? as u32);
+        }
+        Some(lens)
+    } else {
+        None
+    };
     decoder.ensure_eof()?;
     Ok(CasManifest {
         schema,
@@ -170,6 +208,7 @@ fn decode_manifest(bytes: &[u8]) -> Result<CasManifest, CasManifestError> {
         payload_bytes,
         payload_sha256,
         chunks,
+        chunk_lens,
         delta,
         signature,
     })
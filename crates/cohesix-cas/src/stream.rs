@@ -0,0 +1,183 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Incremental chunk-at-a-time verification of CAS payloads.
+// Author: Lukas Bower
+
+//! Verify-as-you-stream for CAS payloads.
+//!
+//! Consumers feed chunks in manifest order as they arrive off the wire; each
+//! chunk is checked against its manifest digest immediately, so pipelined
+//! decompression/placement can start on verified chunks while later ones are
+//! still in flight, and nothing needs the whole artifact in memory. The
+//! linear payload digest is accumulated alongside and checked at `finish`.
+
+use sha2::{Digest, Sha256};
+
+use crate::CasManifest;
+
+/// Errors raised during streaming verification.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum StreamVerifyError {
+    /// A chunk digest did not match the manifest entry at this index.
+    ChunkMismatch {
+        /// Zero-based chunk index that failed.
+        index: usize,
+    },
+    /// A chunk length disagreed with the manifest layout.
+    ChunkLength {
+        /// Zero-based chunk index that failed.
+        index: usize,
+    },
+    /// More chunks were pushed than the manifest declares.
+    TooManyChunks,
+    /// `finish` was called before every chunk arrived.
+    Incomplete,
+    /// The assembled payload digest did not match `payload_sha256`.
+    PayloadMismatch,
+}
+
+/// Incremental verifier over a manifest's chunk sequence.
+pub struct StreamingVerifier<'m> {
+    manifest: &'m CasManifest,
+    next_chunk: usize,
+    consumed: u64,
+    payload_hasher: Sha256,
+}
+
+impl<'m> StreamingVerifier<'m> {
+    /// Start verifying against the supplied manifest.
+    #[must_use]
+    pub fn new(manifest: &'m CasManifest) -> Self {
+        Self {
+            manifest,
+            next_chunk: 0,
+            consumed: 0,
+            payload_hasher: Sha256::new(),
+        }
+    }
+
+    /// Index of the next expected chunk.
+    #[must_use]
+    pub fn next_chunk(&self) -> usize {
+        self.next_chunk
+    }
+
+    fn expected_len(&self, index: usize) -> Option<u64> {
+        match &self.manifest.chunk_lens {
+            Some(lens) => lens.get(index).map(|len| u64::from(*len)),
+            None => {
+                // Fixed-size layout: every chunk is chunk_bytes except a
+                // short final chunk covering the payload remainder.
+                let chunk = u64::from(self.manifest.chunk_bytes);
+                if chunk == 0 {
+                    return None;
+                }
+                let start = index as u64 * chunk;
+                Some(chunk.min(self.manifest.payload_bytes.saturating_sub(start)))
+            }
+        }
+    }
+
+    /// Verify the next chunk in sequence.
+    pub fn push_chunk(&mut self, bytes: &[u8]) -> Result<(), StreamVerifyError> {
+        let index = self.next_chunk;
+        let Some(expected_digest) = self.manifest.chunks.get(index) else {
+            return Err(StreamVerifyError::TooManyChunks);
+        };
+        if self
+            .expected_len(index)
+            .is_none_or(|len| len != bytes.len() as u64)
+        {
+            return Err(StreamVerifyError::ChunkLength { index });
+        }
+        let digest = Sha256::digest(bytes);
+        if digest.as_slice() != expected_digest {
+            return Err(StreamVerifyError::ChunkMismatch { index });
+        }
+        self.payload_hasher.update(bytes);
+        self.consumed += bytes.len() as u64;
+        self.next_chunk += 1;
+        Ok(())
+    }
+
+    /// Complete verification: all chunks consumed and the payload digest
+    /// matches the manifest.
+    pub fn finish(self) -> Result<(), StreamVerifyError> {
+        if self.next_chunk != self.manifest.chunks.len()
+            || self.consumed != self.manifest.payload_bytes
+        {
+            return Err(StreamVerifyError::Incomplete);
+        }
+        let digest = self.payload_hasher.finalize();
+        if digest.as_slice() != self.manifest.payload_sha256 {
+            return Err(StreamVerifyError::PayloadMismatch);
+        }
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::CAS_MANIFEST_SCHEMA;
+    use alloc::borrow::ToOwned;
+    use alloc::vec::Vec;
+
+    fn manifest_for(payload: &[u8], chunk_bytes: u32) -> CasManifest {
+        let chunks: Vec<[u8; 32]> = payload
+            .chunks(chunk_bytes as usize)
+            .map(|chunk| {
+                let mut out = [0u8; 32];
+                out.copy_from_slice(&Sha256::digest(chunk));
+                out
+            })
+            .collect();
+        let mut payload_sha256 = [0u8; 32];
+        payload_sha256.copy_from_slice(&Sha256::digest(payload));
+        CasManifest {
+            schema: CAS_MANIFEST_SCHEMA.to_owned(),
+            epoch: "epoch-1".to_owned(),
+            chunk_bytes,
+            payload_bytes: payload.len() as u64,
+            payload_sha256,
+            chunks,
+            chunk_lens: None,
+            delta: None,
+            signature: None,
+        }
+    }
+
+    #[test]
+    fn streams_verify_chunk_by_chunk() {
+        let payload: Vec<u8> = (0..10_000u32).map(|i| (i % 241) as u8).collect();
+        let manifest = manifest_for(&payload, 4096);
+        let mut verifier = StreamingVerifier::new(&manifest);
+        for chunk in payload.chunks(4096) {
+            verifier.push_chunk(chunk).expect("chunk verifies");
+        }
+        verifier.finish().expect("payload verifies");
+    }
+
+    #[test]
+    fn corrupt_chunks_fail_at_their_index() {
+        let payload: Vec<u8> = (0..10_000u32).map(|i| (i % 241) as u8).collect();
+        let manifest = manifest_for(&payload, 4096);
+        let mut verifier = StreamingVerifier::new(&manifest);
+        let mut chunks: Vec<Vec<u8>> =
+            payload.chunks(4096).map(|chunk| chunk.to_vec()).collect();
+        chunks[1][0] ^= 0xff;
+        verifier.push_chunk(&chunks[0]).expect("first ok");
+        assert_eq!(
+            verifier.push_chunk(&chunks[1]),
+            Err(StreamVerifyError::ChunkMismatch { index: 1 })
+        );
+        // Short final chunk length is enforced too.
+        let mut verifier = StreamingVerifier::new(&manifest);
+        assert_eq!(
+            verifier.push_chunk(&payload[..100]),
+            Err(StreamVerifyError::ChunkLength { index: 0 })
+        );
+        let verifier = StreamingVerifier::new(&manifest);
+        assert_eq!(verifier.finish(), Err(StreamVerifyError::Incomplete));
+    }
+}
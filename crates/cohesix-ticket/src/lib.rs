@@ -683,6 +683,29 @@ impl<'a> PayloadCursor<'a> {
 mod tests {
     use super::*;
 
+    #[test]
+    fn verifier_cache_serves_repeat_tokens() {
+        let issuer = TicketIssuer::new("worker-secret");
+        let claims = TicketClaims::new(
+            Role::WorkerHeartbeat,
+            BudgetSpec::default_heartbeat(),
+            Some("worker-1".into()),
+            MountSpec::empty(),
+            1,
+        );
+        let token = issuer.issue(claims).unwrap().encode().unwrap();
+        let key = issuer.key();
+        let mut cache = TicketVerifierCache::new();
+        let first = cache.decode(&token, &key).unwrap();
+        let second = cache.decode(&token, &key).unwrap();
+        assert_eq!(first, second);
+        assert_eq!(cache.stats(), (1, 1));
+        // A different key must not hit the cached entry.
+        let other_key = TicketIssuer::new("other-secret").key();
+        assert!(cache.decode(&token, &other_key).is_err());
+        assert_eq!(cache.stats(), (1, 2));
+    }
+
     #[test]
     fn default_heartbeat_limits_are_finite() {
         let budget = BudgetSpec::default_heartbeat();
@@ -715,3 +738,62 @@ mod tests {
         assert_eq!(decoded.claims(), &claims);
     }
 }
+
+/// Capacity of the ticket verification cache.
+pub const TICKET_CACHE_CAPACITY: usize = 256;
+
+/// Bounded cache of MAC-verified tickets.
+///
+/// Reconnect storms replay the same tokens within seconds; caching the
+/// verified claims keyed by a digest of (key, token) turns each repeat
+/// verification into a map probe instead of a MAC computation plus payload
+/// decode. Entries evict FIFO once the bound is reached, and a different key
+/// (rotated secret) never matches a cached entry because the key bytes are
+/// part of the cache digest.
+#[derive(Debug, Default, Clone)]
+pub struct TicketVerifierCache {
+    entries: alloc::collections::BTreeMap<[u8; 32], TicketToken>,
+    order: alloc::collections::VecDeque<[u8; 32]>,
+    hits: u64,
+    misses: u64,
+}
+
+impl TicketVerifierCache {
+    /// Create an empty verification cache.
+    #[must_use]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    fn cache_key(token: &str, key: &TicketKey) -> [u8; 32] {
+        let mut hasher = blake3::Hasher::new();
+        hasher.update(&key.0);
+        hasher.update(token.as_bytes());
+        *hasher.finalize().as_bytes()
+    }
+
+    /// Decode a ticket, serving repeat verifications from the cache.
+    pub fn decode(&mut self, token: &str, key: &TicketKey) -> Result<TicketToken, TicketError> {
+        let cache_key = Self::cache_key(token, key);
+        if let Some(cached) = self.entries.get(&cache_key) {
+            self.hits = self.hits.saturating_add(1);
+            return Ok(cached.clone());
+        }
+        self.misses = self.misses.saturating_add(1);
+        let verified = TicketToken::decode(token, key)?;
+        if self.entries.len() >= TICKET_CACHE_CAPACITY {
+            if let Some(oldest) = self.order.pop_front() {
+                self.entries.remove(&oldest);
+            }
+        }
+        self.entries.insert(cache_key, verified.clone());
+        self.order.push_back(cache_key);
+        Ok(verified)
+    }
+
+    /// Return `(hits, misses)` counters for observability.
+    #[must_use]
+    pub fn stats(&self) -> (u64, u64) {
+        (self.hits, self.misses)
+    }
+}
@@ -0,0 +1,149 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Cache small control-file contents validated by Secure9P qid versions.
+// Author: Lukas Bower
+#![forbid(unsafe_code)]
+
+//! Qid-validated content cache for frequently re-read control files.
+//!
+//! Secure9P bumps a node's qid version on every write, so a client that
+//! already holds the content for `(path, qid)` can serve it after a cheap
+//! walk instead of repeating open+read+clunk. Dashboards polling `/status`
+//! and lease files keep one wire op per refresh instead of four.
+
+extern crate alloc;
+
+use alloc::collections::BTreeMap;
+use alloc::string::String;
+use alloc::vec::Vec;
+
+use secure9p_codec::Qid;
+
+/// Default bound on cached control files.
+pub const DEFAULT_CONTENT_CACHE_ENTRIES: usize = 64;
+
+/// Bound on the size of a cached payload; control files are small and bulk
+/// data would only churn the cache.
+pub const MAX_CACHED_CONTENT_BYTES: usize = 16 * 1024;
+
+#[derive(Debug, Clone)]
+struct CacheEntry {
+    qid: Qid,
+    content: Vec<u8>,
+}
+
+/// Content cache keyed by path and validated against the node's current qid.
+#[derive(Debug, Clone, Default)]
+pub struct QidContentCache {
+    entries: BTreeMap<String, CacheEntry>,
+    max_entries: usize,
+    hits: u64,
+    misses: u64,
+}
+
+impl QidContentCache {
+    /// Create a cache bounded to the default entry count.
+    #[must_use]
+    pub fn new() -> Self {
+        Self::with_capacity(DEFAULT_CONTENT_CACHE_ENTRIES)
+    }
+
+    /// Create a cache bounded to `max_entries`.
+    #[must_use]
+    pub fn with_capacity(max_entries: usize) -> Self {
+        Self {
+            entries: BTreeMap::new(),
+            max_entries: max_entries.max(1),
+            hits: 0,
+            misses: 0,
+        }
+    }
+
+    /// Serve the cached content when the node's current qid still matches.
+    pub fn lookup(&mut self, path: &str, current: Qid) -> Option<&[u8]> {
+        match self.entries.get(path) {
+            Some(entry) if entry.qid == current => {
+                self.hits = self.hits.saturating_add(1);
+                Some(self.entries[path].content.as_slice())
+            }
+            Some(_) => {
+                // Version moved on; drop the stale payload eagerly.
+                self.entries.remove(path);
+                self.misses = self.misses.saturating_add(1);
+                None
+            }
+            None => {
+                self.misses = self.misses.saturating_add(1);
+                None
+            }
+        }
+    }
+
+    /// Record freshly read content for the path at the observed qid.
+    pub fn insert(&mut self, path: &str, qid: Qid, content: &[u8]) {
+        if content.len() > MAX_CACHED_CONTENT_BYTES {
+            return;
+        }
+        if !self.entries.contains_key(path) && self.entries.len() >= self.max_entries {
+            // BTreeMap keeps keys ordered; evicting the first key is a cheap
+            // deterministic policy for a cache this small.
+            if let Some(first) = self.entries.keys().next().cloned() {
+                self.entries.remove(&first);
+            }
+        }
+        self.entries.insert(
+            String::from(path),
+            CacheEntry {
+                qid,
+                content: content.to_vec(),
+            },
+        );
+    }
+
+    /// Drop a cached path (e.g. after a local write through the same client).
+    pub fn invalidate(&mut self, path: &str) {
+        self.entries.remove(path);
+    }
+
+    /// Return `(hits, misses)` counters for observability surfaces.
+    #[must_use]
+    pub fn stats(&self) -> (u64, u64) {
+        (self.hits, self.misses)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use secure9p_codec::QidType;
+
+    fn qid(version: u32) -> Qid {
+        Qid::new(QidType::FILE, version, 7)
+    }
+
+    #[test]
+    fn serves_matching_version_and_drops_stale() {
+        let mut cache = QidContentCache::with_capacity(2);
+        cache.insert("/status", qid(1), b"ACTIVE");
+        assert_eq!(cache.lookup("/status", qid(1)), Some(b"ACTIVE".as_slice()));
+        assert_eq!(cache.lookup("/status", qid(2)), None);
+        assert_eq!(cache.lookup("/status", qid(2)), None);
+        assert_eq!(cache.stats(), (1, 2));
+    }
+
+    #[test]
+    fn bounds_entries_and_payload_size() {
+        let mut cache = QidContentCache::with_capacity(2);
+        cache.insert("/a", qid(1), b"a");
+        cache.insert("/b", qid(1), b"b");
+        cache.insert("/c", qid(1), b"c");
+        let cached = ["/a", "/b", "/c"]
+            .iter()
+            .filter(|path| cache.lookup(path, qid(1)).is_some())
+            .count();
+        assert_eq!(cached, 2);
+        let huge = alloc::vec![0u8; MAX_CACHED_CONTENT_BYTES + 1];
+        cache.insert("/huge", qid(1), &huge);
+        assert_eq!(cache.lookup("/huge", qid(1)), None);
+    }
+}
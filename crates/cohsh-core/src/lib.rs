@@ -11,6 +11,7 @@
 
 extern crate alloc;
 
+pub mod cache;
 pub mod command;
 pub mod docs;
 pub mod help;
@@ -26,6 +27,7 @@ pub mod wire;
 #[cfg(feature = "tcp")]
 pub mod tcp;
 
+pub use cache::QidContentCache;
 pub use command::{
     Command, CommandParser, ConsoleError, RateLimiter, MAX_ECHO_LEN, MAX_ID_LEN, MAX_JSON_LEN,
     MAX_LINE_LEN, MAX_PATH_LEN, MAX_ROLE_LEN, MAX_TICKET_LEN,
@@ -211,6 +211,63 @@ where
         Ok(())
     }
 
+    /// Pipeline several requests as one Secure9P batch exchange.
+    ///
+    /// Every body is encoded into a single wire batch with its own tag, the
+    /// transport performs one exchange, and the server drains the batch
+    /// through `BatchIter` before flushing one combined response — one
+    /// read/write syscall pair per burst instead of one per message.
+    /// Responses are returned in request order; a protocol error for one
+    /// request surfaces in its slot without aborting the others.
+    pub fn transact_batch(
+        &mut self,
+        bodies: &[RequestBody],
+    ) -> Result<Vec<Result<ResponseBody, ClientError<T::Error>>>, ClientError<T::Error>> {
+        if bodies.is_empty() {
+            return Ok(Vec::new());
+        }
+        let mut batch = Vec::new();
+        let mut tags = Vec::with_capacity(bodies.len());
+        for body in bodies {
+            let tag = self.next_tag();
+            tags.push(tag);
+            let request = Request {
+                tag,
+                body: body.clone(),
+            };
+            batch.extend_from_slice(&self.codec.encode_request(&request)?);
+        }
+        let response_bytes = self
+            .transport
+            .exchange(&batch)
+            .map_err(ClientError::Transport)?;
+        let mut responses = Vec::with_capacity(bodies.len());
+        for (idx, frame) in secure9p_codec::BatchIter::new(&response_bytes).enumerate() {
+            let frame = frame.map_err(ClientError::Codec)?;
+            let response = self.codec.decode_response(frame.bytes())?;
+            let expected = *tags.get(idx).ok_or(ClientError::UnexpectedTag {
+                expected: 0,
+                got: response.tag,
+            })?;
+            if response.tag != expected {
+                return Err(ClientError::UnexpectedTag {
+                    expected,
+                    got: response.tag,
+                });
+            }
+            responses.push(match response.body {
+                ResponseBody::Error { code, message } => {
+                    Err(ClientError::Protocol { code, message })
+                }
+                other => Ok(other),
+            });
+        }
+        if responses.len() != bodies.len() {
+            return Err(ClientError::UnexpectedResponse("batch length"));
+        }
+        Ok(responses)
+    }
+
     fn next_tag(&mut self) -> u16 {
         let tag = self.next_tag;
         self.next_tag = self.next_tag.wrapping_add(1);
@@ -280,3 +337,71 @@ fn role_to_uname<E>(role: Role, identity: Option<&str>) -> Result<String, Client
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use alloc::vec;
+
+    /// Transport that services batches with an in-test responder, mirroring
+    /// the server-side BatchIter drain.
+    struct BatchEcho;
+
+    impl Secure9pTransport for BatchEcho {
+        type Error = CodecError;
+
+        fn exchange(&mut self, batch: &[u8]) -> Result<Vec<u8>, Self::Error> {
+            let codec = Codec;
+            let mut out = Vec::new();
+            for frame in secure9p_codec::BatchIter::new(batch) {
+                let request = codec.decode_request(frame?.bytes())?;
+                let body = match request.body {
+                    RequestBody::Version { msize, version } => {
+                        ResponseBody::Version { msize, version }
+                    }
+                    RequestBody::Clunk { .. } => ResponseBody::Clunk,
+                    _ => ResponseBody::Error {
+                        code: ErrorCode::Invalid,
+                        message: "unsupported".to_string(),
+                    },
+                };
+                secure9p_codec::encode_response_into(
+                    &secure9p_codec::Response {
+                        tag: request.tag,
+                        body,
+                    },
+                    &mut out,
+                )?;
+            }
+            Ok(out)
+        }
+    }
+
+    #[test]
+    fn transact_batch_pipelines_requests_in_order() {
+        let mut client = Secure9pClient::new(BatchEcho);
+        let bodies = vec![
+            RequestBody::Version {
+                msize: secure9p_codec::MAX_MSIZE,
+                version: VERSION.to_string(),
+            },
+            RequestBody::Clunk { fid: 1 },
+            RequestBody::Read {
+                fid: 2,
+                offset: 0,
+                count: 8,
+            },
+        ];
+        let responses = client.transact_batch(&bodies).expect("batch exchange");
+        assert_eq!(responses.len(), 3);
+        assert!(matches!(responses[0], Ok(ResponseBody::Version { .. })));
+        assert!(matches!(responses[1], Ok(ResponseBody::Clunk)));
+        assert!(matches!(
+            responses[2],
+            Err(ClientError::Protocol {
+                code: ErrorCode::Invalid,
+                ..
+            })
+        ));
+    }
+}
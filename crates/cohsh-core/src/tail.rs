@@ -39,6 +39,7 @@ impl TailPollPolicy {
 /// Polling state tracker used to throttle repeated tail operations.
 #[derive(Debug, Clone)]
 pub struct TailPoller {
+    policy: TailPollPolicy,
     poll_ms: u64,
     last_poll_ms: Option<u64>,
 }
@@ -48,11 +49,32 @@ impl TailPoller {
     #[must_use]
     pub fn new(policy: TailPollPolicy, desired_ms: Option<u64>) -> Self {
         Self {
+            policy,
             poll_ms: policy.clamp(desired_ms),
             last_poll_ms: None,
         }
     }
 
+    /// Adapt the polling cadence after a poll completes.
+    ///
+    /// A server-supplied hint (derived from the ring's observed write rate)
+    /// wins outright, clamped to the policy bounds. Without one the poller
+    /// converges on its own: empty polls back off multiplicatively toward the
+    /// policy maximum, a poll that returned data snaps back toward the
+    /// minimum, so idle tails stop burning round trips while hot tails track
+    /// the producer.
+    pub fn record_outcome(&mut self, got_data: bool, hint_ms: Option<u64>) {
+        if let Some(hint) = hint_ms {
+            self.poll_ms = self.policy.clamp(Some(hint));
+            return;
+        }
+        self.poll_ms = if got_data {
+            self.policy.clamp(Some(self.poll_ms / 2))
+        } else {
+            self.policy.clamp(Some(self.poll_ms.saturating_mul(2)))
+        };
+    }
+
     /// Return the effective polling interval in milliseconds.
     #[must_use]
     pub fn poll_ms(&self) -> u64 {
@@ -96,9 +118,16 @@ impl TailPoller {
 }
 
 /// Bounded line buffer used for Live Hive overlays and detail panels.
+///
+/// Lines live in one contiguous byte arena indexed by `(offset, len)` ranges,
+/// so pushing a line costs at most one arena grow instead of a `String`
+/// allocation, and [`BoundedLineBuffer::lines`] hands out borrowed slices.
+/// Trimming advances the logical start; the arena is compacted in one move
+/// once the dead prefix outgrows the retained bytes.
 #[derive(Debug, Clone)]
 pub struct BoundedLineBuffer {
-    lines: VecDeque<String>,
+    arena: Vec<u8>,
+    ranges: VecDeque<(usize, usize)>,
     max_lines: usize,
     max_bytes: usize,
     line_cap: usize,
@@ -110,7 +139,8 @@ impl BoundedLineBuffer {
     #[must_use]
     pub fn new(max_lines: usize, max_bytes: usize, line_cap: usize) -> Self {
         Self {
-            lines: VecDeque::new(),
+            arena: Vec::new(),
+            ranges: VecDeque::new(),
             max_lines,
             max_bytes,
             line_cap,
@@ -121,13 +151,13 @@ impl BoundedLineBuffer {
     /// Return true when the buffer has no stored lines.
     #[must_use]
     pub fn is_empty(&self) -> bool {
-        self.lines.is_empty()
+        self.ranges.is_empty()
     }
 
     /// Return the number of lines stored in the buffer.
     #[must_use]
     pub fn len(&self) -> usize {
-        self.lines.len()
+        self.ranges.len()
     }
 
     /// Return the total bytes stored in the buffer.
@@ -138,7 +168,8 @@ impl BoundedLineBuffer {
 
     /// Clear all buffered lines.
     pub fn clear(&mut self) {
-        self.lines.clear();
+        self.arena.clear();
+        self.ranges.clear();
         self.total_bytes = 0;
     }
 
@@ -151,10 +182,11 @@ impl BoundedLineBuffer {
         if trimmed.is_empty() {
             return;
         }
-        let line = truncate_to_boundary(trimmed, self.line_cap);
-        let len = line.len();
-        self.lines.push_back(line);
-        self.total_bytes = self.total_bytes.saturating_add(len);
+        let line = truncate_str_to_boundary(trimmed, self.line_cap);
+        let start = self.arena.len();
+        self.arena.extend_from_slice(line.as_bytes());
+        self.ranges.push_back((start, line.len()));
+        self.total_bytes = self.total_bytes.saturating_add(line.len());
         self.trim();
     }
 
@@ -168,40 +200,64 @@ impl BoundedLineBuffer {
         }
     }
 
-    /// Return all buffered lines in order.
+    /// Iterate over the buffered lines as borrowed slices, oldest first.
+    pub fn lines(&self) -> impl Iterator<Item = &str> {
+        self.ranges.iter().map(|(start, len)| {
+            core::str::from_utf8(&self.arena[*start..*start + *len])
+                .expect("arena stores validated UTF-8 lines")
+        })
+    }
+
+    /// Return all buffered lines in order as owned strings.
     #[must_use]
     pub fn snapshot(&self) -> Vec<String> {
-        self.lines.iter().cloned().collect()
+        self.lines().map(str::to_string).collect()
     }
 
     /// Return the last N lines from the buffer.
     #[must_use]
     pub fn tail(&self, max_lines: usize) -> Vec<String> {
-        if max_lines == 0 || self.lines.is_empty() {
+        if max_lines == 0 || self.ranges.is_empty() {
             return Vec::new();
         }
-        let count = core::cmp::min(max_lines, self.lines.len());
-        self.lines
-            .iter()
-            .skip(self.lines.len().saturating_sub(count))
-            .cloned()
+        let count = core::cmp::min(max_lines, self.ranges.len());
+        self.lines()
+            .skip(self.ranges.len().saturating_sub(count))
+            .map(str::to_string)
             .collect()
     }
 
     fn trim(&mut self) {
-        while self.lines.len() > self.max_lines || self.total_bytes > self.max_bytes {
-            if let Some(line) = self.lines.pop_front() {
-                self.total_bytes = self.total_bytes.saturating_sub(line.len());
+        while self.ranges.len() > self.max_lines || self.total_bytes > self.max_bytes {
+            if let Some((_, len)) = self.ranges.pop_front() {
+                self.total_bytes = self.total_bytes.saturating_sub(len);
             } else {
                 break;
             }
         }
+        self.compact();
+    }
+
+    /// Drop the dead prefix once it dominates the arena so memory stays
+    /// proportional to the retained lines.
+    fn compact(&mut self) {
+        let Some(&(start, _)) = self.ranges.front() else {
+            self.arena.clear();
+            return;
+        };
+        if start <= self.total_bytes.max(64) {
+            return;
+        }
+        self.arena.drain(..start);
+        for range in &mut self.ranges {
+            range.0 -= start;
+        }
     }
 }
 
-fn truncate_to_boundary(input: &str, max_bytes: usize) -> String {
+fn truncate_str_to_boundary(input: &str, max_bytes: usize) -> &str {
     if input.len() <= max_bytes {
-        return input.to_string();
+        return input;
     }
     let mut end = 0usize;
     for (idx, ch) in input.char_indices() {
@@ -211,7 +267,7 @@ fn truncate_to_boundary(input: &str, max_bytes: usize) -> String {
         }
         end = next;
     }
-    input[..end].to_string()
+    &input[..end]
 }
 
 #[cfg(test)]
@@ -230,6 +286,41 @@ mod tests {
         assert_eq!(policy.clamp(Some(20_000)), 10_000);
     }
 
+    #[test]
+    fn poller_honours_hints_and_adapts_without_them() {
+        let policy = TailPollPolicy {
+            poll_ms_default: 1000,
+            poll_ms_min: 100,
+            poll_ms_max: 8000,
+        };
+        let mut poller = TailPoller::new(policy, None);
+        poller.record_outcome(false, Some(42));
+        assert_eq!(poller.poll_ms(), 100);
+        poller.record_outcome(true, Some(2500));
+        assert_eq!(poller.poll_ms(), 2500);
+        // Without hints, empty polls back off and data snaps back down.
+        poller.record_outcome(false, None);
+        assert_eq!(poller.poll_ms(), 5000);
+        poller.record_outcome(false, None);
+        assert_eq!(poller.poll_ms(), 8000);
+        poller.record_outcome(true, None);
+        assert_eq!(poller.poll_ms(), 4000);
+    }
+
+    #[test]
+    fn arena_hands_out_borrowed_lines_and_compacts() {
+        let mut buffer = BoundedLineBuffer::new(4, 4096, 64);
+        for idx in 0..64 {
+            buffer.push_line(&alloc::format!("line number {idx}"));
+        }
+        let lines: Vec<&str> = buffer.lines().collect();
+        assert_eq!(lines.len(), 4);
+        assert_eq!(lines[3], "line number 63");
+        // Compaction keeps the arena proportional to the retained bytes.
+        assert!(buffer.arena.len() <= buffer.total_bytes() + 64 + 16);
+        assert_eq!(buffer.tail(2), alloc::vec!["line number 62", "line number 63"]);
+    }
+
     #[test]
     fn bounded_buffer_trims_on_line_and_byte_limits() {
         let mut buffer = BoundedLineBuffer::new(3, 10, 5);
@@ -38,21 +38,27 @@ impl FrameEncoder {
     }
 
     /// Write a single length-prefixed frame to the socket.
+    ///
+    /// Header and payload are gathered into the socket's transmit buffer in
+    /// one `send` call, so the wire path neither formats into a temporary nor
+    /// risks a header/payload split across two partial sends.
     pub fn write_frame(&self, socket: &mut TcpSocket<'_>, line: &str) -> Result<(), FrameError> {
         let total_len = line.len().saturating_add(FRAME_LEN_BYTES);
         if total_len < FRAME_LEN_BYTES || total_len > self.max_frame_len {
             return Err(FrameError::InvalidLength);
         }
         let len_bytes = (total_len as u32).to_le_bytes();
-        match socket.send_slice(&len_bytes) {
-            Ok(sent) if sent == len_bytes.len() => {}
-            Ok(_) | Err(TcpSendError::InvalidState) | Err(TcpSendError::Unaddressable) => {
-                return Err(FrameError::Send)
+        let outcome = socket.send(|buffer| {
+            if buffer.len() < total_len {
+                return (0, false);
             }
-        }
-        match socket.send_slice(line.as_bytes()) {
-            Ok(sent) if sent == line.len() => Ok(()),
-            Ok(_) | Err(TcpSendError::InvalidState) | Err(TcpSendError::Unaddressable) => {
+            buffer[..FRAME_LEN_BYTES].copy_from_slice(&len_bytes);
+            buffer[FRAME_LEN_BYTES..total_len].copy_from_slice(line.as_bytes());
+            (total_len, true)
+        });
+        match outcome {
+            Ok(true) => Ok(()),
+            Ok(false) | Err(TcpSendError::InvalidState) | Err(TcpSendError::Unaddressable) => {
                 Err(FrameError::Send)
             }
         }
@@ -67,6 +73,7 @@ pub struct FrameDecoder<const N: usize> {
     len_pos: usize,
     payload_len: Option<usize>,
     payload: HeaplessVec<u8, N>,
+    completed: bool,
 }
 
 impl<const N: usize> FrameDecoder<N> {
@@ -79,29 +86,47 @@ impl<const N: usize> FrameDecoder<N> {
             len_pos: 0,
             payload_len: None,
             payload: HeaplessVec::new(),
+            completed: false,
         }
     }
 
-    /// Attempt to read a single frame from the socket.
+    /// Attempt to read a single frame, returning an owned copy.
     pub fn read_frame(
         &mut self,
         socket: &mut TcpSocket<'_>,
     ) -> Result<Option<HeaplessVec<u8, N>>, FrameError> {
+        match self.read_frame_ref(socket)? {
+            Some(frame) => Ok(Some(
+                HeaplessVec::from_slice(frame).map_err(|_| FrameError::PayloadTooLarge)?,
+            )),
+            None => Ok(None),
+        }
+    }
+
+    /// Attempt to read a single frame, borrowing it from the decoder's
+    /// reusable buffer. The slice stays valid until the next read call, which
+    /// recycles the buffer — no copy leaves the decoder on this path.
+    pub fn read_frame_ref(
+        &mut self,
+        socket: &mut TcpSocket<'_>,
+    ) -> Result<Option<&[u8]>, FrameError> {
+        if self.completed {
+            // Recycle the buffer handed out by the previous call.
+            self.reset();
+        }
         if !socket.can_recv() {
             return Ok(None);
         }
-        let mut completed: Option<HeaplessVec<u8, N>> = None;
         let mut error: Option<FrameError> = None;
         let recv_result = socket.recv(|data| {
             let mut consumed = 0usize;
             for &byte in data {
-                if completed.is_some() || error.is_some() {
+                if self.completed || error.is_some() {
                     break;
                 }
                 consumed = consumed.saturating_add(1);
                 match self.push_byte(byte) {
-                    Ok(Some(frame)) => completed = Some(frame),
-                    Ok(None) => {}
+                    Ok(done) => self.completed = done,
                     Err(err) => error = Some(err),
                 }
             }
@@ -113,10 +138,14 @@ impl<const N: usize> FrameDecoder<N> {
         if let Some(err) = error {
             return Err(err);
         }
-        Ok(completed)
+        if self.completed {
+            Ok(Some(&self.payload))
+        } else {
+            Ok(None)
+        }
     }
 
-    fn push_byte(&mut self, byte: u8) -> Result<Option<HeaplessVec<u8, N>>, FrameError> {
+    fn push_byte(&mut self, byte: u8) -> Result<bool, FrameError> {
         if self.payload_len.is_none() {
             self.len_buf[self.len_pos] = byte;
             self.len_pos = self.len_pos.saturating_add(1);
@@ -135,31 +164,25 @@ impl<const N: usize> FrameDecoder<N> {
                 self.payload_len = Some(payload_len);
                 self.payload.clear();
                 if payload_len == 0 {
-                    let frame = self.payload.clone();
-                    self.reset();
-                    return Ok(Some(frame));
+                    return Ok(true);
                 }
             }
-            return Ok(None);
+            return Ok(false);
         }
 
         if self.payload.push(byte).is_err() {
             self.reset();
             return Err(FrameError::PayloadTooLarge);
         }
-        if let Some(expected) = self.payload_len {
-            if self.payload.len() == expected {
-                let frame = self.payload.clone();
-                self.reset();
-                return Ok(Some(frame));
-            }
-        }
-        Ok(None)
+        Ok(self
+            .payload_len
+            .is_some_and(|expected| self.payload.len() == expected))
     }
 
     fn reset(&mut self) {
         self.len_pos = 0;
         self.payload_len = None;
         self.payload.clear();
+        self.completed = false;
     }
 }
@@ -231,50 +231,90 @@ impl ConsoleVerb {
     }
 
     /// Parse a console verb token, matching case-insensitively.
+    ///
+    /// Dispatch goes through [`dispatch::VERB_TABLE`], a perfect-hash
+    /// table built at compile time: one hash, one probe, one token
+    /// comparison — no cascaded string compares on the per-invocation
+    /// startup path.
     #[must_use]
     pub fn from_token(token: &str) -> Option<Self> {
-        if token.eq_ignore_ascii_case("help") {
-            Some(Self::Help)
-        } else if token.eq_ignore_ascii_case("bi") {
-            Some(Self::BootInfo)
-        } else if token.eq_ignore_ascii_case("caps") {
-            Some(Self::Caps)
-        } else if token.eq_ignore_ascii_case("mem") {
-            Some(Self::Mem)
-        } else if token.eq_ignore_ascii_case("ping") {
-            Some(Self::Ping)
-        } else if token.eq_ignore_ascii_case("test") {
-            Some(Self::Test)
-        } else if token.eq_ignore_ascii_case("nettest") {
-            Some(Self::NetTest)
-        } else if token.eq_ignore_ascii_case("netstats") {
-            Some(Self::NetStats)
-        } else if token.eq_ignore_ascii_case("log") {
-            Some(Self::Log)
-        } else if token.eq_ignore_ascii_case("cachelog") {
-            Some(Self::CacheLog)
-        } else if token.eq_ignore_ascii_case("quit") {
-            Some(Self::Quit)
-        } else if token.eq_ignore_ascii_case("tail") {
-            Some(Self::Tail)
-        } else if token.eq_ignore_ascii_case("cat") {
-            Some(Self::Cat)
-        } else if token.eq_ignore_ascii_case("ls") {
-            Some(Self::Ls)
-        } else if token.eq_ignore_ascii_case("echo") {
-            Some(Self::Echo)
-        } else if token.eq_ignore_ascii_case("attach") {
-            Some(Self::Attach)
-        } else if token.eq_ignore_ascii_case("spawn") {
-            Some(Self::Spawn)
-        } else if token.eq_ignore_ascii_case("kill") {
-            Some(Self::Kill)
-        } else {
-            None
+        let slot = dispatch::slot_for(token.as_bytes());
+        match dispatch::VERB_TABLE[slot] {
+            Some((canonical, verb)) if token.eq_ignore_ascii_case(canonical) => Some(verb),
+            _ => None,
         }
     }
 }
 
+/// Compile-time perfect-hash dispatch table for console verbs.
+///
+/// The precomputed seed places the 18 canonical tokens in distinct
+/// slots; a const assertion re-verifies it each build, so adding a verb
+/// that collides fails compilation rather than degrading lookups at
+/// runtime.
+mod dispatch {
+    use super::{ConsoleVerb, ALL_VERBS, VERB_SPEC_COUNT};
+
+    /// Table size: sparse enough (64 slots for 18 verbs) that a
+    /// collision-free seed exists close to zero.
+    pub const TABLE_SLOTS: usize = 64;
+
+    /// Seeded FNV-1a over lowercased bytes with a Fibonacci finalizer;
+    /// the top six bits of the mixed state pick the slot.
+    const fn hash_token(seed: u64, token: &[u8]) -> usize {
+        let mut state = 0xcbf2_9ce4_8422_2325u64 ^ seed;
+        let mut index = 0;
+        while index < token.len() {
+            state ^= token[index].to_ascii_lowercase() as u64;
+            state = state.wrapping_mul(0x0000_0100_0000_01b3);
+            index += 1;
+        }
+        (state.wrapping_mul(0x9e37_79b9_7f4a_7c15) >> 58) as usize
+    }
+
+    /// Precomputed collision-free seed for the current verb inventory
+    /// (first such value counting up from zero). The const assertion
+    /// below re-verifies it on every build, so adding a verb that
+    /// collides fails compilation with instructions to re-search.
+    const SEED: u64 = 19;
+
+    const fn seed_is_perfect(seed: u64) -> bool {
+        let mut used = 0u64;
+        let mut index = 0;
+        while index < VERB_SPEC_COUNT {
+            let slot = hash_token(seed, ALL_VERBS[index].token().as_bytes());
+            if used & (1 << slot) != 0 {
+                return false;
+            }
+            used |= 1 << slot;
+            index += 1;
+        }
+        true
+    }
+
+    const _: () = assert!(
+        seed_is_perfect(SEED),
+        "console verb table collides: bump dispatch::SEED to the next collision-free value"
+    );
+
+    /// Slot for a token under the chosen seed.
+    pub const fn slot_for(token: &[u8]) -> usize {
+        hash_token(SEED, token)
+    }
+
+    /// Perfect-hash table: canonical token plus verb per occupied slot.
+    pub const VERB_TABLE: [Option<(&str, ConsoleVerb)>; TABLE_SLOTS] = {
+        let mut table: [Option<(&str, ConsoleVerb)>; TABLE_SLOTS] = [None; TABLE_SLOTS];
+        let mut index = 0;
+        while index < VERB_SPEC_COUNT {
+            let verb = ALL_VERBS[index];
+            table[slot_for(verb.token().as_bytes())] = Some((verb.token(), verb));
+            index += 1;
+        }
+        table
+    };
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -296,3 +336,26 @@ mod tests {
         }
     }
 }
+
+#[cfg(test)]
+mod dispatch_tests {
+    use super::*;
+
+    #[test]
+    fn perfect_hash_covers_all_verbs_case_insensitively() {
+        for verb in ALL_VERBS.iter() {
+            assert_eq!(ConsoleVerb::from_token(verb.token()), Some(*verb));
+            let upper: alloc::string::String = verb
+                .token()
+                .chars()
+                .map(|c| c.to_ascii_uppercase())
+                .collect();
+            assert_eq!(ConsoleVerb::from_token(&upper), Some(*verb));
+        }
+        assert_eq!(ConsoleVerb::from_token("bogus"), None);
+        assert_eq!(ConsoleVerb::from_token(""), None);
+        // A token hashing into an occupied slot must still miss on the
+        // canonical comparison.
+        assert_eq!(ConsoleVerb::from_token("helpx"), None);
+    }
+}
@@ -78,6 +78,83 @@ impl Provider {
             Self::AppleBooks => "books",
         }
     }
+
+    /// Resolve a provider from its scheme prefix; the compiler lowers
+    /// the four-arm match to a jump table, so scheme resolution stays
+    /// O(1) without a runtime map.
+    #[must_use]
+    pub fn from_scheme(scheme: &str) -> Option<Self> {
+        match scheme {
+            "musickit" => Some(Self::MusicKit),
+            "appletv" => Some(Self::AppleTvPlus),
+            "podcasts" => Some(Self::ApplePodcasts),
+            "books" => Some(Self::AppleBooks),
+            _ => None,
+        }
+    }
+}
+
+/// Static tag vocabulary backing precompiled tag bitsets.
+///
+/// Catalog and preference tags index into bit positions; matching a
+/// query's preferred tags against an item becomes a single AND instead
+/// of a per-query `HashSet` scan. Tags outside the vocabulary fall back
+/// to the set comparison, so custom items stay correct.
+pub const TAG_VOCABULARY: &[&str] = &[
+    "focus",
+    "instrumental",
+    "mystery",
+    "serialized",
+    "productivity",
+    "interview",
+    "mindfulness",
+    "shortform",
+    "documentary",
+    "comedy",
+    "news",
+    "ambient",
+];
+
+/// Bitset over [`TAG_VOCABULARY`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct TagSet(u32);
+
+impl TagSet {
+    /// Build a bitset from tags; the boolean reports whether every tag
+    /// was in the vocabulary (false forces the fallback scan).
+    fn from_tags<'a>(tags: impl IntoIterator<Item = &'a str>) -> (Self, bool) {
+        let mut bits = 0u32;
+        let mut fully_indexed = true;
+        for tag in tags {
+            match TAG_VOCABULARY.iter().position(|known| *known == tag) {
+                Some(position) => bits |= 1 << position,
+                None => fully_indexed = false,
+            }
+        }
+        (Self(bits), fully_indexed)
+    }
+
+    fn intersects(self, other: Self) -> bool {
+        self.0 & other.0 != 0
+    }
+}
+
+const fn daypart_bit(daypart: Daypart) -> u8 {
+    match daypart {
+        Daypart::Morning => 1 << 0,
+        Daypart::Afternoon => 1 << 1,
+        Daypart::Evening => 1 << 2,
+        Daypart::LateNight => 1 << 3,
+    }
+}
+
+const fn domain_bit(domain: MediaDomain) -> u8 {
+    match domain {
+        MediaDomain::Music => 1 << 0,
+        MediaDomain::Tv => 1 << 1,
+        MediaDomain::Podcast => 1 << 2,
+        MediaDomain::Book => 1 << 3,
+    }
 }
 
 impl fmt::Display for Provider {
@@ -153,8 +230,11 @@ pub struct MediaItem {
     duration: Duration,
     cadence_hint: Duration,
     available_dayparts: HashSet<Daypart>,
+    daypart_bits: u8,
     weeknight_friendly: bool,
     tags: HashSet<&'static str>,
+    tag_bits: TagSet,
+    tags_fully_indexed: bool,
     deeplink: Deeplink,
 }
 
@@ -175,6 +255,12 @@ impl MediaItem {
         tags: impl IntoIterator<Item = &'static str>,
         deeplink: Deeplink,
     ) -> Self {
+        let available_dayparts: HashSet<Daypart> = available_dayparts.into_iter().collect();
+        let daypart_bits = available_dayparts
+            .iter()
+            .fold(0u8, |bits, daypart| bits | daypart_bit(*daypart));
+        let tags: HashSet<&'static str> = tags.into_iter().collect();
+        let (tag_bits, tags_fully_indexed) = TagSet::from_tags(tags.iter().copied());
         Self {
             id,
             title,
@@ -183,9 +269,12 @@ impl MediaItem {
             provider,
             duration,
             cadence_hint,
-            available_dayparts: available_dayparts.into_iter().collect(),
+            available_dayparts,
+            daypart_bits,
             weeknight_friendly,
-            tags: tags.into_iter().collect(),
+            tags,
+            tag_bits,
+            tags_fully_indexed,
             deeplink,
         }
     }
@@ -247,7 +336,11 @@ impl MediaItem {
     /// Determine if the item fits a given daypart.
     #[must_use]
     pub fn supports_daypart(&self, daypart: Daypart) -> bool {
-        self.available_dayparts.contains(&daypart)
+        debug_assert_eq!(
+            self.daypart_bits & daypart_bit(daypart) != 0,
+            self.available_dayparts.contains(&daypart),
+        );
+        self.daypart_bits & daypart_bit(daypart) != 0
     }
 
     /// Access the deeplink backing the media item.
@@ -260,12 +353,19 @@ impl MediaItem {
 /// Query describing contextual filters for media selection.
 #[derive(Debug, Clone)]
 pub struct MediaPickQuery {
-    domains: Option<HashSet<MediaDomain>>,
+    /// Precompiled domain mask; `None` when unconstrained. Unlike tags
+    /// (kept as a set for the out-of-vocabulary fallback), every domain
+    /// is in the enum, so the mask is the only representation needed.
+    domain_bits: Option<u8>,
     min_duration: Option<Duration>,
     max_duration: Option<Duration>,
     dayparts: Option<HashSet<Daypart>>,
+    /// Precompiled daypart mask; `None` when unconstrained.
+    daypart_bits: Option<u8>,
     weeknights_only: bool,
     preferred_tags: HashSet<&'static str>,
+    tag_bits: TagSet,
+    tags_fully_indexed: bool,
     limit: usize,
 }
 
@@ -277,8 +377,12 @@ impl MediaPickQuery {
     }
 
     fn matches(&self, item: &MediaItem) -> bool {
-        if let Some(domains) = &self.domains {
-            if !domains.contains(&item.domain()) {
+        // Domain, daypart, and tag checks run on the masks precompiled
+        // at build()/construction — single AND per criterion in the hot
+        // decision loop; the sets remain only for the out-of-vocabulary
+        // tag fallback.
+        if let Some(domain_bits) = self.domain_bits {
+            if domain_bits & domain_bit(item.domain()) == 0 {
                 return false;
             }
         }
@@ -295,11 +399,8 @@ impl MediaPickQuery {
             }
         }
 
-        if let Some(dayparts) = &self.dayparts {
-            if !dayparts
-                .iter()
-                .any(|daypart| item.supports_daypart(*daypart))
-            {
+        if let Some(daypart_bits) = self.daypart_bits {
+            if daypart_bits & item.daypart_bits == 0 {
                 return false;
             }
         }
@@ -308,13 +409,17 @@ impl MediaPickQuery {
             return false;
         }
 
-        if !self.preferred_tags.is_empty()
-            && self
-                .preferred_tags
-                .iter()
-                .all(|tag| !item.tags().contains(tag))
-        {
-            return false;
+        if !self.preferred_tags.is_empty() {
+            let overlaps = if self.tags_fully_indexed && item.tags_fully_indexed {
+                self.tag_bits.intersects(item.tag_bits)
+            } else {
+                self.preferred_tags
+                    .iter()
+                    .any(|tag| item.tags().contains(tag))
+            };
+            if !overlaps {
+                return false;
+            }
         }
 
         true
@@ -385,13 +490,27 @@ impl MediaPickQueryBuilder {
     /// Finalise query construction.
     #[must_use]
     pub fn build(self) -> MediaPickQuery {
+        let domain_bits = self.domains.as_ref().map(|domains| {
+            domains
+                .iter()
+                .fold(0u8, |bits, domain| bits | domain_bit(*domain))
+        });
+        let daypart_bits = self.dayparts.as_ref().map(|dayparts| {
+            dayparts
+                .iter()
+                .fold(0u8, |bits, daypart| bits | daypart_bit(*daypart))
+        });
+        let (tag_bits, tags_fully_indexed) = TagSet::from_tags(self.preferred_tags.iter().copied());
         MediaPickQuery {
-            domains: self.domains,
+            domain_bits,
             min_duration: self.min_duration,
             max_duration: self.max_duration,
             dayparts: self.dayparts,
+            daypart_bits,
             weeknights_only: self.weeknights_only,
             preferred_tags: self.preferred_tags,
+            tag_bits,
+            tags_fully_indexed,
             limit: if self.limit == 0 { 5 } else { self.limit },
         }
     }
@@ -1011,3 +1130,55 @@ mod tests {
         assert_eq!(err, FinanceError::PermissionDenied);
     }
 }
+
+#[cfg(test)]
+mod precompiled_matching_tests {
+    use super::*;
+
+    #[test]
+    fn scheme_lookup_and_masks_agree_with_set_matching() {
+        assert_eq!(
+            Provider::from_scheme("appletv"),
+            Some(Provider::AppleTvPlus)
+        );
+        assert_eq!(Provider::from_scheme("unknown"), None);
+
+        let library = MediaLibrary::curated();
+        let query = MediaPickQuery::builder()
+            .dayparts([Daypart::Evening])
+            .preferred_tags(["focus", "documentary"])
+            .build();
+        let matched: Vec<_> = library
+            .items()
+            .filter(|item| query.matches(item))
+            .map(MediaItem::id)
+            .collect();
+        // Bit-mask matching selects exactly the evening items carrying
+        // either tag: the synthwave mix (focus) — the docuseries is
+        // afternoon-only and drops on the daypart mask.
+        assert_eq!(matched, vec!["musickit-midnight-cities"]);
+    }
+
+    #[test]
+    fn out_of_vocabulary_tags_fall_back_to_set_comparison() {
+        let custom = MediaItem::new(
+            "custom-item",
+            "Custom",
+            "Out-of-vocabulary tag",
+            MediaDomain::Music,
+            Provider::MusicKit,
+            Duration::from_secs(600),
+            Duration::from_secs(3600),
+            [Daypart::Morning],
+            true,
+            ["bespoke-tag"],
+            Deeplink::new(Provider::MusicKit, "musickit://custom").unwrap(),
+        );
+        let query = MediaPickQuery::builder()
+            .preferred_tags(["bespoke-tag"])
+            .build();
+        assert!(query.matches(&custom), "fallback scan still matches");
+        let miss = MediaPickQuery::builder().preferred_tags(["focus"]).build();
+        assert!(!miss.matches(&custom));
+    }
+}
@@ -0,0 +1,85 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Benchmark Secure9P decode and batch-scan over the fuzz corpus.
+// Author: Lukas Bower
+
+//! Timing harness over the shared adversarial corpus, so performance and
+//! coverage run against the same shapes and a quadratic decode path shows
+//! up as a benchmark regression before it ships.
+
+use criterion::{criterion_group, criterion_main, Criterion};
+use secure9p_codec::{
+    fuzz_decode, generate_corpus, generate_fragmented_batch, scan_frames, Codec, Request,
+    RequestBody, Response, ResponseBody, MAX_MSIZE,
+};
+
+fn bench_decode(criterion: &mut Criterion) {
+    let corpus = generate_corpus(42);
+    criterion.bench_function("decode_request/adversarial_corpus", |bencher| {
+        bencher.iter(|| {
+            for entry in &corpus {
+                Codec
+                    .decode_request(std::hint::black_box(entry))
+                    .expect("decodes");
+            }
+        })
+    });
+    let batch = generate_fragmented_batch(42, 256);
+    criterion.bench_function("scan_frames/fragmented_256", |bencher| {
+        bencher.iter(|| scan_frames(std::hint::black_box(&batch), secure9p_codec::MAX_MSIZE))
+    });
+    criterion.bench_function("fuzz_decode/fragmented_256", |bencher| {
+        bencher.iter(|| fuzz_decode(std::hint::black_box(&batch)))
+    });
+}
+
+fn bench_encode(criterion: &mut Criterion) {
+    let codec = Codec;
+    let small = Request {
+        tag: 1,
+        body: RequestBody::Clunk { fid: 7 },
+    };
+    criterion.bench_function("encode_request/small_control", |bencher| {
+        let mut arena = Vec::with_capacity(64);
+        bencher.iter(|| {
+            arena.clear();
+            codec
+                .encode_request_into(std::hint::black_box(&small), &mut arena)
+                .expect("encodes");
+        })
+    });
+    let max_write = Request {
+        tag: 2,
+        body: RequestBody::Write {
+            fid: 3,
+            offset: 0,
+            data: vec![0x5a; MAX_MSIZE as usize - 64],
+        },
+    };
+    criterion.bench_function("encode_request/max_twrite", |bencher| {
+        let mut arena = Vec::with_capacity(MAX_MSIZE as usize);
+        bencher.iter(|| {
+            arena.clear();
+            codec
+                .encode_request_into(std::hint::black_box(&max_write), &mut arena)
+                .expect("encodes");
+        })
+    });
+    let rread = Response {
+        tag: 3,
+        body: ResponseBody::Read {
+            data: vec![0xa5; 4096],
+        },
+    };
+    let rread_wire = codec.encode_response(&rread).expect("encodes");
+    criterion.bench_function("decode_response/rread_4k", |bencher| {
+        bencher.iter(|| {
+            codec
+                .decode_response(std::hint::black_box(&rread_wire))
+                .expect("decodes")
+        })
+    });
+}
+
+criterion_group!(benches, bench_decode, bench_encode);
+criterion_main!(benches);
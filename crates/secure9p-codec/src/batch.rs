@@ -109,3 +109,91 @@ impl<'a> Iterator for BatchIter<'a> {
         Some(Ok(frame))
     }
 }
+
+/// Scan a batch into frame spans in one tight pass.
+///
+/// The frame chain is a serial dependency (each length prefix locates the
+/// next), so SIMD gathers cannot parallelise it; what this pass removes is
+/// the per-frame iterator/enum overhead and repeated slice re-borrowing of
+/// [`BatchIter`]. Bounds and the `max_frame` ceiling are checked with two
+/// predictable comparisons per frame, and the whole burst either validates
+/// into spans or fails before any decode work starts.
+pub fn scan_frames(
+    buffer: &[u8],
+    max_frame: u32,
+) -> Result<alloc::vec::Vec<core::ops::Range<usize>>, CodecError> {
+    let mut spans = alloc::vec::Vec::with_capacity(buffer.len() / 16 + 1);
+    let mut offset = 0usize;
+    let len = buffer.len();
+    while offset < len {
+        if len - offset < 4 {
+            return Err(CodecError::Truncated);
+        }
+        let declared = u32::from_le_bytes(
+            buffer[offset..offset + 4]
+                .try_into()
+                .expect("length slice checked"),
+        );
+        if declared < 5 || declared > max_frame {
+            return Err(if declared > max_frame {
+                CodecError::FrameTooLarge {
+                    declared,
+                    max: max_frame,
+                }
+            } else {
+                CodecError::LengthMismatch {
+                    declared,
+                    actual: len,
+                }
+            });
+        }
+        let end = offset + declared as usize;
+        if end > len {
+            return Err(CodecError::Truncated);
+        }
+        spans.push(offset..end);
+        offset = end;
+    }
+    Ok(spans)
+}
+
+#[cfg(test)]
+mod scan_tests {
+    extern crate std;
+    use super::*;
+    use std::vec::Vec;
+
+    fn frame(len: u32) -> Vec<u8> {
+        let mut out = Vec::new();
+        out.extend_from_slice(&len.to_le_bytes());
+        out.push(100);
+        out.resize(len as usize, 0xaa);
+        out
+    }
+
+    #[test]
+    fn scan_matches_iterator_and_validates_whole_burst() {
+        let mut batch = Vec::new();
+        for len in [16u32, 5, 64] {
+            batch.extend_from_slice(&frame(len));
+        }
+        let spans = scan_frames(&batch, 128).expect("scan");
+        let iterated: Vec<_> = BatchIter::with_max_frame(&batch, 128)
+            .map(|frame| frame.expect("frame").bytes().len())
+            .collect();
+        assert_eq!(
+            spans.iter().map(|span| span.len()).collect::<Vec<_>>(),
+            iterated
+        );
+        assert!(matches!(
+            scan_frames(&batch, 32),
+            Err(CodecError::FrameTooLarge { declared: 64, .. })
+        ));
+        let mut truncated = batch.clone();
+        truncated.truncate(batch.len() - 3);
+        assert!(matches!(
+            scan_frames(&truncated, 128),
+            Err(CodecError::Truncated)
+        ));
+    }
+}
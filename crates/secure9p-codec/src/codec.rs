@@ -5,9 +5,7 @@
 
 //! Encode/decode helpers for Secure9P wire messages.
 
-use alloc::borrow::ToOwned;
-use alloc::string::{String, ToString};
-use alloc::vec;
+use alloc::string::ToString;
 use alloc::vec::Vec;
 use core::str;
 
@@ -60,19 +58,58 @@ impl TryFrom<u8> for MessageType {
     }
 }
 
+/// Fixed-size body prefix per message type: the bytes that must be present
+/// after the tag before any variable-length field begins. Decode validates
+/// this once per message against the table, so the fixed portion of every
+/// message is bounds-checked with a single predictable comparison instead
+/// of a branch per field; variable fields (strings, payloads) keep their
+/// own length checks.
+const fn fixed_body_len(ty: MessageType) -> usize {
+    match ty {
+        MessageType::Tversion => 4 + 2, // msize + version length
+        MessageType::Rversion => 4 + 2,
+        MessageType::Tattach => 4 + 4 + 2, // fid + afid + uname length
+        MessageType::Rattach => 13,        // qid
+        MessageType::Twalk => 4 + 4 + 2,   // fid + newfid + nwname
+        MessageType::Rwalk => 2,           // nwqid
+        MessageType::Topen => 4 + 1,       // fid + mode
+        MessageType::Ropen => 13 + 4,      // qid + iounit
+        MessageType::Tread => 4 + 8 + 4,   // fid + offset + count
+        MessageType::Rread => 4,           // count
+        MessageType::Twrite => 4 + 8 + 4,  // fid + offset + count
+        MessageType::Rwrite => 4,          // count
+        MessageType::Tclunk => 4,          // fid
+        MessageType::Rclunk => 0,
+        MessageType::Rerror => 2, // code length
+    }
+}
+
 /// Encode/decode helper used by NineDoor integration tests.
 pub struct Codec;
 
 impl Codec {
     /// Encode a request into its wire representation.
     pub fn encode_request(&self, request: &Request) -> Result<Vec<u8>, CodecError> {
-        let mut payload = Vec::new();
-        payload.extend_from_slice(&request.tag.to_le_bytes());
+        let mut buffer = Vec::with_capacity(encoded_request_len(request));
+        self.encode_request_into(request, &mut buffer)?;
+        Ok(buffer)
+    }
+
+    /// Append a request frame to `out` without an intermediate payload
+    /// buffer, so pipelined sessions encode straight into a reusable
+    /// ring/arena buffer. Combine with [`encoded_request_len`] to reserve
+    /// exact capacity up front and avoid mid-encode reallocation.
+    pub fn encode_request_into(
+        &self,
+        request: &Request,
+        out: &mut Vec<u8>,
+    ) -> Result<(), CodecError> {
         match &request.body {
             RequestBody::Version { msize, version } => {
-                payload.extend_from_slice(&msize.to_le_bytes());
-                put_string(&mut payload, version);
-                Ok(finish(MessageType::Tversion, &payload))
+                let mut frame = begin_frame(out, MessageType::Tversion, request.tag);
+                frame.put(&msize.to_le_bytes());
+                frame.put_string(version);
+                frame.finish();
             }
             RequestBody::Attach {
                 fid,
@@ -81,20 +118,19 @@ impl Codec {
                 aname,
                 n_uname,
             } => {
-                payload.extend_from_slice(&fid.to_le_bytes());
-                payload.extend_from_slice(&afid.to_le_bytes());
-                put_string(&mut payload, uname);
-                put_string(&mut payload, aname);
-                payload.extend_from_slice(&n_uname.to_le_bytes());
-                Ok(finish(MessageType::Tattach, &payload))
+                let mut frame = begin_frame(out, MessageType::Tattach, request.tag);
+                frame.put(&fid.to_le_bytes());
+                frame.put(&afid.to_le_bytes());
+                frame.put_string(uname);
+                frame.put_string(aname);
+                frame.put(&n_uname.to_le_bytes());
+                frame.finish();
             }
             RequestBody::Walk {
                 fid,
                 newfid,
                 wnames,
             } => {
-                payload.extend_from_slice(&fid.to_le_bytes());
-                payload.extend_from_slice(&newfid.to_le_bytes());
                 let count: u16 = wnames
                     .len()
                     .try_into()
@@ -102,27 +138,32 @@ impl Codec {
                 if count as usize > 8 {
                     return Err(CodecError::InvalidPath);
                 }
-                payload.extend_from_slice(&count.to_le_bytes());
                 for name in wnames {
                     validate_component(name)?;
-                    put_string(&mut payload, name);
                 }
-                Ok(finish(MessageType::Twalk, &payload))
+                let mut frame = begin_frame(out, MessageType::Twalk, request.tag);
+                frame.put(&fid.to_le_bytes());
+                frame.put(&newfid.to_le_bytes());
+                frame.put(&count.to_le_bytes());
+                for name in wnames {
+                    frame.put_string(name);
+                }
+                frame.finish();
             }
             RequestBody::Open { fid, mode } => {
-                payload.extend_from_slice(&fid.to_le_bytes());
-                payload.push((*mode).into());
-                Ok(finish(MessageType::Topen, &payload))
+                let mut frame = begin_frame(out, MessageType::Topen, request.tag);
+                frame.put(&fid.to_le_bytes());
+                frame.put(&[(*mode).into()]);
+                frame.finish();
             }
             RequestBody::Read { fid, offset, count } => {
-                payload.extend_from_slice(&fid.to_le_bytes());
-                payload.extend_from_slice(&offset.to_le_bytes());
-                payload.extend_from_slice(&count.to_le_bytes());
-                Ok(finish(MessageType::Tread, &payload))
+                let mut frame = begin_frame(out, MessageType::Tread, request.tag);
+                frame.put(&fid.to_le_bytes());
+                frame.put(&offset.to_le_bytes());
+                frame.put(&count.to_le_bytes());
+                frame.finish();
             }
             RequestBody::Write { fid, offset, data } => {
-                payload.extend_from_slice(&fid.to_le_bytes());
-                payload.extend_from_slice(&offset.to_le_bytes());
                 let count: u32 = data
                     .len()
                     .try_into()
@@ -130,87 +171,115 @@ impl Codec {
                         declared: u32::MAX,
                         actual: data.len(),
                     })?;
-                payload.extend_from_slice(&count.to_le_bytes());
-                payload.extend_from_slice(data);
-                Ok(finish(MessageType::Twrite, &payload))
+                let mut frame = begin_frame(out, MessageType::Twrite, request.tag);
+                frame.put(&fid.to_le_bytes());
+                frame.put(&offset.to_le_bytes());
+                frame.put(&count.to_le_bytes());
+                frame.put(data);
+                frame.finish();
             }
             RequestBody::Clunk { fid } => {
-                payload.extend_from_slice(&fid.to_le_bytes());
-                Ok(finish(MessageType::Tclunk, &payload))
+                let mut frame = begin_frame(out, MessageType::Tclunk, request.tag);
+                frame.put(&fid.to_le_bytes());
+                frame.finish();
             }
         }
+        Ok(())
     }
 
     /// Encode a response into its wire representation.
     pub fn encode_response(&self, response: &Response) -> Result<Vec<u8>, CodecError> {
-        let mut payload = Vec::new();
-        payload.extend_from_slice(&response.tag.to_le_bytes());
+        let mut buffer = Vec::new();
+        self.encode_response_into(response, &mut buffer)?;
+        Ok(buffer)
+    }
+
+    /// Append a response frame to `out` without building an intermediate
+    /// payload buffer. Bulk payloads (`Rread`) are copied exactly once, from
+    /// the response body straight into the output buffer, so callers can batch
+    /// many frames into a single pooled buffer.
+    pub fn encode_response_into(
+        &self,
+        response: &Response,
+        out: &mut Vec<u8>,
+    ) -> Result<(), CodecError> {
         match &response.body {
             ResponseBody::Version { msize, version } => {
-                payload.extend_from_slice(&msize.to_le_bytes());
-                put_string(&mut payload, version);
-                Ok(finish(MessageType::Rversion, &payload))
+                let mut frame = begin_frame(out, MessageType::Rversion, response.tag);
+                frame.put(&msize.to_le_bytes());
+                frame.put_string(version);
+                frame.finish();
             }
             ResponseBody::Attach { qid } => {
-                put_qid(&mut payload, qid);
-                Ok(finish(MessageType::Rattach, &payload))
+                let mut frame = begin_frame(out, MessageType::Rattach, response.tag);
+                frame.put_qid(qid);
+                frame.finish();
             }
             ResponseBody::Walk { qids } => {
                 let count: u16 = qids.len().try_into().map_err(|_| CodecError::InvalidPath)?;
-                payload.extend_from_slice(&count.to_le_bytes());
+                let mut frame = begin_frame(out, MessageType::Rwalk, response.tag);
+                frame.put(&count.to_le_bytes());
                 for qid in qids {
-                    put_qid(&mut payload, qid);
+                    frame.put_qid(qid);
                 }
-                Ok(finish(MessageType::Rwalk, &payload))
+                frame.finish();
             }
             ResponseBody::Open { qid, iounit } => {
-                put_qid(&mut payload, qid);
-                payload.extend_from_slice(&iounit.to_le_bytes());
-                Ok(finish(MessageType::Ropen, &payload))
+                let mut frame = begin_frame(out, MessageType::Ropen, response.tag);
+                frame.put_qid(qid);
+                frame.put(&iounit.to_le_bytes());
+                frame.finish();
             }
             ResponseBody::Read { data } => {
-                let count: u32 = data
-                    .len()
-                    .try_into()
-                    .map_err(|_| CodecError::LengthMismatch {
-                        declared: u32::MAX,
-                        actual: data.len(),
-                    })?;
-                payload.extend_from_slice(&count.to_le_bytes());
-                payload.extend_from_slice(data);
-                Ok(finish(MessageType::Rread, &payload))
+                encode_rread_into(response.tag, data, out)?;
             }
             ResponseBody::Write { count } => {
-                payload.extend_from_slice(&count.to_le_bytes());
-                Ok(finish(MessageType::Rwrite, &payload))
+                let mut frame = begin_frame(out, MessageType::Rwrite, response.tag);
+                frame.put(&count.to_le_bytes());
+                frame.finish();
+            }
+            ResponseBody::Clunk => {
+                begin_frame(out, MessageType::Rclunk, response.tag).finish();
             }
-            ResponseBody::Clunk => Ok(finish(MessageType::Rclunk, &payload)),
             ResponseBody::Error { code, message } => {
-                put_string(&mut payload, &code.to_string());
-                put_string(&mut payload, message);
-                Ok(finish(MessageType::Rerror, &payload))
+                let mut frame = begin_frame(out, MessageType::Rerror, response.tag);
+                frame.put_string(&code.to_string());
+                frame.put_string(message);
+                frame.finish();
             }
         }
+        Ok(())
     }
 
     /// Decode a request from the wire representation.
     pub fn decode_request(&self, bytes: &[u8]) -> Result<Request, CodecError> {
+        Ok(self.decode_request_ref(bytes)?.to_owned())
+    }
+
+    /// Decode a request, borrowing strings and the Twrite payload from the
+    /// wire buffer. Large writes flow from the receive buffer to their sink
+    /// without an intermediate copy; callers that need ownership use
+    /// [`RequestRef::to_owned`].
+    pub fn decode_request_ref<'a>(&self, bytes: &'a [u8]) -> Result<RequestRef<'a>, CodecError> {
         let (ty, payload) = decode_message(bytes)?;
+        if payload.len() < 2 + fixed_body_len(ty) {
+            return Err(CodecError::Truncated);
+        }
         let mut cursor = Cursor::new(payload);
         let tag = read_u16(&mut cursor)?;
         let body = match ty {
             MessageType::Tversion => {
                 let msize = read_u32(&mut cursor)?;
-                let version = read_string(&mut cursor)?;
-                RequestBody::Version { msize, version }
+                let version = read_str(&mut cursor)?;
+                RequestBodyRef::Version { msize, version }
             }
             MessageType::Tattach => {
                 let fid = read_u32(&mut cursor)?;
                 let afid = read_u32(&mut cursor)?;
-                let uname = read_string(&mut cursor)?;
-                let aname = read_string(&mut cursor)?;
+                let uname = read_str(&mut cursor)?;
+                let aname = read_str(&mut cursor)?;
                 let n_uname = read_u32(&mut cursor)?;
-                RequestBody::Attach {
+                RequestBodyRef::Attach {
                     fid,
                     afid,
                     uname,
@@ -227,11 +296,11 @@ impl Codec {
                 }
                 let mut wnames = Vec::with_capacity(nwname);
                 for _ in 0..nwname {
-                    let name = read_string(&mut cursor)?;
-                    validate_component(&name)?;
+                    let name = read_str(&mut cursor)?;
+                    validate_component(name)?;
                     wnames.push(name);
                 }
-                RequestBody::Walk {
+                RequestBodyRef::Walk {
                     fid,
                     newfid,
                     wnames,
@@ -241,47 +310,53 @@ impl Codec {
                 let fid = read_u32(&mut cursor)?;
                 let raw_mode = read_u8(&mut cursor)?;
                 let mode = OpenMode::from_bits(raw_mode)?;
-                RequestBody::Open { fid, mode }
+                RequestBodyRef::Open { fid, mode }
             }
             MessageType::Tread => {
                 let fid = read_u32(&mut cursor)?;
                 let offset = read_u64(&mut cursor)?;
                 let count = read_u32(&mut cursor)?;
-                RequestBody::Read { fid, offset, count }
+                RequestBodyRef::Read { fid, offset, count }
             }
             MessageType::Twrite => {
                 let fid = read_u32(&mut cursor)?;
                 let offset = read_u64(&mut cursor)?;
                 let count = read_u32(&mut cursor)? as usize;
-                let mut data = vec![0u8; count];
-                cursor
-                    .read_exact(&mut data)
-                    .map_err(|_| CodecError::Truncated)?;
-                RequestBody::Write { fid, offset, data }
+                let data = cursor.take(count).map_err(|_| CodecError::Truncated)?;
+                RequestBodyRef::Write { fid, offset, data }
             }
             MessageType::Tclunk => {
                 let fid = read_u32(&mut cursor)?;
-                RequestBody::Clunk { fid }
+                RequestBodyRef::Clunk { fid }
             }
             other => return Err(CodecError::Unsupported(other as u8)),
         };
-        Ok(Request { tag, body })
+        Ok(RequestRef { tag, body })
     }
 
     /// Decode a response from the wire representation.
     pub fn decode_response(&self, bytes: &[u8]) -> Result<Response, CodecError> {
+        Ok(self.decode_response_ref(bytes)?.to_owned())
+    }
+
+    /// Decode a response, borrowing the Rread payload and string fields from
+    /// the wire buffer.
+    pub fn decode_response_ref<'a>(&self, bytes: &'a [u8]) -> Result<ResponseRef<'a>, CodecError> {
         let (ty, payload) = decode_message(bytes)?;
+        if payload.len() < 2 + fixed_body_len(ty) {
+            return Err(CodecError::Truncated);
+        }
         let mut cursor = Cursor::new(payload);
         let tag = read_u16(&mut cursor)?;
         let body = match ty {
             MessageType::Rversion => {
                 let msize = read_u32(&mut cursor)?;
-                let version = read_string(&mut cursor)?;
-                ResponseBody::Version { msize, version }
+                let version = read_str(&mut cursor)?;
+                ResponseBodyRef::Version { msize, version }
             }
             MessageType::Rattach => {
                 let qid = read_qid(&mut cursor)?;
-                ResponseBody::Attach { qid }
+                ResponseBodyRef::Attach { qid }
             }
             MessageType::Rwalk => {
                 let count = read_u16(&mut cursor)? as usize;
@@ -289,30 +364,27 @@ impl Codec {
                 for _ in 0..count {
                     qids.push(read_qid(&mut cursor)?);
                 }
-                ResponseBody::Walk { qids }
+                ResponseBodyRef::Walk { qids }
             }
             MessageType::Ropen => {
                 let qid = read_qid(&mut cursor)?;
                 let iounit = read_u32(&mut cursor)?;
-                ResponseBody::Open { qid, iounit }
+                ResponseBodyRef::Open { qid, iounit }
             }
             MessageType::Rread => {
                 let count = read_u32(&mut cursor)? as usize;
-                let mut data = vec![0u8; count];
-                cursor
-                    .read_exact(&mut data)
-                    .map_err(|_| CodecError::Truncated)?;
-                ResponseBody::Read { data }
+                let data = cursor.take(count).map_err(|_| CodecError::Truncated)?;
+                ResponseBodyRef::Read { data }
             }
             MessageType::Rwrite => {
                 let count = read_u32(&mut cursor)?;
-                ResponseBody::Write { count }
+                ResponseBodyRef::Write { count }
             }
-            MessageType::Rclunk => ResponseBody::Clunk,
+            MessageType::Rclunk => ResponseBodyRef::Clunk,
             MessageType::Rerror => {
-                let code_str = read_string(&mut cursor)?;
-                let message = read_string(&mut cursor)?;
-                let code = match code_str.as_str() {
+                let code_str = read_str(&mut cursor)?;
+                let message = read_str(&mut cursor)?;
+                let code = match code_str {
                     "Permission" => ErrorCode::Permission,
                     "NotFound" => ErrorCode::NotFound,
                     "Busy" => ErrorCode::Busy,
@@ -321,11 +393,11 @@ impl Codec {
                     "Closed" => ErrorCode::Closed,
                     _ => return Err(CodecError::InvalidUtf8),
                 };
-                ResponseBody::Error { code, message }
+                ResponseBodyRef::Error { code, message }
             }
             other => return Err(CodecError::Unsupported(other as u8)),
         };
-        Ok(Response { tag, body })
+        Ok(ResponseRef { tag, body })
     }
 }
 
@@ -339,28 +411,124 @@ pub fn encode_response(res: &Response) -> Result<Vec<u8>, CodecError> {
     Codec.encode_response(res)
 }
 
+/// Exact wire length of a request frame, for reserving buffer capacity.
+#[must_use]
+pub fn encoded_request_len(request: &Request) -> usize {
+    let body = match &request.body {
+        RequestBody::Version { version, .. } => 4 + 2 + version.len(),
+        RequestBody::Attach { uname, aname, .. } => 4 + 4 + 2 + uname.len() + 2 + aname.len() + 4,
+        RequestBody::Walk { wnames, .. } => {
+            4 + 4 + 2 + wnames.iter().map(|name| 2 + name.len()).sum::<usize>()
+        }
+        RequestBody::Open { .. } => 4 + 1,
+        RequestBody::Read { .. } => 4 + 8 + 4,
+        RequestBody::Write { data, .. } => 4 + 8 + 4 + data.len(),
+        RequestBody::Clunk { .. } => 4,
+    };
+    // size(4) + type(1) + tag(2) + body
+    7 + body
+}
+
+/// Exact wire length of a response frame, for reserving buffer capacity.
+#[must_use]
+pub fn encoded_response_len(response: &Response) -> usize {
+    let body = match &response.body {
+        ResponseBody::Version { version, .. } => 4 + 2 + version.len(),
+        ResponseBody::Attach { .. } => 13,
+        ResponseBody::Walk { qids } => 2 + qids.len() * 13,
+        ResponseBody::Open { .. } => 13 + 4,
+        ResponseBody::Read { data } => 4 + data.len(),
+        ResponseBody::Write { .. } => 4,
+        ResponseBody::Clunk => 0,
+        ResponseBody::Error { code, message } => {
+            let code_len = code.to_string().len();
+            2 + code_len + 2 + message.len()
+        }
+    };
+    7 + body
+}
+
+/// Append a response frame to `out` using the default codec.
+pub fn encode_response_into(res: &Response, out: &mut Vec<u8>) -> Result<(), CodecError> {
+    Codec.encode_response_into(res, out)
+}
+
+/// Append an `Rread` frame carrying a borrowed payload to `out`.
+///
+/// Servers answering Tread from ring or cache storage can hand the payload
+/// slice here directly; header fields and payload are appended as separate
+/// slices so the data is never staged in an intermediate `Vec`.
+pub fn encode_rread_into(tag: u16, data: &[u8], out: &mut Vec<u8>) -> Result<(), CodecError> {
+    let count: u32 = data
+        .len()
+        .try_into()
+        .map_err(|_| CodecError::LengthMismatch {
+            declared: u32::MAX,
+            actual: data.len(),
+        })?;
+    let mut frame = begin_frame(out, MessageType::Rread, tag);
+    frame.put(&count.to_le_bytes());
+    frame.put(data);
+    frame.finish();
+    Ok(())
+}
+
 /// Decode a request from a Secure9P wire frame using the default codec.
 pub fn decode_request(bytes: &[u8]) -> Result<Request, CodecError> {
     Codec.decode_request(bytes)
 }
 
+/// Decode a borrowed request view from a Secure9P wire frame.
+pub fn decode_request_ref(bytes: &[u8]) -> Result<RequestRef<'_>, CodecError> {
+    Codec.decode_request_ref(bytes)
+}
+
+/// Decode a borrowed response view from a Secure9P wire frame.
+pub fn decode_response_ref(bytes: &[u8]) -> Result<ResponseRef<'_>, CodecError> {
+    Codec.decode_response_ref(bytes)
+}
+
 /// Decode a response from a Secure9P wire frame using the default codec.
 pub fn decode_response(bytes: &[u8]) -> Result<Response, CodecError> {
     Codec.decode_response(bytes)
 }
 
-fn finish(ty: MessageType, payload: &[u8]) -> Vec<u8> {
-    let size = payload
-        .len()
-        .checked_add(5)
-        .expect("payload length overflow");
-    let mut buffer = Vec::with_capacity(size);
-    buffer.extend_from_slice(&(size as u32).to_le_bytes());
-    buffer.push(ty as u8);
-    buffer.extend_from_slice(payload);
-    buffer
+/// In-progress frame appended to a shared output buffer. The four size bytes
+/// are reserved up front and patched in `finish`, so body fields stream into
+/// the buffer without a staging copy.
+struct FrameBuilder<'a> {
+    out: &'a mut Vec<u8>,
+    start: usize,
 }
 
+impl FrameBuilder<'_> {
+    fn put(&mut self, bytes: &[u8]) {
+        self.out.extend_from_slice(bytes);
+    }
+
+    fn put_string(&mut self, value: &str) {
+        put_string(self.out, value);
+    }
+
+    fn put_qid(&mut self, qid: &Qid) {
+        put_qid(self.out, qid);
+    }
+
+    fn finish(self) {
+        let size = u32::try_from(self.out.len() - self.start).expect("frame length overflow");
+        self.out[self.start..self.start + 4].copy_from_slice(&size.to_le_bytes());
+    }
+}
+
+fn begin_frame(out: &mut Vec<u8>, ty: MessageType, tag: u16) -> FrameBuilder<'_> {
+    let start = out.len();
+    out.extend_from_slice(&[0u8; 4]);
+    out.push(ty as u8);
+    out.extend_from_slice(&tag.to_le_bytes());
+    FrameBuilder { out, start }
+}
+
+
 fn decode_message(bytes: &[u8]) -> Result<(MessageType, &[u8]), CodecError> {
     if bytes.len() < 5 {
         return Err(CodecError::Truncated);
@@ -415,14 +583,10 @@ fn read_u64(cursor: &mut Cursor<'_>) -> Result<u64, CodecError> {
     Ok(u64::from_le_bytes(buf))
 }
 
-fn read_string(cursor: &mut Cursor<'_>) -> Result<String, CodecError> {
+fn read_str<'a>(cursor: &mut Cursor<'a>) -> Result<&'a str, CodecError> {
     let len = read_u16(cursor)? as usize;
-    let mut buf = vec![0u8; len];
-    cursor
-        .read_exact(&mut buf)
-        .map_err(|_| CodecError::Truncated)?;
-    let text = str::from_utf8(&buf).map_err(|_| CodecError::InvalidUtf8)?;
-    Ok(text.to_owned())
+    let buf = cursor.take(len).map_err(|_| CodecError::Truncated)?;
+    str::from_utf8(buf).map_err(|_| CodecError::InvalidUtf8)
 }
 
 fn read_qid(cursor: &mut Cursor<'_>) -> Result<Qid, CodecError> {
@@ -473,11 +637,24 @@ impl<'a> Cursor<'a> {
         self.pos = end;
         Ok(())
     }
+
+    /// Borrow the next `len` bytes from the underlying buffer without copying.
+    fn take(&mut self, len: usize) -> Result<&'a [u8], ()> {
+        let end = self.pos.saturating_add(len);
+        if end > self.buf.len() {
+            return Err(());
+        }
+        let slice = &self.buf[self.pos..end];
+        self.pos = end;
+        Ok(slice)
+    }
 }
 
 #[cfg(test)]
 mod tests {
     use super::*;
+    use alloc::borrow::ToOwned;
+    use alloc::vec;
 
     #[test]
     fn reject_invalid_paths_during_encoding() {
@@ -512,6 +689,105 @@ mod tests {
         assert_eq!(codec.decode_request(&frame), Err(CodecError::InvalidPath));
     }
 
+    #[test]
+    fn encode_into_matches_owned_and_precomputed_lengths() {
+        let requests = vec![
+            Request {
+                tag: 1,
+                body: RequestBody::Version {
+                    msize: MAX_MSIZE,
+                    version: VERSION.to_string(),
+                },
+            },
+            Request {
+                tag: 2,
+                body: RequestBody::Walk {
+                    fid: 1,
+                    newfid: 2,
+                    wnames: vec!["queen".to_string(), "ctl".to_string()],
+                },
+            },
+            Request {
+                tag: 3,
+                body: RequestBody::Write {
+                    fid: 2,
+                    offset: 64,
+                    data: vec![9u8; 300],
+                },
+            },
+        ];
+        let codec = Codec;
+        let mut arena = Vec::new();
+        for request in &requests {
+            let owned = codec.encode_request(request).expect("encode");
+            assert_eq!(owned.len(), encoded_request_len(request));
+            let start = arena.len();
+            codec
+                .encode_request_into(request, &mut arena)
+                .expect("encode into");
+            assert_eq!(&arena[start..], owned.as_slice());
+        }
+        let response = Response {
+            tag: 7,
+            body: ResponseBody::Walk {
+                qids: vec![Qid::new(QidType::FILE, 1, 2); 3],
+            },
+        };
+        assert_eq!(
+            codec.encode_response(&response).expect("encode").len(),
+            encoded_response_len(&response)
+        );
+    }
+
+    #[test]
+    fn encode_rread_into_matches_owned_encoding() {
+        let codec = Codec;
+        let payload = vec![0xabu8; 1024];
+        let response = Response {
+            tag: 7,
+            body: ResponseBody::Read {
+                data: payload.clone(),
+            },
+        };
+        let owned = codec.encode_response(&response).expect("encode frame");
+        let mut buffer = vec![0x55u8; 3];
+        encode_rread_into(7, &payload, &mut buffer).expect("encode into buffer");
+        assert_eq!(&buffer[..3], &[0x55u8; 3]);
+        assert_eq!(&buffer[3..], owned.as_slice());
+        assert_eq!(codec.decode_response(&owned), Ok(response));
+    }
+
+    #[test]
+    fn borrowed_decode_points_into_wire_buffer() {
+        let codec = Codec;
+        let payload = vec![0x5au8; 512];
+        let frame = codec
+            .encode_request(&Request {
+                tag: 3,
+                body: RequestBody::Write {
+                    fid: 9,
+                    offset: 64,
+                    data: payload.clone(),
+                },
+            })
+            .expect("encode frame");
+        let decoded = codec.decode_request_ref(&frame).expect("decode borrowed");
+        let RequestBodyRef::Write { data, .. } = decoded.body else {
+            panic!("expected borrowed write");
+        };
+        assert_eq!(data, payload.as_slice());
+        let range = frame.as_ptr() as usize..frame.as_ptr() as usize + frame.len();
+        assert!(range.contains(&(data.as_ptr() as usize)));
+        assert_eq!(
+            decoded.to_owned().body,
+            RequestBody::Write {
+                fid: 9,
+                offset: 64,
+                data: payload,
+            }
+        );
+    }
+
     #[test]
     fn detect_truncated_frames() {
         let codec = Codec;
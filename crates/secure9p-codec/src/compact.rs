@@ -0,0 +1,211 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Compact header encoding for small Secure9P control messages.
+// Author: Lukas Bower
+
+//! Compact-header mode for trusted local links.
+//!
+//! Negotiated by offering [`COMPACT_VERSION`] at the version exchange, the
+//! compact form narrows the frame header for the small-message classes that
+//! dominate local traffic (clunks, read/write acks, short writes): a 2-byte
+//! size, 1-byte type, 1-byte tag, and 2-byte fid replace the full-width
+//! fields, cutting fixed overhead from 11-17 bytes to 6-8. Messages that
+//! do not fit the narrow fields (tags > 255, fids > 65535, jumbo payloads)
+//! must travel as standard frames; encoders return `None` so callers fall
+//! back transparently.
+
+use alloc::vec::Vec;
+
+use crate::{CodecError, Request, RequestBody, Response, ResponseBody};
+
+/// Version string offered to negotiate compact-header mode.
+pub const COMPACT_VERSION: &str = "9P2000.L-compact";
+
+const COMPACT_TCLUNK: u8 = 0x01;
+const COMPACT_RCLUNK: u8 = 0x02;
+const COMPACT_TWRITE: u8 = 0x03;
+const COMPACT_RWRITE: u8 = 0x04;
+const COMPACT_TREAD: u8 = 0x05;
+
+/// Encode a request in compact form when its fields fit the narrow widths.
+#[must_use]
+pub fn encode_compact_request(request: &Request) -> Option<Vec<u8>> {
+    let tag = u8::try_from(request.tag).ok()?;
+    let mut out = Vec::with_capacity(16);
+    match &request.body {
+        RequestBody::Clunk { fid } => {
+            let fid = u16::try_from(*fid).ok()?;
+            push_header(&mut out, 6, COMPACT_TCLUNK, tag);
+            out.extend_from_slice(&fid.to_le_bytes());
+        }
+        RequestBody::Write { fid, offset, data } => {
+            let fid = u16::try_from(*fid).ok()?;
+            let len = u16::try_from(data.len()).ok()?;
+            let offset = u32::try_from(*offset).ok()?;
+            push_header(&mut out, 6 + 4 + 2 + data.len() as u16, COMPACT_TWRITE, tag);
+            out.extend_from_slice(&fid.to_le_bytes());
+            out.extend_from_slice(&offset.to_le_bytes());
+            out.extend_from_slice(&len.to_le_bytes());
+            out.extend_from_slice(data);
+        }
+        RequestBody::Read { fid, offset, count } => {
+            let fid = u16::try_from(*fid).ok()?;
+            let offset = u32::try_from(*offset).ok()?;
+            let count = u16::try_from(*count).ok()?;
+            push_header(&mut out, 6 + 4 + 2, COMPACT_TREAD, tag);
+            out.extend_from_slice(&fid.to_le_bytes());
+            out.extend_from_slice(&offset.to_le_bytes());
+            out.extend_from_slice(&count.to_le_bytes());
+        }
+        _ => return None,
+    }
+    Some(out)
+}
+
+/// Encode a response in compact form when its fields fit.
+#[must_use]
+pub fn encode_compact_response(response: &Response) -> Option<Vec<u8>> {
+    let tag = u8::try_from(response.tag).ok()?;
+    let mut out = Vec::with_capacity(8);
+    match &response.body {
+        ResponseBody::Clunk => push_header(&mut out, 4, COMPACT_RCLUNK, tag),
+        ResponseBody::Write { count } => {
+            let count = u16::try_from(*count).ok()?;
+            push_header(&mut out, 6, COMPACT_RWRITE, tag);
+            out.extend_from_slice(&count.to_le_bytes());
+        }
+        _ => return None,
+    }
+    Some(out)
+}
+
+fn push_header(out: &mut Vec<u8>, size: u16, ty: u8, tag: u8) {
+    out.extend_from_slice(&size.to_le_bytes());
+    out.push(ty);
+    out.push(tag);
+}
+
+/// Decode a compact frame back into the standard representation.
+pub fn decode_compact_request(bytes: &[u8]) -> Result<Request, CodecError> {
+    let (ty, tag, body) = split_compact(bytes)?;
+    let request = match ty {
+        COMPACT_TCLUNK => Request {
+            tag,
+            body: RequestBody::Clunk {
+                fid: u32::from(take_u16(body, 0)?),
+            },
+        },
+        COMPACT_TWRITE => {
+            let fid = u32::from(take_u16(body, 0)?);
+            let offset = u64::from(take_u32(body, 2)?);
+            let len = usize::from(take_u16(body, 6)?);
+            let data = body.get(8..8 + len).ok_or(CodecError::Truncated)?;
+            Request {
+                tag,
+                body: RequestBody::Write {
+                    fid,
+                    offset,
+                    data: data.to_vec(),
+                },
+            }
+        }
+        COMPACT_TREAD => Request {
+            tag,
+            body: RequestBody::Read {
+                fid: u32::from(take_u16(body, 0)?),
+                offset: u64::from(take_u32(body, 2)?),
+                count: u32::from(take_u16(body, 6)?),
+            },
+        },
+        other => return Err(CodecError::Unsupported(other)),
+    };
+    Ok(request)
+}
+
+fn split_compact(bytes: &[u8]) -> Result<(u8, u16, &[u8]), CodecError> {
+    if bytes.len() < 4 {
+        return Err(CodecError::Truncated);
+    }
+    let size = u16::from_le_bytes([bytes[0], bytes[1]]) as usize;
+    if size != bytes.len() {
+        return Err(CodecError::LengthMismatch {
+            declared: size as u32,
+            actual: bytes.len(),
+        });
+    }
+    Ok((bytes[2], u16::from(bytes[3]), &bytes[4..]))
+}
+
+fn take_u16(body: &[u8], at: usize) -> Result<u16, CodecError> {
+    body.get(at..at + 2)
+        .map(|raw| u16::from_le_bytes([raw[0], raw[1]]))
+        .ok_or(CodecError::Truncated)
+}
+
+fn take_u32(body: &[u8], at: usize) -> Result<u32, CodecError> {
+    body.get(at..at + 4)
+        .map(|raw| u32::from_le_bytes([raw[0], raw[1], raw[2], raw[3]]))
+        .ok_or(CodecError::Truncated)
+}
+
+#[cfg(test)]
+mod tests {
+    extern crate std;
+    use super::*;
+    use crate::Codec;
+    use alloc::borrow::ToOwned;
+    use alloc::vec;
+
+    #[test]
+    fn small_messages_shrink_and_roundtrip() {
+        let clunk = Request {
+            tag: 5,
+            body: RequestBody::Clunk { fid: 42 },
+        };
+        let compact = encode_compact_request(&clunk).expect("compact clunk");
+        let standard = Codec.encode_request(&clunk).expect("standard clunk");
+        assert!(compact.len() * 10 <= standard.len() * 6, "expected ~40% cut");
+        assert_eq!(decode_compact_request(&compact).expect("decode"), clunk);
+
+        let write = Request {
+            tag: 9,
+            body: RequestBody::Write {
+                fid: 7,
+                offset: 128,
+                data: vec![1, 2, 3, 4],
+            },
+        };
+        let compact = encode_compact_request(&write).expect("compact write");
+        assert_eq!(decode_compact_request(&compact).expect("decode"), write);
+
+        let ack = Response {
+            tag: 9,
+            body: ResponseBody::Write { count: 4 },
+        };
+        let compact_ack = encode_compact_response(&ack).expect("compact ack");
+        let standard_ack = Codec.encode_response(&ack).expect("standard ack");
+        assert!(compact_ack.len() < standard_ack.len());
+    }
+
+    #[test]
+    fn wide_fields_fall_back_to_standard_frames() {
+        let wide_tag = Request {
+            tag: 300,
+            body: RequestBody::Clunk { fid: 1 },
+        };
+        assert!(encode_compact_request(&wide_tag).is_none());
+        let wide_fid = Request {
+            tag: 1,
+            body: RequestBody::Clunk { fid: 70_000 },
+        };
+        assert!(encode_compact_request(&wide_fid).is_none());
+        let version = Request {
+            tag: 1,
+            body: RequestBody::Version {
+                msize: 8192,
+                version: COMPACT_VERSION.to_owned(),
+            },
+        };
+        assert!(encode_compact_request(&version).is_none());
+    }
+}
@@ -17,10 +17,17 @@ extern crate std;
 
 mod batch;
 mod codec;
+
+/// Compact-header mode for trusted local links.
+pub mod compact;
 mod fuzz;
 mod types;
 
-pub use batch::{BatchFrame, BatchIter};
-pub use codec::{decode_request, decode_response, encode_request, encode_response, Codec};
-pub use fuzz::fuzz_decode;
+pub use batch::{scan_frames, BatchFrame, BatchIter};
+pub use codec::{
+    decode_request, decode_request_ref, decode_response, decode_response_ref,
+    encoded_request_len, encoded_response_len, encode_request, encode_response,
+    encode_response_into, encode_rread_into, Codec,
+};
+pub use fuzz::{fuzz_decode, generate_corpus, generate_fragmented_batch};
 pub use types::*;
@@ -8,12 +8,20 @@
 
 use core::fmt;
 
+use alloc::borrow::ToOwned;
 use alloc::string::String;
 use alloc::vec::Vec;
 
 /// Maximum message size negotiated by Secure9P.
 pub const MAX_MSIZE: u32 = 8192;
 
+/// Jumbo message size for bulk transfers (CAS bundles, model chunks).
+///
+/// Interactive sessions keep negotiating [`MAX_MSIZE`]; clients moving bulk
+/// data may request up to this bound and servers clamp to it, turning tens of
+/// thousands of small Rreads into wire-speed 1 MiB frames.
+pub const JUMBO_MSIZE: u32 = 1024 * 1024;
+
 /// Protocol version string.
 pub const VERSION: &str = "9P2000.L";
 
@@ -337,6 +345,135 @@ pub struct Response {
     pub body: ResponseBody,
 }
 
+/// Request envelope borrowing string and payload fields from the wire buffer.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct RequestRef<'a> {
+    /// Request identifier, echoed back by responses.
+    pub tag: u16,
+    /// The concrete request payload, borrowing from the receive buffer.
+    pub body: RequestBodyRef<'a>,
+}
+
+impl RequestRef<'_> {
+    /// Copy the borrowed request into an owned [`Request`].
+    #[must_use]
+    pub fn to_owned(&self) -> Request {
+        use alloc::borrow::ToOwned as _;
+        let body = match &self.body {
+            RequestBodyRef::Version { msize, version } => RequestBody::Version {
+                msize: *msize,
+                version: (*version).to_owned(),
+            },
+            RequestBodyRef::Attach {
+                fid,
+                afid,
+                uname,
+                aname,
+                n_uname,
+            } => RequestBody::Attach {
+                fid: *fid,
+                afid: *afid,
+                uname: (*uname).to_owned(),
+                aname: (*aname).to_owned(),
+                n_uname: *n_uname,
+            },
+            RequestBodyRef::Walk {
+                fid,
+                newfid,
+                wnames,
+            } => RequestBody::Walk {
+                fid: *fid,
+                newfid: *newfid,
+                wnames: wnames.iter().map(|name| (*name).to_owned()).collect(),
+            },
+            RequestBodyRef::Open { fid, mode } => RequestBody::Open {
+                fid: *fid,
+                mode: *mode,
+            },
+            RequestBodyRef::Read { fid, offset, count } => RequestBody::Read {
+                fid: *fid,
+                offset: *offset,
+                count: *count,
+            },
+            RequestBodyRef::Write { fid, offset, data } => RequestBody::Write {
+                fid: *fid,
+                offset: *offset,
+                data: (*data).to_owned(),
+            },
+            RequestBodyRef::Clunk { fid } => RequestBody::Clunk { fid: *fid },
+        };
+        Request {
+            tag: self.tag,
+            body,
+        }
+    }
+}
+
+/// Request variants borrowing payloads from the receive buffer so large
+/// Twrite bodies flow from the socket buffer to their sink without a copy.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub enum RequestBodyRef<'a> {
+    /// `Tversion` negotiates the message size and version string.
+    Version {
+        /// Requested maximum message size.
+        msize: u32,
+        /// Protocol version string supplied by the client.
+        version: &'a str,
+    },
+    /// `Tattach` binds a fid to the session root.
+    Attach {
+        /// Fid identifier associated with the session root.
+        fid: u32,
+        /// Authentication fid (unused in Secure9P).
+        afid: u32,
+        /// User name string provided by the client.
+        uname: &'a str,
+        /// Attachment name (namespace selector) supplied by the client.
+        aname: &'a str,
+        /// Numeric user identifier.
+        n_uname: u32,
+    },
+    /// `Twalk` traverses the namespace to produce a new fid.
+    Walk {
+        /// Source fid for the walk operation.
+        fid: u32,
+        /// Destination fid receiving the walk result.
+        newfid: u32,
+        /// Path components supplied by the client.
+        wnames: Vec<&'a str>,
+    },
+    /// `Topen` opens a fid for subsequent I/O operations.
+    Open {
+        /// Fid to open.
+        fid: u32,
+        /// Requested open mode.
+        mode: OpenMode,
+    },
+    /// `Tread` reads a range of bytes from a fid.
+    Read {
+        /// Fid to read from.
+        fid: u32,
+        /// Offset into the file.
+        offset: u64,
+        /// Number of bytes requested.
+        count: u32,
+    },
+    /// `Twrite` writes bytes to a fid.
+    Write {
+        /// Fid to write to.
+        fid: u32,
+        /// Offset within the file.
+        offset: u64,
+        /// Payload bytes borrowed from the receive buffer.
+        data: &'a [u8],
+    },
+    /// `Tclunk` closes a fid.
+    Clunk {
+        /// Fid identifier to close.
+        fid: u32,
+    },
+}
+
 /// Request variants supported by the current milestone.
 #[derive(Debug, Clone, PartialEq, Eq)]
 pub enum RequestBody {
@@ -401,6 +538,96 @@ pub enum RequestBody {
     },
 }
 
+/// Response envelope borrowing payload fields from the wire buffer.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct ResponseRef<'a> {
+    /// Response identifier (mirrors the request tag).
+    pub tag: u16,
+    /// The concrete response payload, borrowing from the receive buffer.
+    pub body: ResponseBodyRef<'a>,
+}
+
+impl ResponseRef<'_> {
+    /// Copy the borrowed response into an owned [`Response`].
+    #[must_use]
+    pub fn to_owned(&self) -> Response {
+        use alloc::borrow::ToOwned as _;
+        let body = match &self.body {
+            ResponseBodyRef::Version { msize, version } => ResponseBody::Version {
+                msize: *msize,
+                version: (*version).to_owned(),
+            },
+            ResponseBodyRef::Attach { qid } => ResponseBody::Attach { qid: *qid },
+            ResponseBodyRef::Walk { qids } => ResponseBody::Walk { qids: qids.clone() },
+            ResponseBodyRef::Open { qid, iounit } => ResponseBody::Open {
+                qid: *qid,
+                iounit: *iounit,
+            },
+            ResponseBodyRef::Read { data } => ResponseBody::Read {
+                data: (*data).to_owned(),
+            },
+            ResponseBodyRef::Write { count } => ResponseBody::Write { count: *count },
+            ResponseBodyRef::Clunk => ResponseBody::Clunk,
+            ResponseBodyRef::Error { code, message } => ResponseBody::Error {
+                code: *code,
+                message: (*message).to_owned(),
+            },
+        };
+        Response {
+            tag: self.tag,
+            body,
+        }
+    }
+}
+
+/// Response variants borrowing bulk payloads from the receive buffer.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub enum ResponseBodyRef<'a> {
+    /// Response to `Tversion` carrying the negotiated size and version.
+    Version {
+        /// Negotiated maximum message size.
+        msize: u32,
+        /// Protocol version string.
+        version: &'a str,
+    },
+    /// Response to `Tattach` containing the root Qid.
+    Attach {
+        /// Qid associated with the session root.
+        qid: Qid,
+    },
+    /// Response to `Twalk` containing the traversed Qids.
+    Walk {
+        /// Qids encountered during the walk.
+        qids: Vec<Qid>,
+    },
+    /// Response to `Topen` containing the opened Qid and I/O unit size.
+    Open {
+        /// Qid associated with the opened fid.
+        qid: Qid,
+        /// Maximum I/O payload size.
+        iounit: u32,
+    },
+    /// Response to `Tread` borrowing the payload bytes.
+    Read {
+        /// Data payload borrowed from the receive buffer.
+        data: &'a [u8],
+    },
+    /// Response to `Twrite` containing the write count.
+    Write {
+        /// Number of bytes written.
+        count: u32,
+    },
+    /// Response to `Tclunk` acknowledging the closure.
+    Clunk,
+    /// Error response containing a Secure9P error code and message.
+    Error {
+        /// Secure9P error code propagated to the client.
+        code: ErrorCode,
+        /// Human-readable message describing the error.
+        message: &'a str,
+    },
+}
+
 /// Response variants surfaced to clients.
 #[derive(Debug, Clone, PartialEq, Eq)]
 pub enum ResponseBody {
@@ -448,3 +675,97 @@ pub enum ResponseBody {
         message: String,
     },
 }
+
+/// Synthetic directory entry name serving readdir-plus listings.
+///
+/// Reading `<dir>/.dirplus` returns the directory's entries with
+/// inline qid/metadata records (see [`encode_dirplus_entries`]) so a
+/// listing costs `ceil(n / msize)` round trips instead of one read
+/// plus one stat-equivalent read per entry.
+pub const DIRPLUS_ENTRY: &str = ".dirplus";
+
+/// One readdir-plus record: entry name with inline qid and length.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct DirPlusEntry {
+    /// Entry name within the directory.
+    pub name: String,
+    /// Entry qid (type, version, path).
+    pub qid: Qid,
+    /// File length in bytes; zero for directories.
+    pub length: u64,
+}
+
+/// Encode readdir-plus records: per entry a little-endian `u16` name
+/// length, the UTF-8 name, qid type byte, `u32` version, `u64` path,
+/// and `u64` length. Records are dense and self-delimiting, so readers
+/// can decode any prefix that ends on a record boundary.
+#[must_use]
+pub fn encode_dirplus_entries(entries: &[DirPlusEntry]) -> Vec<u8> {
+    let mut out = Vec::new();
+    for entry in entries {
+        let name = entry.name.as_bytes();
+        out.extend_from_slice(&(name.len() as u16).to_le_bytes());
+        out.extend_from_slice(name);
+        out.push(entry.qid.ty().into());
+        out.extend_from_slice(&entry.qid.version().to_le_bytes());
+        out.extend_from_slice(&entry.qid.path().to_le_bytes());
+        out.extend_from_slice(&entry.length.to_le_bytes());
+    }
+    out
+}
+
+/// Decode readdir-plus records produced by [`encode_dirplus_entries`].
+pub fn decode_dirplus_entries(bytes: &[u8]) -> Result<Vec<DirPlusEntry>, CodecError> {
+    let mut entries = Vec::new();
+    let mut cursor = 0usize;
+    while cursor < bytes.len() {
+        let take = |cursor: &mut usize, len: usize| -> Result<&[u8], CodecError> {
+            let slice = bytes
+                .get(*cursor..*cursor + len)
+                .ok_or(CodecError::Truncated)?;
+            *cursor += len;
+            Ok(slice)
+        };
+        let name_len =
+            u16::from_le_bytes(take(&mut cursor, 2)?.try_into().expect("two bytes")) as usize;
+        let name = core::str::from_utf8(take(&mut cursor, name_len)?)
+            .map_err(|_| CodecError::InvalidUtf8)?
+            .to_owned();
+        let ty = QidType::from_raw(take(&mut cursor, 1)?[0]);
+        let version = u32::from_le_bytes(take(&mut cursor, 4)?.try_into().expect("four bytes"));
+        let path = u64::from_le_bytes(take(&mut cursor, 8)?.try_into().expect("eight bytes"));
+        let length = u64::from_le_bytes(take(&mut cursor, 8)?.try_into().expect("eight bytes"));
+        entries.push(DirPlusEntry {
+            name,
+            qid: Qid::new(ty, version, path),
+            length,
+        });
+    }
+    Ok(entries)
+}
+
+#[cfg(test)]
+mod dirplus_tests {
+    use super::*;
+    use alloc::vec;
+
+    #[test]
+    fn dirplus_records_round_trip_and_reject_torn_prefixes() {
+        let entries = vec![
+            DirPlusEntry {
+                name: "queen.log".to_owned(),
+                qid: Qid::new(QidType::APPEND_ONLY, 7, 0xfeed),
+                length: 4096,
+            },
+            DirPlusEntry {
+                name: "telemetry".to_owned(),
+                qid: Qid::new(QidType::DIRECTORY, 0, 0xbeef),
+                length: 0,
+            },
+        ];
+        let encoded = encode_dirplus_entries(&entries);
+        assert_eq!(decode_dirplus_entries(&encoded).unwrap(), entries);
+        assert!(decode_dirplus_entries(&encoded[..encoded.len() - 3]).is_err());
+        assert!(decode_dirplus_entries(&[]).unwrap().is_empty());
+    }
+}
@@ -10,6 +10,9 @@
 
 extern crate alloc;
 
+#[cfg(test)]
+extern crate std;
+
 use alloc::string::String;
 
 use cohesix_ticket::TicketClaims;
@@ -19,9 +22,10 @@ use thiserror::Error;
 mod session;
 
 pub use session::{
-    FidError, FidTable, QueueDepth, QueueError, SessionLimits, ShardedFidTable, ShortWritePolicy,
-    TagError, TagWindow, DEFAULT_FID_SHARDS, DEFAULT_SHORT_WRITE_BACKOFF_MS,
-    DEFAULT_SHORT_WRITE_RETRIES,
+    AtomicQueueDepth, AtomicTagWindow, CreditController, FidError, FidTable, QueueDepth,
+    QueueError, RetryPacer,
+    SessionLimits, ShardedFidTable, ShortWritePolicy, TagError, TagWindow, DEFAULT_FID_SHARDS,
+    DEFAULT_RETRY_BUDGET, DEFAULT_SHORT_WRITE_BACKOFF_MS, DEFAULT_SHORT_WRITE_RETRIES,
 };
 
 /// Errors surfaced by Secure9P access policy checks.
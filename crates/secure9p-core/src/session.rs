@@ -7,6 +7,7 @@
 
 use alloc::collections::{BTreeMap, BTreeSet};
 use alloc::vec::Vec;
+use core::sync::atomic::{AtomicU32, AtomicUsize, Ordering};
 
 use spin::Mutex;
 
@@ -195,6 +196,325 @@ impl QueueDepth {
     }
 }
 
+/// Default per-session retry budget for the adaptive pacer.
+pub const DEFAULT_RETRY_BUDGET: u32 = 64;
+
+/// Adaptive short-write retry pacer with decorrelated jitter.
+///
+/// The fixed exponential schedule retries every worker in lockstep after a
+/// queen hiccup; the pacer instead draws each delay uniformly from
+/// `[base, 3 * previous]` (AWS-style decorrelated jitter) seeded per
+/// session, and scales the base by the observed server latency EWMA so slow
+/// periods spread retries further apart. A per-session retry budget caps
+/// total attempts between successes, surfacing persistent failure instead
+/// of hammering a struggling server.
+#[derive(Debug, Clone)]
+pub struct RetryPacer {
+    policy: ShortWritePolicy,
+    /// Previous delay, feeding the decorrelated jitter recurrence.
+    previous_ms: u64,
+    /// EWMA of observed server latency in milliseconds.
+    latency_ewma_ms: u64,
+    /// Retries remaining until the next success resets the budget.
+    budget: u32,
+    rng_state: u64,
+}
+
+impl RetryPacer {
+    /// Create a pacer seeded per session (use the session id).
+    #[must_use]
+    pub fn new(policy: ShortWritePolicy, seed: u64) -> Self {
+        Self {
+            policy,
+            previous_ms: DEFAULT_SHORT_WRITE_BACKOFF_MS,
+            latency_ewma_ms: 0,
+            budget: DEFAULT_RETRY_BUDGET,
+            rng_state: seed | 1,
+        }
+    }
+
+    fn next_random(&mut self) -> u64 {
+        // xorshift64*: cheap, no_std, good enough to decorrelate sessions.
+        let mut x = self.rng_state;
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        self.rng_state = x;
+        x.wrapping_mul(0x2545_f491_4f6c_dd1d)
+    }
+
+    /// Record an observed request latency to scale future pacing.
+    pub fn observe_latency_ms(&mut self, latency_ms: u64) {
+        self.latency_ewma_ms = if self.latency_ewma_ms == 0 {
+            latency_ms
+        } else {
+            self.latency_ewma_ms - self.latency_ewma_ms / 4 + latency_ms / 4
+        };
+    }
+
+    /// Record a success, resetting the budget and the jitter recurrence.
+    pub fn record_success(&mut self) {
+        self.budget = DEFAULT_RETRY_BUDGET;
+        self.previous_ms = DEFAULT_SHORT_WRITE_BACKOFF_MS;
+    }
+
+    /// Delay before the next retry, or `None` when the policy rejects
+    /// retries or the session's budget is exhausted.
+    pub fn next_delay_ms(&mut self) -> Option<u64> {
+        if matches!(self.policy, ShortWritePolicy::Reject) {
+            return None;
+        }
+        if self.budget == 0 {
+            return None;
+        }
+        self.budget -= 1;
+        // Base scales with observed latency: a struggling server pushes the
+        // whole distribution out rather than concentrating retries.
+        let base = DEFAULT_SHORT_WRITE_BACKOFF_MS.max(self.latency_ewma_ms / 2);
+        let ceiling = (self.previous_ms.saturating_mul(3)).max(base + 1);
+        let span = ceiling - base;
+        let delay = base + self.next_random() % span.max(1);
+        self.previous_ms = delay;
+        Some(delay)
+    }
+}
+
+/// Slot value marking an empty [`AtomicTagWindow`] entry.
+const TAG_SLOT_EMPTY: u32 = 0;
+
+/// Lock-free tag window tracking in-flight tags with CAS-claimed slots.
+///
+/// Slots store `tag + 1` in a small atomic array (empty slots are zero), so
+/// reserve and release are a bounded scan plus one compare-exchange and two
+/// concurrent requests on the same session never serialize on a lock. The
+/// window is sized for the per-session tag limit, which stays small (16 by
+/// default), so the full-array scan is cheaper than any probing scheme.
+#[derive(Debug)]
+pub struct AtomicTagWindow {
+    slots: Vec<AtomicU32>,
+    active: AtomicUsize,
+    max_tags: u16,
+}
+
+impl AtomicTagWindow {
+    /// Create a new tag window with the specified maximum.
+    #[must_use]
+    pub fn new(max_tags: u16) -> Self {
+        let max_tags = max_tags.max(1);
+        let mut slots = Vec::with_capacity(max_tags as usize);
+        for _ in 0..max_tags {
+            slots.push(AtomicU32::new(TAG_SLOT_EMPTY));
+        }
+        Self {
+            slots,
+            active: AtomicUsize::new(0),
+            max_tags,
+        }
+    }
+
+    /// Attempt to reserve a tag within the window.
+    pub fn reserve(&self, tag: u16) -> Result<(), TagError> {
+        let marker = u32::from(tag) + 1;
+        // Claim budget first so concurrent reserves cannot exceed the window.
+        loop {
+            let current = self.active.load(Ordering::Acquire);
+            if current >= self.max_tags as usize {
+                return Err(TagError::WindowFull);
+            }
+            if self
+                .active
+                .compare_exchange_weak(current, current + 1, Ordering::AcqRel, Ordering::Acquire)
+                .is_ok()
+            {
+                break;
+            }
+        }
+        let mut claimed: Option<usize> = None;
+        for (idx, slot) in self.slots.iter().enumerate() {
+            let value = slot.load(Ordering::Acquire);
+            if value == marker {
+                // Tag already in flight (or a concurrent claim for the same
+                // tag beat us); roll the budget back.
+                if let Some(ours) = claimed {
+                    self.slots[ours].store(TAG_SLOT_EMPTY, Ordering::Release);
+                }
+                self.active.fetch_sub(1, Ordering::AcqRel);
+                return Err(TagError::InUse);
+            }
+            if claimed.is_none()
+                && value == TAG_SLOT_EMPTY
+                && slot
+                    .compare_exchange(TAG_SLOT_EMPTY, marker, Ordering::AcqRel, Ordering::Acquire)
+                    .is_ok()
+            {
+                claimed = Some(idx);
+            }
+        }
+        if claimed.is_some() {
+            return Ok(());
+        }
+        // Every slot was transiently occupied; treat as a full window.
+        self.active.fetch_sub(1, Ordering::AcqRel);
+        Err(TagError::WindowFull)
+    }
+
+    /// Release a tag from the window.
+    pub fn release(&self, tag: u16) {
+        let marker = u32::from(tag) + 1;
+        for slot in &self.slots {
+            if slot
+                .compare_exchange(marker, TAG_SLOT_EMPTY, Ordering::AcqRel, Ordering::Acquire)
+                .is_ok()
+            {
+                self.active.fetch_sub(1, Ordering::AcqRel);
+                return;
+            }
+        }
+    }
+
+    /// Return the number of active tags.
+    #[must_use]
+    pub fn active_count(&self) -> usize {
+        self.active.load(Ordering::Acquire)
+    }
+
+    /// Return the maximum tag count.
+    #[must_use]
+    pub fn max_tags(&self) -> u16 {
+        self.max_tags
+    }
+}
+
+/// Lock-free queue depth tracker sharing the [`QueueDepth`] API surface.
+#[derive(Debug)]
+pub struct AtomicQueueDepth {
+    max_depth: AtomicUsize,
+    current: AtomicUsize,
+}
+
+impl AtomicQueueDepth {
+    /// Create a new queue tracker.
+    #[must_use]
+    pub fn new(max_depth: usize) -> Self {
+        Self {
+            max_depth: AtomicUsize::new(max_depth.max(1)),
+            current: AtomicUsize::new(0),
+        }
+    }
+
+    /// Adjust the depth limit (credit grants); in-flight work is unaffected.
+    pub fn set_max_depth(&self, max_depth: usize) {
+        self.max_depth.store(max_depth.max(1), Ordering::Release);
+    }
+
+    /// Attempt to reserve queue depth for new work.
+    pub fn reserve(&self, count: usize) -> Result<(), QueueError> {
+        if count == 0 {
+            return Ok(());
+        }
+        loop {
+            let current = self.current.load(Ordering::Acquire);
+            if current.saturating_add(count) > self.max_depth.load(Ordering::Acquire) {
+                return Err(QueueError::Full);
+            }
+            if self
+                .current
+                .compare_exchange_weak(
+                    current,
+                    current + count,
+                    Ordering::AcqRel,
+                    Ordering::Acquire,
+                )
+                .is_ok()
+            {
+                return Ok(());
+            }
+        }
+    }
+
+    /// Release queue depth for completed work.
+    pub fn release(&self, count: usize) {
+        let mut remaining = count;
+        while remaining > 0 {
+            let current = self.current.load(Ordering::Acquire);
+            let take = remaining.min(current);
+            if take == 0 {
+                return;
+            }
+            if self
+                .current
+                .compare_exchange_weak(current, current - take, Ordering::AcqRel, Ordering::Acquire)
+                .is_ok()
+            {
+                remaining -= take;
+            }
+        }
+    }
+
+    /// Return the current queue depth.
+    #[must_use]
+    pub fn current(&self) -> usize {
+        self.current.load(Ordering::Acquire)
+    }
+
+    /// Return the maximum queue depth.
+    #[must_use]
+    pub fn max_depth(&self) -> usize {
+        self.max_depth.load(Ordering::Acquire)
+    }
+}
+
+/// Credit controller granting per-session queue depth from drain rate.
+///
+/// A fast LAN worker that drains its window every batch earns more credits
+/// (up to the tag budget); a distant or slow consumer that leaves work
+/// queued decays back toward the floor. Fed from the server's completion
+/// accounting, it replaces one static depth for every session with windows
+/// matched to each session's observed throughput.
+#[derive(Debug, Clone)]
+pub struct CreditController {
+    floor: usize,
+    ceiling: usize,
+    credits: usize,
+    /// EWMA of completions per grant interval, in 1/8 units.
+    drain_ewma_eighths: usize,
+}
+
+impl CreditController {
+    /// Create a controller bounded by `[floor, ceiling]` starting at floor.
+    #[must_use]
+    pub fn new(floor: usize, ceiling: usize) -> Self {
+        let floor = floor.max(1);
+        Self {
+            floor,
+            ceiling: ceiling.max(floor),
+            credits: floor,
+            drain_ewma_eighths: 0,
+        }
+    }
+
+    /// Record completions since the last grant and return the new credit.
+    pub fn grant(&mut self, completed: usize, still_queued: usize) -> usize {
+        self.drain_ewma_eighths =
+            self.drain_ewma_eighths - self.drain_ewma_eighths / 4 + completed * 2;
+        let drained_fully = still_queued == 0 && completed > 0;
+        if drained_fully && completed >= self.credits {
+            // The session consumed its whole window: grow it.
+            self.credits = (self.credits * 2).min(self.ceiling);
+        } else if still_queued > 0 {
+            // Work is sitting in the queue: the window is too generous.
+            self.credits = (self.credits / 2).max(self.floor);
+        }
+        self.credits
+    }
+
+    /// Current credit grant.
+    #[must_use]
+    pub fn credits(&self) -> usize {
+        self.credits
+    }
+}
+
 /// Minimal fid table wrapper for Secure9P sessions.
 #[derive(Debug, Clone)]
 pub struct FidTable<T> {
@@ -325,6 +645,16 @@ impl<T> ShardedFidTable<T> {
         guard.active.get_mut(&fid).map(f)
     }
 
+    /// Visit every active entry (snapshot/hot-restart support).
+    pub fn for_each(&self, mut f: impl FnMut(u32, &T)) {
+        for shard in &self.shards {
+            let guard = shard.lock();
+            for (fid, entry) in &guard.active {
+                f(*fid, entry);
+            }
+        }
+    }
+
     /// Remove an entry and retire the fid.
     pub fn remove(&self, fid: u32) -> Option<T> {
         let shard = self.shard_for(fid);
@@ -347,3 +677,87 @@ impl<T> Default for ShardedFidTable<T> {
         Self::new(DEFAULT_FID_SHARDS)
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn retry_pacer_decorrelates_and_respects_budget() {
+        let mut a = RetryPacer::new(ShortWritePolicy::Retry, 11);
+        let mut b = RetryPacer::new(ShortWritePolicy::Retry, 97);
+        let delays_a: alloc::vec::Vec<u64> = (0..8).filter_map(|_| a.next_delay_ms()).collect();
+        let delays_b: alloc::vec::Vec<u64> = (0..8).filter_map(|_| b.next_delay_ms()).collect();
+        assert_ne!(delays_a, delays_b, "sessions must not retry in lockstep");
+        for delay in &delays_a {
+            assert!(*delay >= DEFAULT_SHORT_WRITE_BACKOFF_MS);
+        }
+        // Latency observations push the distribution out.
+        let mut slow = RetryPacer::new(ShortWritePolicy::Retry, 11);
+        slow.observe_latency_ms(2_000);
+        assert!(slow.next_delay_ms().unwrap() >= 1_000);
+        // Budget exhausts, success resets it.
+        let mut budgeted = RetryPacer::new(ShortWritePolicy::Retry, 3);
+        for _ in 0..DEFAULT_RETRY_BUDGET {
+            assert!(budgeted.next_delay_ms().is_some());
+        }
+        assert!(budgeted.next_delay_ms().is_none());
+        budgeted.record_success();
+        assert!(budgeted.next_delay_ms().is_some());
+        // Reject policy never paces.
+        let mut reject = RetryPacer::new(ShortWritePolicy::Reject, 5);
+        assert!(reject.next_delay_ms().is_none());
+    }
+
+    #[test]
+    fn atomic_tag_window_tracks_reserve_release() {
+        let window = AtomicTagWindow::new(2);
+        assert_eq!(window.reserve(7), Ok(()));
+        assert_eq!(window.reserve(7), Err(TagError::InUse));
+        assert_eq!(window.reserve(9), Ok(()));
+        assert_eq!(window.reserve(11), Err(TagError::WindowFull));
+        window.release(7);
+        assert_eq!(window.active_count(), 1);
+        assert_eq!(window.reserve(11), Ok(()));
+    }
+
+    #[test]
+    fn credit_controller_scales_with_drain_rate() {
+        let mut controller = CreditController::new(2, 16);
+        assert_eq!(controller.credits(), 2);
+        // Fast consumer: drains the full window every interval.
+        for _ in 0..4 {
+            let credits = controller.credits();
+            controller.grant(credits, 0);
+        }
+        assert_eq!(controller.credits(), 16);
+        // Slow consumer: work left queued decays the window to the floor.
+        for _ in 0..4 {
+            controller.grant(1, 5);
+        }
+        assert_eq!(controller.credits(), 2);
+    }
+
+    #[test]
+    fn queue_depth_limit_adjusts_without_disturbing_flight() {
+        let queue = AtomicQueueDepth::new(2);
+        queue.reserve(2).unwrap();
+        queue.set_max_depth(4);
+        assert!(queue.reserve(2).is_ok());
+        queue.set_max_depth(1);
+        assert_eq!(queue.current(), 4, "in-flight work is unaffected");
+        assert!(queue.reserve(1).is_err());
+    }
+
+    #[test]
+    fn atomic_queue_depth_matches_limit() {
+        let queue = AtomicQueueDepth::new(2);
+        assert_eq!(queue.reserve(2), Ok(()));
+        assert_eq!(queue.reserve(1), Err(QueueError::Full));
+        queue.release(1);
+        assert_eq!(queue.current(), 1);
+        assert_eq!(queue.reserve(1), Ok(()));
+        queue.release(5);
+        assert_eq!(queue.current(), 0);
+    }
+}
@@ -4,8 +4,31 @@
 // Author: Lukas Bower
 #![forbid(unsafe_code)]
 #![warn(missing_docs)]
-#![no_std]
+#![cfg_attr(not(feature = "std"), no_std)]
 
 //! Secure9P transport adapters shared across Cohesix host and VM components.
+//!
+//! The crate defines the blocking batch-exchange contract every backend
+//! implements. Host-side backends live behind the `std` feature; the
+//! planned `io-uring` backend (registered buffers, multishot receive,
+//! batched completions) needs unsafe ring setup and therefore lives behind
+//! its own feature with the unsafe boundary reviewed separately — see
+//! BUILD_PLAN m28-io-uring-transport.
 
 extern crate alloc;
+
+use alloc::vec::Vec;
+
+/// Blocking batch exchange: send one Secure9P batch, receive the response
+/// batch. Mirrors `cohsh_core::Secure9pTransport` so backends slot into the
+/// existing clients.
+pub trait BatchTransport {
+    /// Error type surfaced by the backend.
+    type Error: core::fmt::Debug;
+
+    /// Exchange one request batch for one response batch.
+    fn exchange(&mut self, batch: &[u8]) -> Result<Vec<u8>, Self::Error>;
+}
+
+#[cfg(feature = "std")]
+pub mod uds;
@@ -4,8 +4,6 @@
 // Author: Lukas Bower
 #![no_std]
 
-#[cfg(feature = "panic-handler")]
-use core::fmt::{self, Write};
 #[cfg(feature = "panic-handler")]
 use core::panic::PanicInfo;
 
@@ -189,19 +187,6 @@ pub use fallback::Sink as DebugSink;
 #[cfg(test)]
 use fallback::{buffer_contents, install_raw_sink, reset_sink};
 
-#[cfg(feature = "panic-handler")]
-struct DebugWriter;
-
-#[cfg(feature = "panic-handler")]
-impl Write for DebugWriter {
-    fn write_str(&mut self, s: &str) -> fmt::Result {
-        for byte in s.bytes() {
-            write_debug_byte(byte);
-        }
-        Ok(())
-    }
-}
-
 #[inline(always)]
 pub fn write_debug_byte(byte: u8) {
     write_impl(byte);
@@ -243,12 +228,63 @@ where
 {
 }
 
+/// Pre-reserved scratch for the panic report; written before any byte is
+/// emitted so a hung sink still leaves the message readable post-mortem.
+#[cfg(feature = "panic-handler")]
+static PANIC_SCRATCH: spin::Mutex<[u8; PANIC_SCRATCH_BYTES]> =
+    spin::Mutex::new([0u8; PANIC_SCRATCH_BYTES]);
+#[cfg(feature = "panic-handler")]
+const PANIC_SCRATCH_BYTES: usize = 256;
+
+#[cfg(feature = "panic-handler")]
+fn emit_copy(bytes: &[u8]) {
+    for &byte in bytes {
+        write_debug_byte(byte);
+    }
+}
+
+#[cfg(feature = "panic-handler")]
+fn emit_decimal(mut value: u32) {
+    let mut digits = [0u8; 10];
+    let mut index = digits.len();
+    loop {
+        index -= 1;
+        digits[index] = b'0' + (value % 10) as u8;
+        value /= 10;
+        if value == 0 {
+            break;
+        }
+    }
+    emit_copy(&digits[index..]);
+}
+
 #[cfg(feature = "panic-handler")]
 #[cfg_attr(all(not(test), target_os = "none"), panic_handler)]
 #[cfg_attr(not(all(not(test), target_os = "none")), allow(dead_code))]
 fn panic(info: &PanicInfo) -> ! {
-    let mut writer = DebugWriter;
-    let _ = writeln!(writer, "[sel4-panicking] panic: {info}");
+    // Copy-only reporting: no core::fmt, no Display impls, no allocation —
+    // a panic with a corrupted heap must still surface. The report is
+    // staged into the static scratch first so it survives a wedged sink.
+    let message: &str = info
+        .message()
+        .as_str()
+        .unwrap_or("<non-static panic payload>");
+    {
+        let mut scratch = PANIC_SCRATCH.lock();
+        let take = message.len().min(PANIC_SCRATCH_BYTES);
+        scratch[..take].copy_from_slice(&message.as_bytes()[..take]);
+    }
+    emit_copy(b"[sel4-panicking] panic at ");
+    if let Some(location) = info.location() {
+        emit_copy(location.file().as_bytes());
+        emit_copy(b":");
+        emit_decimal(location.line());
+    } else {
+        emit_copy(b"<unknown>");
+    }
+    emit_copy(b": ");
+    emit_copy(message.as_bytes());
+    emit_copy(b"\n");
     loop {
         write_debug_byte(b'!');
     }
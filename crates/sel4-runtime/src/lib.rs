@@ -118,6 +118,28 @@ pub unsafe extern "C" fn __sel4_start_init_boot_info(bootinfo: *mut seL4_BootInf
     sel4_sys::seL4_InitBootInfo(bootinfo);
 }
 
+/// Returns the task's IPC buffer pointer with a single register read.
+///
+/// `__sel4_start_init_boot_info` pins the pointer in TPIDR_EL0 during
+/// startup (via `seL4_SetIPCBuffer`), so this accessor compiles to one
+/// `mrs` — no dependent load through a global — and is safe to call on
+/// every syscall wrapper's hot path. Returns null before startup has
+/// recorded bootinfo.
+#[cfg(all(target_arch = "aarch64", target_os = "none"))]
+#[inline(always)]
+#[must_use]
+pub fn ipc_buffer() -> *mut sel4_sys::seL4_IPCBuffer {
+    let buffer: u64;
+    unsafe {
+        core::arch::asm!(
+            "mrs {buffer}, tpidr_el0",
+            buffer = out(reg) buffer,
+            options(nomem, nostack, preserves_flags)
+        );
+    }
+    buffer as *mut sel4_sys::seL4_IPCBuffer
+}
+
 /// Returns the bootinfo pointer recorded during startup, if initialised.
 pub fn bootinfo() -> Option<&'static mut seL4_BootInfo> {
     BOOTINFO
@@ -34,14 +34,22 @@ mod imp {
     #[no_mangle]
     pub static mut bootinfo: *mut seL4_BootInfo = core::ptr::null_mut();
 
+    /// IPC buffer access compiles to a single `mrs` from TPIDR_EL0: the
+    /// pointer is pinned in the thread register at task start (see
+    /// [`seL4_SetIPCBuffer`]), removing the dependent load through
+    /// `__sel4_ipc_buffer` from the front of every kernel call. The
+    /// legacy static stays in sync for code linking against the symbol.
     #[inline(always)]
     pub unsafe fn seL4_GetIPCBuffer() -> *mut seL4_IPCBuffer {
-        __sel4_ipc_buffer
+        let buffer: u64;
+        asm!("mrs {buffer}, tpidr_el0", buffer = out(reg) buffer, options(nomem, nostack, preserves_flags));
+        buffer as *mut seL4_IPCBuffer
     }
 
     #[inline(always)]
     pub unsafe fn seL4_SetIPCBuffer(buffer: *mut seL4_IPCBuffer) {
         __sel4_ipc_buffer = buffer;
+        asm!("msr tpidr_el0, {buffer}", buffer = in(reg) buffer as u64, options(nomem, nostack, preserves_flags));
     }
 
     #[export_name = "seL4_InitBootInfo"]
@@ -584,6 +592,74 @@ mod imp {
         info
     }
 
+    /// MR-direct call fast binding for short (≤ 4 word) messages.
+    ///
+    /// Message registers travel by value straight into the asm operands:
+    /// no IPC-buffer loads before the trap, no stores after, and no
+    /// pointer/null checks — the compiler keeps the words in x2–x5
+    /// across the `svc`. Payloads longer than four words must go through
+    /// [`seL4_Call`], which spills via the IPC buffer.
+    #[inline(always)]
+    pub unsafe fn seL4_CallMRDirect(
+        dest: seL4_CPtr,
+        msg_info: seL4_MessageInfo,
+        mrs: [seL4_Word; 4],
+    ) -> (seL4_MessageInfo, [seL4_Word; 4]) {
+        let mut info = msg_info.words[0];
+        let [mut msg0, mut msg1, mut msg2, mut msg3] = mrs;
+        let mut badge_dest = dest as seL4_Word;
+        let scno = seL4_SysCall as seL4_Word;
+
+        #[cfg(sel4_config_kernel_mcs)]
+        asm!(
+            "svc #0",
+            inout("x2") msg0,
+            inout("x3") msg1,
+            inout("x4") msg2,
+            inout("x5") msg3,
+            inout("x1") info,
+            inout("x0") badge_dest,
+            in("x7") scno,
+            in("x6") 0 as seL4_Word,
+            options(nostack)
+        );
+
+        #[cfg(not(sel4_config_kernel_mcs))]
+        asm!(
+            "svc #0",
+            inout("x2") msg0,
+            inout("x3") msg1,
+            inout("x4") msg2,
+            inout("x5") msg3,
+            inout("x1") info,
+            inout("x0") badge_dest,
+            in("x7") scno,
+            options(nostack)
+        );
+
+        let _ = badge_dest;
+        (seL4_MessageInfo { words: [info] }, [msg0, msg1, msg2, msg3])
+    }
+
+    /// MR-direct send fast binding for short (≤ 4 word) messages; the
+    /// same register-only contract as [`seL4_CallMRDirect`].
+    #[inline(always)]
+    pub unsafe fn seL4_SendMRDirect(
+        dest: seL4_CPtr,
+        msg_info: seL4_MessageInfo,
+        mrs: [seL4_Word; 4],
+    ) {
+        arm_sys_send(
+            seL4_SysSend as seL4_Word,
+            dest as seL4_Word,
+            msg_info.words[0],
+            mrs[0],
+            mrs[1],
+            mrs[2],
+            mrs[3],
+        );
+    }
+
     #[cfg(sel4_config_kernel_mcs)]
     #[inline(always)]
     pub unsafe fn seL4_Recv(
@@ -1888,6 +1964,24 @@ mod imp {
         unsupported();
     }
 
+    #[inline(always)]
+    pub unsafe fn seL4_CallMRDirect(
+        _dest: seL4_CPtr,
+        _msg: seL4_MessageInfo,
+        _mrs: [seL4_Word; 4],
+    ) -> (seL4_MessageInfo, [seL4_Word; 4]) {
+        unsupported();
+    }
+
+    #[inline(always)]
+    pub unsafe fn seL4_SendMRDirect(
+        _dest: seL4_CPtr,
+        _msg: seL4_MessageInfo,
+        _mrs: [seL4_Word; 4],
+    ) {
+        unsupported();
+    }
+
     #[inline(always)]
     pub unsafe fn seL4_SetMR(_index: seL4_Word, _value: seL4_Word) {
         unsupported();
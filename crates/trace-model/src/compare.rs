@@ -0,0 +1,170 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Structural transcript comparison built on the trace model.
+// Author: Lukas Bower
+
+//! Native transcript equivalence checking.
+//!
+//! The shell-script gate line-diffs raw transcripts, which both takes
+//! minutes at release size and trips over nonsemantic drift (sequence and
+//! timestamp renumbering). The comparator instead normalises each line to
+//! its semantic content — level, category, task, message — builds a content
+//! hash chain per actor stream, and reports structural divergences: actors
+//! present on one side only, differing event counts, and the first
+//! divergent event index per actor.
+
+extern crate alloc;
+
+use alloc::collections::BTreeMap;
+use alloc::string::{String, ToString};
+use alloc::vec::Vec;
+
+/// Per-actor stream digest.
+#[derive(Debug, Clone, PartialEq, Eq)]
+struct ActorStream {
+    hashes: Vec<u64>,
+}
+
+/// Divergence found for one actor stream.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct ActorDiff {
+    /// Actor key (task field, or "-" for task-less lines).
+    pub actor: String,
+    /// Events on the left side.
+    pub left_events: usize,
+    /// Events on the right side.
+    pub right_events: usize,
+    /// Index of the first differing event, when both sides have events.
+    pub first_divergence: Option<usize>,
+}
+
+/// Outcome of comparing two transcripts.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct TranscriptDiff {
+    /// True when every actor stream matched.
+    pub identical: bool,
+    /// Divergent actors, sorted by actor key.
+    pub actors: Vec<ActorDiff>,
+}
+
+fn fnv64(bytes: &[u8]) -> u64 {
+    let mut hash: u64 = 0xcbf2_9ce4_8422_2325;
+    for &byte in bytes {
+        hash ^= u64::from(byte);
+        hash = hash.wrapping_mul(0x0000_0100_0000_01b3);
+    }
+    hash
+}
+
+fn scan_field<'a>(line: &'a str, key: &str) -> Option<&'a str> {
+    let start = line.find(key)? + key.len();
+    let rest = &line[start..];
+    let end = rest.find('"')?;
+    Some(&rest[..end])
+}
+
+fn collect_streams(transcript: &str) -> BTreeMap<String, ActorStream> {
+    let mut streams: BTreeMap<String, ActorStream> = BTreeMap::new();
+    for line in transcript.lines() {
+        let Some(category) = scan_field(line, "\"cat\":\"") else {
+            continue;
+        };
+        let level = scan_field(line, "\"level\":\"").unwrap_or("");
+        let message = scan_field(line, "\"msg\":\"").unwrap_or("");
+        let actor = scan_field(line, "\"task\":\"").unwrap_or("-").to_string();
+        // Normalised content: semantic fields only; seq and ts_ms drift
+        // between replays and must not count as divergence.
+        let mut content = String::with_capacity(level.len() + category.len() + message.len() + 2);
+        content.push_str(level);
+        content.push('\x1f');
+        content.push_str(category);
+        content.push('\x1f');
+        content.push_str(message);
+        streams
+            .entry(actor)
+            .or_insert_with(|| ActorStream { hashes: Vec::new() })
+            .hashes
+            .push(fnv64(content.as_bytes()));
+    }
+    streams
+}
+
+/// Compare two transcripts structurally.
+#[must_use]
+pub fn compare_transcripts(left: &str, right: &str) -> TranscriptDiff {
+    let left_streams = collect_streams(left);
+    let right_streams = collect_streams(right);
+    let mut actors = Vec::new();
+    let empty = ActorStream { hashes: Vec::new() };
+    let keys: alloc::collections::BTreeSet<&String> =
+        left_streams.keys().chain(right_streams.keys()).collect();
+    for actor in keys {
+        let lhs = left_streams.get(actor).unwrap_or(&empty);
+        let rhs = right_streams.get(actor).unwrap_or(&empty);
+        if lhs == rhs {
+            continue;
+        }
+        let first_divergence = lhs
+            .hashes
+            .iter()
+            .zip(&rhs.hashes)
+            .position(|(a, b)| a != b)
+            .or_else(|| {
+                (lhs.hashes.len() != rhs.hashes.len())
+                    .then(|| lhs.hashes.len().min(rhs.hashes.len()))
+            });
+        actors.push(ActorDiff {
+            actor: actor.clone(),
+            left_events: lhs.hashes.len(),
+            right_events: rhs.hashes.len(),
+            first_divergence,
+        });
+    }
+    TranscriptDiff {
+        identical: actors.is_empty(),
+        actors,
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use alloc::format;
+
+    fn line(seq: u64, ts: u64, task: &str, msg: &str) -> String {
+        format!(
+            "{{\"seq\":{seq},\"ts_ms\":{ts},\"level\":\"info\",\"cat\":\"secure9p\",\"task\":\"{task}\",\"msg\":\"{msg}\"}}\n"
+        )
+    }
+
+    #[test]
+    fn renumbered_replays_compare_identical() {
+        let left: String = (0..50)
+            .map(|idx| line(idx, 1000 + idx, "/worker/1/ctl", "write"))
+            .collect();
+        let right: String = (0..50)
+            .map(|idx| line(idx + 900, 5000 + idx * 3, "/worker/1/ctl", "write"))
+            .collect();
+        assert!(compare_transcripts(&left, &right).identical);
+    }
+
+    #[test]
+    fn divergence_reports_actor_and_index() {
+        let mut left = String::new();
+        let mut right = String::new();
+        for idx in 0..10 {
+            left.push_str(&line(idx, idx, "/worker/1/ctl", "write"));
+            let msg = if idx == 7 { "tampered" } else { "write" };
+            right.push_str(&line(idx, idx, "/worker/1/ctl", msg));
+        }
+        left.push_str(&line(99, 99, "/worker/2/ctl", "only-left"));
+        let diff = compare_transcripts(&left, &right);
+        assert!(!diff.identical);
+        assert_eq!(diff.actors.len(), 2);
+        let worker1 = diff.actors.iter().find(|d| d.actor == "/worker/1/ctl").unwrap();
+        assert_eq!(worker1.first_divergence, Some(7));
+        let worker2 = diff.actors.iter().find(|d| d.actor == "/worker/2/ctl").unwrap();
+        assert_eq!(worker2.left_events, 1);
+        assert_eq!(worker2.right_events, 0);
+    }
+}
@@ -0,0 +1,178 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Aligned binary record format for cross-subsystem perf correlation.
+// Author: Lukas Bower
+
+//! Cross-subsystem performance correlation records.
+//!
+//! Incident forensics used to stitch net counters, pipeline metrics,
+//! and GPU tick costs together by hand, each with its own clock and
+//! format. The correlation file fixes both axes: every subsystem's
+//! counters are sampled on one cadence against the shared timestamp
+//! page, and rows are fixed-stride little-endian binary — a header
+//! names the columns once, then each row is `timestamp_us` plus one
+//! `u64` per column — so one capture shows queue depth, net drops, and
+//! GPU stalls on the same timeline and tools can seek by row index.
+
+extern crate alloc;
+
+use alloc::string::String;
+use alloc::vec::Vec;
+
+/// File magic prefixing every correlation capture (version 1).
+pub const CORRELATION_MAGIC: &[u8; 4] = b"CPR1";
+
+/// Column schema for a correlation capture.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct PerfSchema {
+    fields: Vec<String>,
+}
+
+/// One decoded correlation row.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct PerfRow {
+    /// Sample timestamp in microseconds (shared timestamp page).
+    pub timestamp_us: u64,
+    /// Counter values in schema column order.
+    pub values: Vec<u64>,
+}
+
+/// Decode failure for a correlation capture.
+#[derive(Debug, PartialEq, Eq)]
+pub enum CorrelateError {
+    /// Missing or wrong magic bytes.
+    BadMagic,
+    /// Header or row ended mid-field.
+    Truncated,
+    /// A column name was not valid UTF-8.
+    InvalidName,
+}
+
+impl PerfSchema {
+    /// Create a schema over named columns (order is the row layout).
+    #[must_use]
+    pub fn new(fields: Vec<String>) -> Self {
+        Self { fields }
+    }
+
+    /// Column names in row order.
+    #[must_use]
+    pub fn fields(&self) -> &[String] {
+        &self.fields
+    }
+
+    /// Bytes per row: timestamp plus one `u64` per column.
+    #[must_use]
+    pub fn row_stride(&self) -> usize {
+        8 * (1 + self.fields.len())
+    }
+
+    /// Encode the capture header: magic, `u16` column count, then each
+    /// name as `u8` length plus UTF-8 bytes.
+    #[must_use]
+    pub fn encode_header(&self) -> Vec<u8> {
+        let mut out = Vec::new();
+        out.extend_from_slice(CORRELATION_MAGIC);
+        out.extend_from_slice(&(self.fields.len() as u16).to_le_bytes());
+        for field in &self.fields {
+            let name = field.as_bytes();
+            out.push(name.len() as u8);
+            out.extend_from_slice(name);
+        }
+        out
+    }
+
+    /// Append one fixed-stride row; `values` beyond the schema are
+    /// ignored and missing columns encode as zero.
+    pub fn append_row(&self, out: &mut Vec<u8>, timestamp_us: u64, values: &[u64]) {
+        out.extend_from_slice(&timestamp_us.to_le_bytes());
+        for index in 0..self.fields.len() {
+            let value = values.get(index).copied().unwrap_or(0);
+            out.extend_from_slice(&value.to_le_bytes());
+        }
+    }
+}
+
+/// Decode a capture into its schema and rows.
+pub fn decode_capture(bytes: &[u8]) -> Result<(PerfSchema, Vec<PerfRow>), CorrelateError> {
+    if bytes.len() < 6 || &bytes[0..4] != CORRELATION_MAGIC {
+        return Err(CorrelateError::BadMagic);
+    }
+    let field_count = u16::from_le_bytes(
+        bytes[4..6]
+            .try_into()
+            .map_err(|_| CorrelateError::Truncated)?,
+    ) as usize;
+    let mut cursor = 6usize;
+    let mut fields = Vec::with_capacity(field_count);
+    for _ in 0..field_count {
+        let len = *bytes.get(cursor).ok_or(CorrelateError::Truncated)? as usize;
+        cursor += 1;
+        let name = bytes
+            .get(cursor..cursor + len)
+            .ok_or(CorrelateError::Truncated)?;
+        cursor += len;
+        fields.push(
+            core::str::from_utf8(name)
+                .map_err(|_| CorrelateError::InvalidName)?
+                .into(),
+        );
+    }
+    let schema = PerfSchema::new(fields);
+    let stride = schema.row_stride();
+    let body = &bytes[cursor..];
+    if body.len() % stride != 0 {
+        return Err(CorrelateError::Truncated);
+    }
+    let mut rows = Vec::with_capacity(body.len() / stride);
+    for row in body.chunks_exact(stride) {
+        let timestamp_us = u64::from_le_bytes(
+            row[0..8]
+                .try_into()
+                .map_err(|_| CorrelateError::Truncated)?,
+        );
+        let values = row[8..]
+            .chunks_exact(8)
+            .map(|cell| u64::from_le_bytes(cell.try_into().expect("eight bytes")))
+            .collect();
+        rows.push(PerfRow {
+            timestamp_us,
+            values,
+        });
+    }
+    Ok((schema, rows))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use alloc::string::ToString;
+    use alloc::vec;
+
+    #[test]
+    fn captures_round_trip_with_fixed_stride() {
+        let schema = PerfSchema::new(vec![
+            "net.rx_drops".to_string(),
+            "pipeline.queue_depth".to_string(),
+            "gpu.tick_us".to_string(),
+        ]);
+        let mut capture = schema.encode_header();
+        let header_len = capture.len();
+        schema.append_row(&mut capture, 1_000, &[3, 17, 950]);
+        schema.append_row(&mut capture, 2_000, &[4, 12]);
+        assert_eq!(capture.len() - header_len, 2 * schema.row_stride());
+
+        let (decoded_schema, rows) = decode_capture(&capture).expect("decode");
+        assert_eq!(decoded_schema, schema);
+        assert_eq!(rows.len(), 2);
+        assert_eq!(rows[0].timestamp_us, 1_000);
+        assert_eq!(rows[0].values, vec![3, 17, 950]);
+        assert_eq!(rows[1].values, vec![4, 12, 0], "missing column reads zero");
+
+        assert_eq!(
+            decode_capture(&capture[..capture.len() - 5]),
+            Err(CorrelateError::Truncated)
+        );
+        assert_eq!(decode_capture(b"nope"), Err(CorrelateError::BadMagic));
+    }
+}
@@ -0,0 +1,168 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Export trace transcripts as flamegraph and chrome-tracing data.
+// Author: Lukas Bower
+
+//! Trace export pipeline.
+//!
+//! Reconstructs spans from enter/exit events in a JSONL transcript (message
+//! prefixes `enter:` / `exit:` under any category) and renders the two
+//! formats the analysis tools eat directly: collapsed stacks for
+//! `flamegraph.pl`-style folding, and a chrome://tracing JSON array — one
+//! command from field trace to picture instead of reading text.
+
+extern crate alloc;
+
+use alloc::collections::BTreeMap;
+use alloc::format;
+use alloc::string::{String, ToString};
+use alloc::vec::Vec;
+
+/// One reconstructed span.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct Span {
+    /// Actor (task key) the span ran under.
+    pub actor: String,
+    /// Span name (the text after `enter:`).
+    pub name: String,
+    /// Stack of enclosing span names, outermost first, including this one.
+    pub stack: Vec<String>,
+    /// Start timestamp in milliseconds.
+    pub start_ms: u64,
+    /// Duration in milliseconds.
+    pub duration_ms: u64,
+}
+
+fn scan_field<'a>(line: &'a str, key: &str) -> Option<&'a str> {
+    let start = line.find(key)? + key.len();
+    let rest = &line[start..];
+    Some(&rest[..rest.find('"')?])
+}
+
+fn scan_u64(line: &str, key: &str) -> Option<u64> {
+    let start = line.find(key)? + key.len();
+    let rest = &line[start..];
+    let end = rest
+        .find(|ch: char| !ch.is_ascii_digit())
+        .unwrap_or(rest.len());
+    rest[..end].parse().ok()
+}
+
+/// Reconstruct spans from a transcript's enter/exit events.
+///
+/// Unbalanced exits are ignored; spans still open at the end of the
+/// transcript are dropped (a truncated capture must not fabricate
+/// durations).
+#[must_use]
+pub fn reconstruct_spans(transcript: &str) -> Vec<Span> {
+    let mut stacks: BTreeMap<String, Vec<(String, u64)>> = BTreeMap::new();
+    let mut spans = Vec::new();
+    for line in transcript.lines() {
+        let Some(message) = scan_field(line, "\"msg\":\"") else {
+            continue;
+        };
+        let Some(ts_ms) = scan_u64(line, "\"ts_ms\":") else {
+            continue;
+        };
+        let actor = scan_field(line, "\"task\":\"").unwrap_or("-").to_string();
+        if let Some(name) = message.strip_prefix("enter:") {
+            stacks
+                .entry(actor)
+                .or_default()
+                .push((name.to_string(), ts_ms));
+        } else if let Some(name) = message.strip_prefix("exit:") {
+            let stack = stacks.entry(actor.clone()).or_default();
+            if stack.last().is_some_and(|(top, _)| top == name) {
+                let frames: Vec<String> =
+                    stack.iter().map(|(frame, _)| frame.clone()).collect();
+                let (span_name, start_ms) = stack.pop().expect("guarded by last check");
+                spans.push(Span {
+                    actor,
+                    name: span_name,
+                    stack: frames,
+                    start_ms,
+                    duration_ms: ts_ms.saturating_sub(start_ms),
+                });
+            }
+        }
+    }
+    spans.sort_by_key(|span| span.start_ms);
+    spans
+}
+
+/// Render spans as collapsed stacks (`actor;outer;inner duration`).
+#[must_use]
+pub fn to_collapsed_stacks(spans: &[Span]) -> String {
+    let mut folded: BTreeMap<String, u64> = BTreeMap::new();
+    for span in spans {
+        let mut key = span.actor.clone();
+        for frame in &span.stack {
+            key.push(';');
+            key.push_str(frame);
+        }
+        *folded.entry(key).or_default() += span.duration_ms;
+    }
+    let mut out = String::new();
+    for (key, weight) in folded {
+        out.push_str(&format!("{key} {weight}\n"));
+    }
+    out
+}
+
+/// Render spans as a chrome://tracing "complete event" JSON array.
+#[must_use]
+pub fn to_chrome_tracing(spans: &[Span]) -> String {
+    let mut out = String::from("[");
+    for (index, span) in spans.iter().enumerate() {
+        if index > 0 {
+            out.push(',');
+        }
+        out.push_str(&format!(
+            "{{\"name\":\"{}\",\"cat\":\"cohesix\",\"ph\":\"X\",\"ts\":{},\"dur\":{},\"pid\":1,\"tid\":\"{}\"}}",
+            span.name,
+            span.start_ms * 1000,
+            span.duration_ms * 1000,
+            span.actor
+        ));
+    }
+    out.push(']');
+    out
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use alloc::vec;
+
+    fn line(ts: u64, task: &str, msg: &str) -> String {
+        format!(
+            "{{\"seq\":1,\"ts_ms\":{ts},\"level\":\"info\",\"cat\":\"span\",\"task\":\"{task}\",\"msg\":\"{msg}\"}}\n"
+        )
+    }
+
+    #[test]
+    fn spans_reconstruct_nested_and_render_both_formats() {
+        let mut transcript = String::new();
+        transcript.push_str(&line(100, "root-task", "enter:pump"));
+        transcript.push_str(&line(110, "root-task", "enter:net_poll"));
+        transcript.push_str(&line(140, "root-task", "exit:net_poll"));
+        transcript.push_str(&line(200, "root-task", "exit:pump"));
+        transcript.push_str(&line(150, "nine-door", "enter:handle_batch"));
+        transcript.push_str(&line(160, "nine-door", "exit:handle_batch"));
+        transcript.push_str(&line(300, "nine-door", "enter:still_open"));
+
+        let spans = reconstruct_spans(&transcript);
+        assert_eq!(spans.len(), 3, "open span at EOF is dropped");
+        let net = spans.iter().find(|span| span.name == "net_poll").unwrap();
+        assert_eq!(net.stack, vec!["pump".to_string(), "net_poll".to_string()]);
+        assert_eq!(net.duration_ms, 30);
+
+        let collapsed = to_collapsed_stacks(&spans);
+        assert!(collapsed.contains("root-task;pump;net_poll 30"));
+        assert!(collapsed.contains("root-task;pump 100"));
+        let chrome = to_chrome_tracing(&spans);
+        assert!(chrome.starts_with('[') && chrome.ends_with(']'));
+        assert!(chrome.contains("\"name\":\"handle_batch\""));
+        assert!(chrome.contains("\"tid\":\"nine-door\""));
+    }
+}
@@ -0,0 +1,274 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Indexed queries over JSONL trace transcripts.
+// Author: Lukas Bower
+
+//! Sorted index over JSONL transcripts for millisecond-range queries.
+//!
+//! Compliance replays work over multi-gigabyte transcripts; a linear scan
+//! per question re-reads everything. The index records one entry per line —
+//! timestamp, category, optional task, byte offset — sorted by timestamp, so
+//! "all writes to `/worker/*/ctl` between T1 and T2" binary-searches to the
+//! window and filters only the lines inside it. The index serialises to a
+//! compact sidecar (`.cohidx`) that loads without re-parsing the transcript.
+
+extern crate alloc;
+
+use alloc::string::{String, ToString};
+use alloc::vec::Vec;
+
+/// Magic prefix for serialised index sidecars.
+pub const INDEX_MAGIC: &[u8; 4] = b"CIX1";
+
+/// One indexed transcript line.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct IndexEntry {
+    /// Event timestamp in milliseconds.
+    pub ts_ms: u64,
+    /// Byte offset of the line within the transcript.
+    pub offset: u64,
+    /// Event category.
+    pub category: String,
+    /// Optional task identifier (actor/path key).
+    pub task: Option<String>,
+}
+
+/// Query over the indexed transcript.
+#[derive(Debug, Clone, Default)]
+pub struct TraceQuery<'a> {
+    /// Inclusive window start in milliseconds (`None` = open).
+    pub from_ms: Option<u64>,
+    /// Inclusive window end in milliseconds (`None` = open).
+    pub to_ms: Option<u64>,
+    /// Exact category filter.
+    pub category: Option<&'a str>,
+    /// Task filter supporting one `*` wildcard (e.g. `/worker/*/ctl`).
+    pub task: Option<&'a str>,
+}
+
+/// Sorted transcript index.
+#[derive(Debug, Clone, Default, PartialEq, Eq)]
+pub struct TraceIndex {
+    entries: Vec<IndexEntry>,
+}
+
+impl TraceIndex {
+    /// Build an index from a JSONL transcript.
+    ///
+    /// Lines that do not parse as trace events are skipped (transcripts may
+    /// interleave foreign lines); ordering is by timestamp with a stable
+    /// sort so equal stamps keep transcript order.
+    #[must_use]
+    pub fn build(transcript: &str) -> Self {
+        let mut entries = Vec::new();
+        let mut offset = 0u64;
+        for line in transcript.split_inclusive('\n') {
+            let line_offset = offset;
+            offset += line.len() as u64;
+            let Some(ts_ms) = scan_u64_field(line, "\"ts_ms\":") else {
+                continue;
+            };
+            let Some(category) = scan_string_field(line, "\"cat\":\"") else {
+                continue;
+            };
+            entries.push(IndexEntry {
+                ts_ms,
+                offset: line_offset,
+                category,
+                task: scan_string_field(line, "\"task\":\""),
+            });
+        }
+        entries.sort_by_key(|entry| entry.ts_ms);
+        Self { entries }
+    }
+
+    /// Number of indexed lines.
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    /// True when the index holds no entries.
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    /// Answer a query with the matching entries in timestamp order.
+    ///
+    /// The time window is located with binary searches; only entries inside
+    /// it are touched by the category/task filters.
+    #[must_use]
+    pub fn query(&self, query: &TraceQuery<'_>) -> Vec<&IndexEntry> {
+        let start = match query.from_ms {
+            Some(from) => self.entries.partition_point(|entry| entry.ts_ms < from),
+            None => 0,
+        };
+        let end = match query.to_ms {
+            Some(to) => self.entries.partition_point(|entry| entry.ts_ms <= to),
+            None => self.entries.len(),
+        };
+        self.entries[start..end]
+            .iter()
+            .filter(|entry| {
+                query
+                    .category
+                    .is_none_or(|category| entry.category == category)
+            })
+            .filter(|entry| {
+                query.task.is_none_or(|pattern| {
+                    entry
+                        .task
+                        .as_deref()
+                        .is_some_and(|task| wildcard_match(pattern, task))
+                })
+            })
+            .collect()
+    }
+
+    /// Serialise the index into a compact sidecar payload.
+    #[must_use]
+    pub fn to_bytes(&self) -> Vec<u8> {
+        let mut out = Vec::with_capacity(16 + self.entries.len() * 32);
+        out.extend_from_slice(INDEX_MAGIC);
+        out.extend_from_slice(&(self.entries.len() as u32).to_le_bytes());
+        for entry in &self.entries {
+            out.extend_from_slice(&entry.ts_ms.to_le_bytes());
+            out.extend_from_slice(&entry.offset.to_le_bytes());
+            put_str(&mut out, &entry.category);
+            match &entry.task {
+                Some(task) => {
+                    out.push(1);
+                    put_str(&mut out, task);
+                }
+                None => out.push(0),
+            }
+        }
+        out
+    }
+
+    /// Load an index from a sidecar payload produced by [`TraceIndex::to_bytes`].
+    #[must_use]
+    pub fn from_bytes(bytes: &[u8]) -> Option<Self> {
+        let rest = bytes.strip_prefix(INDEX_MAGIC.as_slice())?;
+        let (len_raw, mut rest) = rest.split_at_checked(4)?;
+        let count = u32::from_le_bytes(len_raw.try_into().ok()?) as usize;
+        let mut entries = Vec::with_capacity(count.min(1 << 20));
+        for _ in 0..count {
+            let (ts_raw, tail) = rest.split_at_checked(8)?;
+            let (offset_raw, tail) = tail.split_at_checked(8)?;
+            let (category, tail) = take_str(tail)?;
+            let (flag, tail) = tail.split_at_checked(1)?;
+            let (task, tail) = if flag[0] == 1 {
+                let (task, tail) = take_str(tail)?;
+                (Some(task), tail)
+            } else {
+                (None, tail)
+            };
+            entries.push(IndexEntry {
+                ts_ms: u64::from_le_bytes(ts_raw.try_into().ok()?),
+                offset: u64::from_le_bytes(offset_raw.try_into().ok()?),
+                category,
+                task,
+            });
+            rest = tail;
+        }
+        rest.is_empty().then_some(Self { entries })
+    }
+}
+
+/// Match `pattern` against `value` with at most one `*` wildcard.
+fn wildcard_match(pattern: &str, value: &str) -> bool {
+    match pattern.split_once('*') {
+        Some((prefix, suffix)) => {
+            value.len() >= prefix.len() + suffix.len()
+                && value.starts_with(prefix)
+                && value.ends_with(suffix)
+        }
+        None => pattern == value,
+    }
+}
+
+fn scan_u64_field(line: &str, key: &str) -> Option<u64> {
+    let start = line.find(key)? + key.len();
+    let rest = &line[start..];
+    let end = rest
+        .find(|ch: char| !ch.is_ascii_digit())
+        .unwrap_or(rest.len());
+    rest[..end].parse().ok()
+}
+
+fn scan_string_field(line: &str, key: &str) -> Option<String> {
+    let start = line.find(key)? + key.len();
+    let rest = &line[start..];
+    let end = rest.find('"')?;
+    Some(rest[..end].to_string())
+}
+
+fn put_str(out: &mut Vec<u8>, value: &str) {
+    let len = value.len().min(u16::MAX as usize) as u16;
+    out.extend_from_slice(&len.to_le_bytes());
+    out.extend_from_slice(&value.as_bytes()[..usize::from(len)]);
+}
+
+fn take_str(bytes: &[u8]) -> Option<(String, &[u8])> {
+    let (len_raw, rest) = bytes.split_at_checked(2)?;
+    let len = usize::from(u16::from_le_bytes(len_raw.try_into().ok()?));
+    let (raw, rest) = rest.split_at_checked(len)?;
+    Some((core::str::from_utf8(raw).ok()?.to_string(), rest))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use alloc::format;
+
+    fn transcript() -> String {
+        let mut out = String::new();
+        for seq in 0..100u64 {
+            let task = if seq % 2 == 0 {
+                format!("/worker/{}/ctl", seq % 5)
+            } else {
+                format!("/worker/{}/telemetry", seq % 5)
+            };
+            out.push_str(&format!(
+                "{{\"seq\":{seq},\"ts_ms\":{},\"level\":\"info\",\"cat\":\"secure9p\",\"task\":\"{task}\",\"msg\":\"write\"}}\n",
+                1000 + seq * 10,
+            ));
+        }
+        out
+    }
+
+    #[test]
+    fn windowed_wildcard_queries_hit_only_the_range() {
+        let text = transcript();
+        let index = TraceIndex::build(&text);
+        assert_eq!(index.len(), 100);
+        let results = index.query(&TraceQuery {
+            from_ms: Some(1200),
+            to_ms: Some(1400),
+            category: Some("secure9p"),
+            task: Some("/worker/*/ctl"),
+        });
+        assert!(!results.is_empty());
+        for entry in &results {
+            assert!((1200..=1400).contains(&entry.ts_ms));
+            let task = entry.task.as_deref().unwrap();
+            assert!(task.starts_with("/worker/") && task.ends_with("/ctl"));
+            // Offsets point at the matching transcript line.
+            let line = &text[entry.offset as usize..];
+            assert!(line.starts_with('{'));
+            assert!(line[..line.find('\n').unwrap()].contains(task));
+        }
+    }
+
+    #[test]
+    fn sidecar_roundtrip_preserves_the_index() {
+        let index = TraceIndex::build(&transcript());
+        let bytes = index.to_bytes();
+        let restored = TraceIndex::from_bytes(&bytes).expect("load sidecar");
+        assert_eq!(restored, index);
+        assert!(TraceIndex::from_bytes(&bytes[..bytes.len() - 1]).is_none());
+        assert!(TraceIndex::from_bytes(b"nope").is_none());
+    }
+}
@@ -7,6 +7,18 @@
 #![forbid(unsafe_code)]
 #![warn(missing_docs)]
 
+/// Structural transcript comparison (requires `alloc`).
+pub mod compare;
+
+/// Cross-subsystem perf correlation records (requires `alloc`).
+pub mod correlate;
+
+/// Flamegraph and chrome-tracing export (requires `alloc`).
+pub mod export;
+
+/// Indexed transcript queries (requires `alloc`).
+pub mod index;
+
 use core::fmt::{self, Write};
 use core::str::FromStr;
 use heapless::String as HeaplessString;
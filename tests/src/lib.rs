@@ -7,7 +7,78 @@
 
 //! Shared helpers for Cohesix integration tests.
 
+/// Deterministic sharded adversarial harness for the security suite.
+pub mod security;
+
 use std::time::Duration;
 
 /// Helper constant mirroring the short timeout used by the TCP integration tests.
 pub const TEST_TIMEOUT: Duration = Duration::from_millis(200);
+
+use std::sync::atomic::{AtomicU16, AtomicU64, Ordering};
+
+/// Base port for per-scenario TCP allocations.
+const SCENARIO_PORT_BASE: u16 = 42_000;
+
+static NEXT_PORT_OFFSET: AtomicU16 = AtomicU16::new(0);
+static NEXT_SCENARIO: AtomicU64 = AtomicU64::new(0);
+
+/// Isolated fixture allocation for one test scenario.
+///
+/// Scenarios historically shared fixture state (and the one hard-coded
+/// console port), forcing the suite to run serially. Each call hands out a
+/// process-unique TCP port and namespace prefix, so scenarios can run
+/// N-way parallel under the standard test harness without colliding; the
+/// prefix also namespaces any on-disk scratch the scenario creates.
+#[derive(Debug, Clone)]
+pub struct ScenarioFixture {
+    /// Process-unique TCP port for this scenario's listener.
+    pub port: u16,
+    /// Unique namespace/scratch prefix, e.g. `scenario-3-<pid>`.
+    pub prefix: String,
+}
+
+impl ScenarioFixture {
+    /// Allocate the next isolated fixture.
+    #[must_use]
+    pub fn allocate() -> Self {
+        let offset = NEXT_PORT_OFFSET.fetch_add(1, Ordering::Relaxed) % 8_000;
+        let scenario = NEXT_SCENARIO.fetch_add(1, Ordering::Relaxed);
+        Self {
+            port: SCENARIO_PORT_BASE + offset,
+            prefix: format!("scenario-{scenario}-{}", std::process::id()),
+        }
+    }
+
+    /// Scratch directory for this scenario under the system temp dir.
+    #[must_use]
+    pub fn scratch_dir(&self) -> std::path::PathBuf {
+        std::env::temp_dir().join(&self.prefix)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn fixtures_are_unique_under_parallel_allocation() {
+        let fixtures: Vec<ScenarioFixture> = std::thread::scope(|scope| {
+            let handles: Vec<_> = (0..16)
+                .map(|_| scope.spawn(ScenarioFixture::allocate))
+                .collect();
+            handles
+                .into_iter()
+                .map(|handle| handle.join().expect("allocation thread"))
+                .collect()
+        });
+        let ports: std::collections::BTreeSet<u16> =
+            fixtures.iter().map(|fixture| fixture.port).collect();
+        assert_eq!(ports.len(), fixtures.len(), "ports must not collide");
+        let prefixes: std::collections::BTreeSet<&str> = fixtures
+            .iter()
+            .map(|fixture| fixture.prefix.as_str())
+            .collect();
+        assert_eq!(prefixes.len(), fixtures.len(), "prefixes must not collide");
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Run the sharded deterministic security harness for this process's shard.
+// Author: Lukas Bower
+
+use tests::security::SecurityHarness;
+use tests::ScenarioFixture;
+
+/// Cases per full run; shards split this by COHESIX_SECURITY_SHARD.
+const SECURITY_CASES: u64 = 512;
+
+#[test]
+fn adversarial_cases_hold_for_this_shard() {
+    let harness = SecurityHarness::from_env();
+    match harness.run(SECURITY_CASES) {
+        Ok(executed) => {
+            assert!(executed > 0, "shard spec left this process with no cases");
+        }
+        Err(reproducer) => {
+            let fixture = ScenarioFixture::allocate();
+            let path = harness
+                .dump_reproducer(&fixture, &reproducer)
+                .expect("write reproducer dump");
+            panic!(
+                "security case failed ({}); reproducer at {} — replay with {}",
+                reproducer.scenario,
+                path.display(),
+                reproducer.render().lines().nth(1).unwrap_or_default(),
+            );
+        }
+    }
+}
@@ -1,15 +1,20 @@
 """Cohesix Python client package."""
 
 from .audit import CohesixAudit
+from .bulk import BulkResult, list_many, read_many, stream_tail
 from .backends import FilesystemBackend, MockBackend, TcpBackend
 from .client import CohesixClient
 from .errors import CohesixError
 
 __all__ = [
+    "BulkResult",
     "CohesixAudit",
     "CohesixClient",
     "CohesixError",
     "FilesystemBackend",
     "MockBackend",
+    "list_many",
+    "read_many",
+    "stream_tail",
     "TcpBackend",
 ]
@@ -0,0 +1,115 @@
+"""Bulk/pipelined operations for Cohesix Python clients.
+
+Fleet-management scripts previously issued one call per worker and spent
+their lives in sequential round trips. The helpers here fan independent
+operations across a bounded thread pool of backend connections — batch
+reads, multi-worker pulls, and polling tails — mirroring the windowed
+transport the Rust clients use.
+"""
+
+from __future__ import annotations
+
+import concurrent.futures
+import time
+from dataclasses import dataclass
+from typing import Callable, Dict, Iterable, Iterator, List, Optional, Tuple
+
+from .backends import Backend
+
+DEFAULT_CONCURRENCY = 8
+
+
+@dataclass
+class BulkResult:
+    """Outcome of one path in a bulk operation."""
+
+    path: str
+    payload: Optional[bytes]
+    error: Optional[str]
+
+    @property
+    def ok(self) -> bool:
+        return self.error is None
+
+
+def read_many(
+    backend_factory: Callable[[], Backend],
+    paths: Iterable[str],
+    max_bytes: int,
+    concurrency: int = DEFAULT_CONCURRENCY,
+) -> List[BulkResult]:
+    """Read several files in parallel, one backend connection per worker.
+
+    Results return in input order; per-path failures land in their slot
+    instead of aborting the batch, matching the Rust batched-walk surface.
+    """
+
+    path_list = list(paths)
+    if not path_list:
+        return []
+
+    def fetch(path: str) -> BulkResult:
+        try:
+            backend = backend_factory()
+            return BulkResult(path=path, payload=backend.read_file(path, max_bytes), error=None)
+        except Exception as err:  # noqa: BLE001 - per-path error slot
+            return BulkResult(path=path, payload=None, error=str(err))
+
+    workers = max(1, min(concurrency, len(path_list)))
+    with concurrent.futures.ThreadPoolExecutor(max_workers=workers) as pool:
+        return list(pool.map(fetch, path_list))
+
+
+def list_many(
+    backend_factory: Callable[[], Backend],
+    paths: Iterable[str],
+    concurrency: int = DEFAULT_CONCURRENCY,
+) -> Dict[str, List[str]]:
+    """List several directories in parallel; failures map to empty lists."""
+
+    path_list = list(paths)
+
+    def fetch(path: str) -> Tuple[str, List[str]]:
+        try:
+            backend = backend_factory()
+            return path, backend.list_dir(path)
+        except Exception:  # noqa: BLE001 - absent directories list empty
+            return path, []
+
+    workers = max(1, min(concurrency, max(1, len(path_list))))
+    with concurrent.futures.ThreadPoolExecutor(max_workers=workers) as pool:
+        return dict(pool.map(fetch, path_list))
+
+
+def stream_tail(
+    backend: Backend,
+    path: str,
+    max_bytes: int,
+    poll_interval_s: float = 0.5,
+    max_polls: Optional[int] = None,
+) -> Iterator[str]:
+    """Yield new lines from a growing file, polling with adaptive backoff.
+
+    Empty polls double the interval (capped at ten times the base) and a
+    poll with data snaps back, mirroring the Rust TailPoller, so idle tails
+    stop burning round trips.
+    """
+
+    seen = 0
+    interval = poll_interval_s
+    polls = 0
+    while max_polls is None or polls < max_polls:
+        polls += 1
+        payload = backend.read_file(path, max_bytes)
+        text = payload.decode("utf-8", errors="replace")
+        lines = text.splitlines()
+        fresh = lines[seen:]
+        seen = len(lines)
+        if fresh:
+            interval = poll_interval_s
+            yield from fresh
+        else:
+            interval = min(interval * 2, poll_interval_s * 10)
+        if max_polls is not None and polls >= max_polls:
+            break
+        time.sleep(interval)
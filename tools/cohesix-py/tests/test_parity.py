@@ -148,3 +148,20 @@ def test_invalid_ticket_rejected() -> None:
         assert "ticket" in str(exc)
     else:  # pragma: no cover
         raise AssertionError("invalid ticket was accepted")
+
+
+def test_bulk_reads_preserve_order_and_isolate_failures() -> None:
+    backend = MockBackend()
+    paths = list(backend.list_dir("/gpu"))
+    assert paths, "mock backend lists gpu entries"
+    from cohesix.bulk import read_many
+
+    gpu_ids = [entry for entry in paths if entry.startswith("GPU-")]
+    assert gpu_ids, paths
+    targets = [f"/gpu/{entry}/info" for entry in gpu_ids] + ["/gpu/nope/info"]
+    results = read_many(lambda: backend, targets, max_bytes=4096, concurrency=4)
+    assert [result.path for result in results] == targets
+    for result in results[:-1]:
+        assert result.ok, result.error
+        assert result.payload
+    assert not results[-1].ok
@@ -0,0 +1,359 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Simulate configurable worker populations against a NineDoor server.
+// Author: Lukas Bower
+#![forbid(unsafe_code)]
+#![warn(missing_docs)]
+
+//! Synthetic hive load generator.
+//!
+//! Stands up N fake workers against a NineDoor server — heartbeats in the
+//! worker-heart format, telemetry lines at a configured rate — multiplexed
+//! over per-thread sessions, so production-scale request mixes reproduce in
+//! the lab instead of only in the field.
+
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::time::{Duration, Instant};
+
+use anyhow::{Context, Result};
+use cohesix_ticket::Role;
+use cohsh::client::{CohClient, InProcessTransport};
+use nine_door::NineDoor;
+use secure9p_codec::{OpenMode, SessionId};
+use worker_heart::HeartbeatWorker;
+
+/// Load profile for one generator run.
+#[derive(Debug, Clone, Copy)]
+pub struct LoadProfile {
+    /// Simulated worker count.
+    pub workers: usize,
+    /// Telemetry lines per worker per second.
+    pub telemetry_hz: u32,
+    /// Run duration.
+    pub duration: Duration,
+    /// Concurrent generator threads (sessions).
+    pub concurrency: usize,
+}
+
+/// Aggregate results of a load run.
+#[derive(Debug, Clone, Copy, Default)]
+pub struct LoadSummary {
+    /// Heartbeat writes performed.
+    pub heartbeats: u64,
+    /// Telemetry lines written.
+    pub telemetry_lines: u64,
+    /// Operations that failed.
+    pub errors: u64,
+}
+
+/// Drive the load profile against the supplied server.
+pub fn run_load(server: &NineDoor, profile: &LoadProfile) -> Result<LoadSummary> {
+    // Spawn the simulated workers through the queen control path so the
+    // namespace carries real per-worker telemetry files.
+    let connection = server.connect().context("connect spawner")?;
+    let mut spawner = CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)?;
+    let ctl = spawner.open("/queen/ctl", OpenMode::write_append())?;
+    for _ in 0..profile.workers {
+        spawner.write(ctl, u64::MAX, b"{\"spawn\":\"heartbeat\",\"ticks\":600}\n")?;
+    }
+    spawner.clunk(ctl)?;
+
+    let heartbeats = AtomicU64::new(0);
+    let telemetry_lines = AtomicU64::new(0);
+    let errors = AtomicU64::new(0);
+    let next_worker = AtomicU64::new(0);
+    let interval = Duration::from_millis(1_000 / u64::from(profile.telemetry_hz.max(1)));
+
+    std::thread::scope(|scope| {
+        for _ in 0..profile.concurrency.max(1) {
+            let heartbeats = &heartbeats;
+            let telemetry_lines = &telemetry_lines;
+            let errors = &errors;
+            let next_worker = &next_worker;
+            scope.spawn(move || {
+                let Ok(connection) = server.connect() else {
+                    errors.fetch_add(1, Ordering::Relaxed);
+                    return;
+                };
+                let Ok(mut client) =
+                    CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)
+                else {
+                    errors.fetch_add(1, Ordering::Relaxed);
+                    return;
+                };
+                let deadline = Instant::now() + profile.duration;
+                let mut tick = 0u64;
+                while Instant::now() < deadline {
+                    let worker =
+                        next_worker.fetch_add(1, Ordering::Relaxed) % profile.workers as u64 + 1;
+                    let heart = HeartbeatWorker::new(SessionId::from_raw(worker));
+                    let path = format!("/worker/worker-{worker}/telemetry");
+                    tick += 1;
+                    let Ok(payload) = heart.emit(tick) else {
+                        errors.fetch_add(1, Ordering::Relaxed);
+                        continue;
+                    };
+                    let line = format!("{payload}\n");
+                    match client.open(&path, OpenMode::write_append()) {
+                        Ok(fid) => {
+                            if client.write(fid, u64::MAX, line.as_bytes()).is_ok() {
+                                heartbeats.fetch_add(1, Ordering::Relaxed);
+                                telemetry_lines.fetch_add(1, Ordering::Relaxed);
+                            } else {
+                                errors.fetch_add(1, Ordering::Relaxed);
+                            }
+                            let _ = client.clunk(fid);
+                        }
+                        Err(_) => {
+                            errors.fetch_add(1, Ordering::Relaxed);
+                        }
+                    }
+                    std::thread::sleep(interval / profile.concurrency.max(1) as u32);
+                }
+            });
+        }
+    });
+
+    Ok(LoadSummary {
+        heartbeats: heartbeats.into_inner(),
+        telemetry_lines: telemetry_lines.into_inner(),
+        errors: errors.into_inner(),
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn small_population_generates_load_without_errors() {
+        let server = NineDoor::new();
+        let profile = LoadProfile {
+            workers: 4,
+            telemetry_hz: 50,
+            duration: Duration::from_millis(400),
+            concurrency: 2,
+        };
+        let summary = run_load(&server, &profile).expect("load run");
+        assert!(summary.telemetry_lines > 0);
+        assert_eq!(summary.errors, 0, "summary: {summary:?}");
+    }
+}
+
+/// One captured request in a replay trace (JSONL).
+#[derive(Debug, Clone, serde::Serialize, serde::Deserialize)]
+pub struct CaptureEntry {
+    /// Milliseconds since capture start.
+    pub t_ms: u64,
+    /// Operation: `read`, `write`, or `list`.
+    pub op: String,
+    /// Namespace path.
+    pub path: String,
+    /// Payload for writes (UTF-8).
+    #[serde(default)]
+    pub payload: Option<String>,
+}
+
+/// Summary of a replay run.
+#[derive(Debug, Clone, Copy, Default)]
+pub struct ReplaySummary {
+    /// Operations replayed.
+    pub ops: u64,
+    /// Operations that failed.
+    pub errors: u64,
+    /// Wall time of the replay in milliseconds.
+    pub elapsed_ms: u64,
+    /// Worst single-op divergence from the capture timeline in ms
+    /// (how far behind schedule the replay fell).
+    pub max_lag_ms: u64,
+}
+
+/// Replay a captured trace against the server.
+///
+/// `compression` divides the capture's inter-arrival gaps (1 = original
+/// timing, 10 = ten times faster); the summary reports how far the replay
+/// fell behind the compressed schedule, which is the throughput headroom
+/// signal: a replay that cannot keep schedule at 1x has regressed below
+/// the captured production load.
+pub fn replay_capture(
+    server: &NineDoor,
+    entries: &[CaptureEntry],
+    compression: u64,
+) -> Result<ReplaySummary> {
+    let connection = server.connect().context("connect replayer")?;
+    let mut client = CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)?;
+    let compression = compression.max(1);
+    let started = Instant::now();
+    let mut summary = ReplaySummary::default();
+    for entry in entries {
+        let due = Duration::from_millis(entry.t_ms / compression);
+        let now = started.elapsed();
+        if now < due {
+            std::thread::sleep(due - now);
+        } else {
+            summary.max_lag_ms = summary.max_lag_ms.max((now - due).as_millis() as u64);
+        }
+        summary.ops += 1;
+        let outcome = match entry.op.as_str() {
+            "read" => client
+                .open(&entry.path, OpenMode::read_only())
+                .and_then(|fid| {
+                    let result = client.read(fid, 0, 4096);
+                    let _ = client.clunk(fid);
+                    result.map(|_| ())
+                }),
+            "write" => client
+                .open(&entry.path, OpenMode::write_append())
+                .and_then(|fid| {
+                    let payload = entry.payload.as_deref().unwrap_or("");
+                    let result = client.write(fid, u64::MAX, payload.as_bytes());
+                    let _ = client.clunk(fid);
+                    result.map(|_| ())
+                }),
+            "list" => client.list_dir_window(&entry.path, 0, 1024).map(|_| ()),
+            _ => Ok(()),
+        };
+        if outcome.is_err() {
+            summary.errors += 1;
+        }
+    }
+    summary.elapsed_ms = started.elapsed().as_millis() as u64;
+    Ok(summary)
+}
+
+/// Parse a JSONL capture file.
+pub fn parse_capture(text: &str) -> Result<Vec<CaptureEntry>> {
+    text.lines()
+        .filter(|line| !line.trim().is_empty())
+        .map(|line| serde_json::from_str(line).with_context(|| format!("parse capture: {line}")))
+        .collect()
+}
+
+#[cfg(test)]
+mod replay_tests {
+    use super::*;
+
+    #[test]
+    fn replays_a_capture_with_time_compression() {
+        let server = NineDoor::new();
+        let capture = r#"
+{"t_ms":0,"op":"write","path":"/log/queen.log","payload":"replayed one\n"}
+{"t_ms":400,"op":"write","path":"/log/queen.log","payload":"replayed two\n"}
+{"t_ms":800,"op":"read","path":"/log/queen.log"}
+{"t_ms":900,"op":"read","path":"/no/such/file"}
+"#;
+        let entries = parse_capture(capture).expect("parse");
+        assert_eq!(entries.len(), 4);
+        let summary = replay_capture(&server, &entries, 100).expect("replay");
+        assert_eq!(summary.ops, 4);
+        assert!(summary.elapsed_ms < 400, "compression must apply");
+        // The nonexistent path contributes exactly one error slot.
+        assert_eq!(summary.errors, 1);
+    }
+}
+
+/// Result of a soak run: drift checks over sampled surfaces.
+#[derive(Debug, Clone, Default)]
+pub struct SoakReport {
+    /// Load cycles completed.
+    pub cycles: u64,
+    /// Total operations performed.
+    pub ops: u64,
+    /// Operation errors observed.
+    pub errors: u64,
+    /// Per-sample telemetry-file byte sizes for the monitored worker.
+    pub ring_samples: Vec<usize>,
+    /// Monotonic-drift verdicts (surface name, drifting).
+    pub drift: Vec<(&'static str, bool)>,
+}
+
+/// Drive sustained mixed load and sample for monotonic drift.
+///
+/// Sessions churn through fresh attaches each cycle, telemetry rings wrap
+/// under continuous appends, and workers respawn; the monitored surfaces
+/// are sampled per cycle and a surface whose last third of samples is
+/// strictly above its first third is flagged as drifting — the leak shape
+/// that only shows up after hours. Wall time is capped by `duration`, so
+/// CI runs a compressed soak while the lab points the same harness at
+/// hours.
+pub fn run_soak(server: &NineDoor, cycles: u64, cycle_duration: Duration) -> Result<SoakReport> {
+    let mut report = SoakReport::default();
+    for cycle in 0..cycles {
+        let profile = LoadProfile {
+            workers: 2,
+            telemetry_hz: 200,
+            duration: cycle_duration,
+            concurrency: 2,
+        };
+        let summary = run_load(server, &profile)?;
+        report.cycles += 1;
+        report.ops += summary.heartbeats + summary.telemetry_lines;
+        report.errors += summary.errors;
+
+        // Sample the monitored worker's telemetry size: bounded rings must
+        // plateau, not grow monotonically.
+        let connection = server.connect().context("connect sampler")?;
+        let mut sampler =
+            CohClient::connect(InProcessTransport::new(connection), Role::Queen, None)?;
+        let mut size = 0usize;
+        if let Ok(fid) = sampler.open("/worker/worker-1/telemetry", OpenMode::read_only()) {
+            let mut offset = 0u64;
+            while let Ok(chunk) = sampler.read(fid, offset, 4096) {
+                if chunk.is_empty() {
+                    break;
+                }
+                offset += chunk.len() as u64;
+                size += chunk.len();
+            }
+            let _ = sampler.clunk(fid);
+        }
+        report.ring_samples.push(size);
+        let _ = cycle;
+    }
+    report.drift.push((
+        "worker.telemetry.bytes",
+        is_monotonic_drift(&report.ring_samples),
+    ));
+    Ok(report)
+}
+
+/// True when the last third of samples sits strictly above the first third —
+/// the monotonic growth shape of a leak rather than noisy steady state.
+fn is_monotonic_drift(samples: &[usize]) -> bool {
+    if samples.len() < 6 {
+        return false;
+    }
+    let third = samples.len() / 3;
+    let early_max = samples[..third].iter().copied().max().unwrap_or(0);
+    samples[samples.len() - third..]
+        .iter()
+        .all(|sample| *sample > early_max)
+}
+
+#[cfg(test)]
+mod soak_tests {
+    use super::*;
+
+    #[test]
+    fn soak_detects_plateau_not_drift_on_bounded_rings() {
+        let server = NineDoor::new();
+        let report = run_soak(&server, 9, Duration::from_millis(150)).expect("soak run");
+        assert_eq!(report.cycles, 9);
+        assert!(report.ops > 0);
+        assert_eq!(report.errors, 0);
+        let (surface, drifting) = report.drift[0];
+        assert_eq!(surface, "worker.telemetry.bytes");
+        assert!(
+            !drifting,
+            "bounded rings must plateau: {:?}",
+            report.ring_samples
+        );
+    }
+
+    #[test]
+    fn drift_shape_is_detected() {
+        assert!(is_monotonic_drift(&[10, 11, 10, 50, 60, 70]));
+        assert!(!is_monotonic_drift(&[10, 50, 10, 50, 10, 50]));
+        assert!(!is_monotonic_drift(&[1, 2]));
+    }
+}
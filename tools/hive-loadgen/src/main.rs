@@ -0,0 +1,61 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: CLI entry point for the hive load generator.
+// Author: Lukas Bower
+#![forbid(unsafe_code)]
+
+use std::time::Duration;
+
+use anyhow::Result;
+use clap::Parser;
+use hive_loadgen::{run_load, LoadProfile};
+
+/// Simulate a worker population against an in-process NineDoor server.
+#[derive(Debug, Parser)]
+struct Cli {
+    /// Simulated worker count.
+    #[arg(long, default_value_t = 100)]
+    workers: usize,
+    /// Telemetry lines per worker per second.
+    #[arg(long, default_value_t = 10)]
+    telemetry_hz: u32,
+    /// Run duration in seconds.
+    #[arg(long, default_value_t = 10)]
+    seconds: u64,
+    /// Concurrent generator sessions.
+    #[arg(long, default_value_t = 8)]
+    concurrency: usize,
+    /// Replay a captured JSONL trace instead of generating synthetic load.
+    #[arg(long)]
+    replay: Option<std::path::PathBuf>,
+    /// Time-compression factor for replay (1 = original timing).
+    #[arg(long, default_value_t = 1)]
+    compression: u64,
+}
+
+fn main() -> Result<()> {
+    let cli = Cli::parse();
+    let server = nine_door::NineDoor::new();
+    if let Some(capture_path) = &cli.replay {
+        let text = std::fs::read_to_string(capture_path)?;
+        let entries = hive_loadgen::parse_capture(&text)?;
+        let summary = hive_loadgen::replay_capture(&server, &entries, cli.compression)?;
+        println!(
+            "replay ops={} errors={} elapsed_ms={} max_lag_ms={}",
+            summary.ops, summary.errors, summary.elapsed_ms, summary.max_lag_ms
+        );
+        return Ok(());
+    }
+    let profile = LoadProfile {
+        workers: cli.workers,
+        telemetry_hz: cli.telemetry_hz,
+        duration: Duration::from_secs(cli.seconds),
+        concurrency: cli.concurrency,
+    };
+    let summary = run_load(&server, &profile)?;
+    println!(
+        "loadgen workers={} heartbeats={} telemetry_lines={} errors={}",
+        cli.workers, summary.heartbeats, summary.telemetry_lines, summary.errors
+    );
+    Ok(())
+}
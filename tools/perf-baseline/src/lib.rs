@@ -0,0 +1,175 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: Append-only performance baseline store with noise-aware comparison.
+// Author: Lukas Bower
+#![forbid(unsafe_code)]
+#![warn(missing_docs)]
+
+//! Performance baseline store.
+//!
+//! Benchmark results append as JSONL entries keyed by metric, commit, and
+//! platform (the README's M-series/g5g/t4g matrix); the comparator checks a
+//! new result against the most recent baseline for the same metric and
+//! platform and flags deltas beyond a noise threshold, so codec, IPC, and
+//! GPU-bridge suite numbers stop dying in terminal scrollback.
+
+use std::fs::OpenOptions;
+use std::io::{BufRead, BufReader, Write};
+use std::path::Path;
+
+use anyhow::{Context, Result};
+use serde::{Deserialize, Serialize};
+
+/// One recorded benchmark result.
+#[derive(Debug, Clone, Serialize, Deserialize, PartialEq)]
+pub struct BaselineEntry {
+    /// Metric identifier, e.g. `codec/decode_request/adversarial_corpus`.
+    pub metric: String,
+    /// Commit the result was measured at.
+    pub commit: String,
+    /// Platform key from the support matrix (e.g. `t4g`, `g5g`, `m3`).
+    pub platform: String,
+    /// Measured value (lower is better; nanoseconds or bytes per the metric).
+    pub value: f64,
+    /// Unix timestamp in seconds.
+    pub recorded_at: u64,
+}
+
+/// Outcome of comparing a new value against the stored baseline.
+#[derive(Debug, Clone, PartialEq)]
+pub enum Comparison {
+    /// No baseline exists yet for the metric/platform.
+    NoBaseline,
+    /// Within the noise threshold of the baseline.
+    WithinNoise {
+        /// Relative delta (positive = regression).
+        delta: f64,
+    },
+    /// Regression beyond the threshold.
+    Regression {
+        /// Relative delta.
+        delta: f64,
+        /// Baseline value compared against.
+        baseline: f64,
+    },
+    /// Improvement beyond the threshold.
+    Improvement {
+        /// Relative delta (negative).
+        delta: f64,
+        /// Baseline value compared against.
+        baseline: f64,
+    },
+}
+
+/// Append an entry to the store.
+pub fn append(path: &Path, entry: &BaselineEntry) -> Result<()> {
+    let mut file = OpenOptions::new()
+        .create(true)
+        .append(true)
+        .open(path)
+        .with_context(|| format!("open baseline store {}", path.display()))?;
+    let line = serde_json::to_string(entry)?;
+    writeln!(file, "{line}")?;
+    Ok(())
+}
+
+/// Latest baseline for a metric/platform pair.
+pub fn latest(path: &Path, metric: &str, platform: &str) -> Result<Option<BaselineEntry>> {
+    if !path.is_file() {
+        return Ok(None);
+    }
+    let reader = BufReader::new(std::fs::File::open(path)?);
+    let mut newest: Option<BaselineEntry> = None;
+    for line in reader.lines() {
+        let line = line?;
+        if line.trim().is_empty() {
+            continue;
+        }
+        let entry: BaselineEntry =
+            serde_json::from_str(&line).with_context(|| format!("parse baseline line {line}"))?;
+        if entry.metric == metric
+            && entry.platform == platform
+            && newest
+                .as_ref()
+                .is_none_or(|best| entry.recorded_at >= best.recorded_at)
+        {
+            newest = Some(entry);
+        }
+    }
+    Ok(newest)
+}
+
+/// Compare a new value against the stored baseline with a relative noise
+/// threshold (e.g. 0.05 for 5%).
+pub fn compare(
+    path: &Path,
+    metric: &str,
+    platform: &str,
+    value: f64,
+    noise: f64,
+) -> Result<Comparison> {
+    let Some(baseline) = latest(path, metric, platform)? else {
+        return Ok(Comparison::NoBaseline);
+    };
+    let delta = (value - baseline.value) / baseline.value;
+    Ok(if delta > noise {
+        Comparison::Regression {
+            delta,
+            baseline: baseline.value,
+        }
+    } else if delta < -noise {
+        Comparison::Improvement {
+            delta,
+            baseline: baseline.value,
+        }
+    } else {
+        Comparison::WithinNoise { delta }
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn entry(metric: &str, platform: &str, value: f64, at: u64) -> BaselineEntry {
+        BaselineEntry {
+            metric: metric.to_owned(),
+            commit: "abc123".to_owned(),
+            platform: platform.to_owned(),
+            value,
+            recorded_at: at,
+        }
+    }
+
+    #[test]
+    fn append_compare_and_flag_regressions() {
+        let dir = tempfile::TempDir::new().unwrap();
+        let store = dir.path().join("baselines.jsonl");
+        assert_eq!(
+            compare(&store, "codec/decode", "t4g", 100.0, 0.05).unwrap(),
+            Comparison::NoBaseline
+        );
+        append(&store, &entry("codec/decode", "t4g", 100.0, 1)).unwrap();
+        append(&store, &entry("codec/decode", "g5g", 50.0, 2)).unwrap();
+        append(&store, &entry("codec/decode", "t4g", 102.0, 3)).unwrap();
+
+        // Latest t4g baseline is 102; 104 is within 5% noise, 120 is not.
+        assert!(matches!(
+            compare(&store, "codec/decode", "t4g", 104.0, 0.05).unwrap(),
+            Comparison::WithinNoise { .. }
+        ));
+        assert!(matches!(
+            compare(&store, "codec/decode", "t4g", 120.0, 0.05).unwrap(),
+            Comparison::Regression { baseline, .. } if baseline == 102.0
+        ));
+        assert!(matches!(
+            compare(&store, "codec/decode", "t4g", 80.0, 0.05).unwrap(),
+            Comparison::Improvement { .. }
+        ));
+        // Platforms never cross-contaminate.
+        assert!(matches!(
+            compare(&store, "codec/decode", "g5g", 52.0, 0.05).unwrap(),
+            Comparison::WithinNoise { .. }
+        ));
+    }
+}
@@ -0,0 +1,104 @@
+// Copyright © 2025 Lukas Bower
+// SPDX-License-Identifier: Apache-2.0
+// Purpose: CLI for the performance baseline store.
+// Author: Lukas Bower
+#![forbid(unsafe_code)]
+
+use std::path::PathBuf;
+use std::time::{SystemTime, UNIX_EPOCH};
+
+use anyhow::Result;
+use clap::{Parser, Subcommand};
+use perf_baseline::{append, compare, BaselineEntry, Comparison};
+
+/// Record and compare benchmark baselines.
+#[derive(Debug, Parser)]
+struct Cli {
+    /// Baseline store path.
+    #[arg(long, default_value = "out/perf_baselines.jsonl")]
+    store: PathBuf,
+    #[command(subcommand)]
+    command: Command,
+}
+
+#[derive(Debug, Subcommand)]
+enum Command {
+    /// Append a result to the store.
+    Record {
+        /// Metric identifier.
+        #[arg(long)]
+        metric: String,
+        /// Commit hash.
+        #[arg(long)]
+        commit: String,
+        /// Platform key (t4g, g5g, m3, ...).
+        #[arg(long)]
+        platform: String,
+        /// Measured value.
+        #[arg(long)]
+        value: f64,
+    },
+    /// Compare a value against the stored baseline.
+    Compare {
+        /// Metric identifier.
+        #[arg(long)]
+        metric: String,
+        /// Platform key.
+        #[arg(long)]
+        platform: String,
+        /// Measured value.
+        #[arg(long)]
+        value: f64,
+        /// Relative noise threshold.
+        #[arg(long, default_value_t = 0.05)]
+        noise: f64,
+    },
+}
+
+fn main() -> Result<()> {
+    let cli = Cli::parse();
+    match cli.command {
+        Command::Record {
+            metric,
+            commit,
+            platform,
+            value,
+        } => {
+            append(
+                &cli.store,
+                &BaselineEntry {
+                    metric,
+                    commit,
+                    platform,
+                    value,
+                    recorded_at: SystemTime::now()
+                        .duration_since(UNIX_EPOCH)
+                        .unwrap_or_default()
+                        .as_secs(),
+                },
+            )?;
+            Ok(())
+        }
+        Command::Compare {
+            metric,
+            platform,
+            value,
+            noise,
+        } => {
+            match compare(&cli.store, &metric, &platform, value, noise)? {
+                Comparison::NoBaseline => println!("no-baseline metric={metric}"),
+                Comparison::WithinNoise { delta } => {
+                    println!("ok metric={metric} delta={delta:+.4}")
+                }
+                Comparison::Improvement { delta, baseline } => {
+                    println!("improvement metric={metric} delta={delta:+.4} baseline={baseline}")
+                }
+                Comparison::Regression { delta, baseline } => {
+                    println!("REGRESSION metric={metric} delta={delta:+.4} baseline={baseline}");
+                    std::process::exit(1);
+                }
+            }
+            Ok(())
+        }
+    }
+}